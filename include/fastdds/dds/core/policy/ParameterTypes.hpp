@@ -1129,6 +1129,13 @@ const char* const parameter_policy_physical_data_process = "fastdds.physical_dat
  */
 const char* const parameter_enable_monitor_service = "fastdds.enable_monitor_service";
 
+/**
+ * Parameter property value for the Bloom filter of the topics of the endpoints of a participant
+ *
+ * @ingroup PARAMETER_MODULE
+ */
+const char* const parameter_property_topic_digest = "fastdds.topic_digest";
+
 /**
  * @ingroup PARAMETER_MODULE
  */
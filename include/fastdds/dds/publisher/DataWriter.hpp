@@ -19,6 +19,8 @@
 #ifndef _FASTDDS_DDS_PUBLISHER_DATAWRITER_HPP_
 #define _FASTDDS_DDS_PUBLISHER_DATAWRITER_HPP_
 
+#include <vector>
+
 #include <fastdds/dds/builtin/topic/SubscriptionBuiltinTopicData.hpp>
 #include <fastdds/dds/core/Entity.hpp>
 #include <fastdds/dds/core/status/BaseStatus.hpp>
@@ -196,6 +198,40 @@ public:
             const fastrtps::rtps::Time_t& timestamp);
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
+    /**
+     * @brief Write a batch of samples in a single operation.
+     *
+     * All the samples are serialized before adding them to the history, which is locked only once, and the samples
+     * sent synchronously are grouped on as few RTPS messages as possible.
+     * Samples are added to the history in order, and when one of them cannot be serialized or added, it and the
+     * samples after it are discarded.
+     * When the property @c fastdds.parallel_serialization.threads is set on the DataWriterQos, batches with samples
+     * of, at least, @c fastdds.parallel_serialization.min_size bytes (64 KiB by default) are serialized by that
+     * number of worker threads, and each sample is added to the history as soon as it is serialized. In this case,
+     * the type support should allow concurrent calls to its serialize operation. The worker threads are configured
+     * with the @c builtin_controllers_sender_thread settings of the DomainParticipantQos.
+     * This operation may block and return RETCODE_TIMEOUT under the same circumstances described for the
+     * @ref write operation.
+     *
+     * @param samples Pointers to the samples. Samples obtained with @ref loan_sample are also accepted.
+     * @param params Extra write parameters, applied to all the samples. On return, holds the ones of the last
+     * written sample.
+     * @return RETCODE_OK if all the samples were written, RETCODE_NOT_ENABLED if the DataWriter is not enabled,
+     * RETCODE_BAD_PARAMETER if any of the pointers is null, or any of the codes returned by @ref write otherwise.
+     */
+    RTPS_DllAPI ReturnCode_t write_many(
+            const std::vector<void*>& samples,
+            fastrtps::rtps::WriteParams& params);
+
+    /**
+     * @brief Write a batch of samples in a single operation, using the default write parameters.
+     *
+     * @param samples Pointers to the samples.
+     * @return Same as @ref write_many(const std::vector<void*>&, fastrtps::rtps::WriteParams&).
+     */
+    RTPS_DllAPI ReturnCode_t write_many(
+            const std::vector<void*>& samples);
+
     /*!
      * @brief Informs that the application will be modifying a particular instance.
      *
@@ -35,6 +35,8 @@
 #include <fastdds/dds/core/status/SubscriptionMatchedStatus.hpp>
 #include <fastdds/dds/subscriber/ReadCondition.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/SampleInfoBatch.hpp>
+#include <fastdds/dds/subscriber/SerializedSampleView.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 
 #include <fastrtps/fastrtps_dll.h>
@@ -751,6 +753,104 @@ public:
             LoanableCollection& data_values,
             SampleInfoSeq& sample_infos);
 
+    /**
+     * Access a collection of samples from the DataReader without deserializing them.
+     *
+     * This operation has the same behavior as @ref read, except that each element of @c data_values is a
+     * SerializedSampleView over the serialized payload of the sample, instead of a deserialized sample. Fields are
+     * decoded only when the application accesses them, and the whole sample can be decoded with
+     * SerializedSampleView::deserialize. This is useful when most samples are discarded after inspecting a few fields.
+     *
+     * Views always reference memory of the DataReader, so @c data_values must be empty (<tt> max_len == 0 </tt>)
+     * and the loan must be returned by means of @ref return_loan. Otherwise the operation fails with
+     * RETCODE_PRECONDITION_NOT_MET.
+     * When using data-sharing, the application must check that the sample has not been overridden, as with any other
+     * loaned sample.
+     *
+     * @param [in,out] data_values     A SerializedSampleViewSeq object where the views will be returned.
+     * @param [in,out] sample_infos    A SampleInfoSeq object where the received sample info will be returned.
+     * @param [in]     max_samples     The maximum number of samples to be returned.
+     * @param [in]     sample_states   Only data samples with @c sample_state matching one of these will be returned.
+     * @param [in]     view_states     Only data samples with @c view_state matching one of these will be returned.
+     * @param [in]     instance_states Only data samples with @c instance_state matching one of these will be returned.
+     *
+     * @return Any of the standard return codes.
+     */
+    RTPS_DllAPI ReturnCode_t read_serialized(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples = LENGTH_UNLIMITED,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE);
+
+    /**
+     * Access a collection of samples from the DataReader without deserializing them, and 'remove' them from the
+     * DataReader.
+     *
+     * This operation has the same behavior as @ref read_serialized, except that the samples are 'taken' from the
+     * DataReader such that they are no longer accessible via subsequent 'read' or 'take' operations.
+     *
+     * @param [in,out] data_values     A SerializedSampleViewSeq object where the views will be returned.
+     * @param [in,out] sample_infos    A SampleInfoSeq object where the received sample info will be returned.
+     * @param [in]     max_samples     The maximum number of samples to be returned.
+     * @param [in]     sample_states   Only data samples with @c sample_state matching one of these will be returned.
+     * @param [in]     view_states     Only data samples with @c view_state matching one of these will be returned.
+     * @param [in]     instance_states Only data samples with @c instance_state matching one of these will be returned.
+     *
+     * @return Any of the standard return codes.
+     */
+    RTPS_DllAPI ReturnCode_t take_serialized(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples = LENGTH_UNLIMITED,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE);
+
+    /**
+     * Access a collection of data samples from the DataReader, taking samples of all the instances in a single pass.
+     *
+     * This operation has the same behavior as @ref take with the default state masks, except that the information of
+     * the samples is returned on a SampleInfoBatch, which stores only the source timestamp, instance handle, writer
+     * GUID, sequence number and validity of each sample on contiguous columns.
+     * This avoids populating a full @ref SampleInfo per sample when a large number of samples are taken at once.
+     *
+     * The behavior of this operation follows the same rules as the @ref read operation regarding the pre-conditions and
+     * post-conditions for the @c data_values. If a loan is required (<tt> max_len == 0 </tt>), it must then be
+     * returned by means of @ref return_loan(LoanableCollection&, SampleInfoBatch&).
+     *
+     * If the DataReader has no samples, the operation fails with RETCODE_NO_DATA.
+     *
+     * @param [in,out] data_values  A LoanableCollection object where the received data samples will be returned.
+     * @param [out]    sample_infos A SampleInfoBatch object where the information of the samples will be returned.
+     *                              Its previous contents are discarded.
+     * @param [in]     max_samples  The maximum number of samples to be returned. If the special value
+     *                              @ref LENGTH_UNLIMITED is provided, as many samples will be returned as are
+     *                              available, up to the limits described in the documentation for @ref read().
+     *
+     * @return Any of the standard return codes.
+     */
+    RTPS_DllAPI ReturnCode_t take_batch(
+            LoanableCollection& data_values,
+            SampleInfoBatch& sample_infos,
+            int32_t max_samples = LENGTH_UNLIMITED);
+
+    /**
+     * This operation indicates to the DataReader that the application is done accessing the collection of
+     * @c data_values obtained by some earlier invocation of @ref take_batch on the DataReader.
+     *
+     * @param [in,out] data_values   A LoanableCollection object where the received data samples were obtained from
+     *                               an earlier invocation of take_batch on this DataReader.
+     * @param [in,out] sample_infos  The SampleInfoBatch object obtained on the same invocation of take_batch.
+     *                               It is cleared on return.
+     *
+     * @return Any of the standard return codes.
+     */
+    RTPS_DllAPI ReturnCode_t return_loan(
+            LoanableCollection& data_values,
+            SampleInfoBatch& sample_infos);
+
     /**
      * NOT YET IMPLEMENTED
      *
@@ -0,0 +1,95 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SampleInfoBatch.hpp
+ *
+ */
+
+#ifndef _FASTDDS_DDS_SUBSCRIBER_SAMPLEINFOBATCH_HPP_
+#define _FASTDDS_DDS_SUBSCRIBER_SAMPLEINFOBATCH_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include <fastdds/dds/common/InstanceHandle.hpp>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/SequenceNumber.h>
+#include <fastdds/rtps/common/Time_t.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/*!
+ * @brief SampleInfoBatch holds the information of the samples returned by DataReader::take_batch.
+ *
+ * Information is stored in columns, where position @c i of each column corresponds to the sample at position @c i
+ * of the data collection. Columns are reused across calls, so no memory is allocated once they have grown to the
+ * size of the usual batch.
+ */
+struct SampleInfoBatch
+{
+    //! time provided by the DataWriter when each sample was written
+    std::vector<fastrtps::rtps::Time_t> source_timestamp;
+
+    //! identifies locally the instance of each sample
+    std::vector<InstanceHandle_t> instance_handle;
+
+    //! GUID of the DataWriter that wrote each sample
+    std::vector<fastrtps::rtps::GUID_t> writer_guid;
+
+    //! sequence number of each sample on its DataWriter
+    std::vector<fastrtps::rtps::SequenceNumber_t> sequence_number;
+
+    //! whether each sample contains data or is only used to communicate of a change in the instance
+    std::vector<bool> valid_data;
+
+    //! Number of samples described by the batch
+    size_t size() const noexcept
+    {
+        return sequence_number.size();
+    }
+
+    //! Remove the information of all the samples, keeping the allocated memory
+    void clear() noexcept
+    {
+        source_timestamp.clear();
+        instance_handle.clear();
+        writer_guid.clear();
+        sequence_number.clear();
+        valid_data.clear();
+    }
+
+    /*!
+     * @brief Preallocate all the columns.
+     * @param max_samples Number of samples that should fit without allocating memory.
+     */
+    void reserve(
+            size_t max_samples)
+    {
+        source_timestamp.reserve(max_samples);
+        instance_handle.reserve(max_samples);
+        writer_guid.reserve(max_samples);
+        sequence_number.reserve(max_samples);
+        valid_data.reserve(max_samples);
+    }
+
+};
+
+}  // namespace dds
+}  // namespace fastdds
+}  // namespace eprosima
+
+#endif /* _FASTDDS_DDS_SUBSCRIBER_SAMPLEINFOBATCH_HPP_*/
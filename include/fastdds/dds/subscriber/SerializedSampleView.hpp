@@ -0,0 +1,272 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SerializedSampleView.hpp
+ *
+ */
+
+#ifndef _FASTDDS_DDS_SUBSCRIBER_SERIALIZEDSAMPLEVIEW_HPP_
+#define _FASTDDS_DDS_SUBSCRIBER_SERIALIZEDSAMPLEVIEW_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include <fastdds/dds/core/LoanableSequence.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastdds/rtps/common/Types.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+namespace detail {
+struct SampleLoanManager;
+} // namespace detail
+
+/*!
+ * @brief SerializedSampleView gives access to a received sample without deserializing it.
+ *
+ * Views are loaned by DataReader::read_serialized and DataReader::take_serialized, and reference the serialized
+ * payload kept by the DataReader until the loan is returned.
+ * Fields are decoded on access from their offset on the serialized data, which does not include the encapsulation
+ * header nor, for delimited XCDR2 encapsulations, the DHEADER of the sample. The whole sample can be decoded with
+ * @ref deserialize once the application decides it is needed.
+ *
+ * Fields can only be decoded directly on plain and delimited encapsulations, whose alignment rules (8 bytes for XCDR1,
+ * 4 bytes for XCDR2) are checked on each access. Parameter list encapsulations, used by mutable types, are rejected
+ * by the accessors, and should be decoded with @ref deserialize.
+ */
+class SerializedSampleView
+{
+public:
+
+    using octet = fastrtps::rtps::octet;
+
+    SerializedSampleView() = default;
+
+    //! Pointer to the serialized members, after the encapsulation header and the DHEADER (if any)
+    const octet* data() const noexcept
+    {
+        return data_ + header_size + dheader_size();
+    }
+
+    //! Length of the serialized members, not including the encapsulation header and the DHEADER (if any)
+    uint32_t size() const noexcept
+    {
+        uint32_t members_offset = header_size + dheader_size();
+        if (length_ < members_offset)
+        {
+            return 0u;
+        }
+
+        uint32_t ret = length_ - members_offset;
+        if (0u != dheader_size())
+        {
+            uint32_t dheader = 0u;
+            decode(data_ + header_size, dheader);
+            ret = dheader < ret ? dheader : ret;
+        }
+        return ret;
+    }
+
+    //! Encapsulation identifier of the serialized data (i.e. CDR_LE), or 0xFFFF when there is no serialized data
+    uint16_t encapsulation() const noexcept
+    {
+        if (nullptr == data_ || length_ < header_size)
+        {
+            return invalid_encapsulation;
+        }
+        return static_cast<uint16_t>((static_cast<uint16_t>(data_[0]) << 8) | data_[1]);
+    }
+
+    //! Whether the serialized data uses little endian encoding
+    bool is_little_endian() const noexcept
+    {
+        return invalid_encapsulation != encapsulation() && 0 != (data_[1] & 0x01);
+    }
+
+    /*!
+     * @brief Whether fields can be decoded directly from the serialized data.
+     *
+     * @return true for plain XCDR1, plain XCDR2 and delimited XCDR2 encapsulations.
+     */
+    bool is_supported() const noexcept
+    {
+        return 0u != max_alignment();
+    }
+
+    /*!
+     * @brief Decode a primitive field.
+     *
+     * @param [in]  offset Offset of the field on the serialized data.
+     * @param [out] value  Decoded value.
+     *
+     * @return true when the field lies inside the serialized data, @c offset is aligned to the alignment of the
+     *         field on the encapsulation of the data, and the encapsulation is supported.
+     */
+    template<typename T>
+    bool get(
+            uint32_t offset,
+            T& value) const
+    {
+        static_assert(std::is_arithmetic<T>::value, "Only primitive fields can be decoded directly");
+
+        // Offsets are relative to the origin of the serialized members, which is always aligned to the maximum
+        // alignment of the encapsulation, so an offset is aligned when it is a multiple of the field alignment.
+        uint32_t alignment = max_alignment();
+        if (0u == alignment)
+        {
+            return false;
+        }
+        alignment = sizeof(T) < alignment ? static_cast<uint32_t>(sizeof(T)) : alignment;
+
+        uint32_t length = size();
+        if (0u != (offset % alignment) || offset > length || sizeof(T) > length - offset)
+        {
+            return false;
+        }
+
+        decode(data() + offset, value);
+        return true;
+    }
+
+    /*!
+     * @brief Decode a string field.
+     *
+     * @param [in]  offset      Offset of the (aligned) length of the string on the serialized data.
+     * @param [out] value       Decoded value.
+     * @param [out] next_offset When not null, receives the offset following the string, which can be used to locate
+     *                          the fields serialized after it.
+     *
+     * @return true when the whole string lies inside the serialized data, and the encapsulation is supported.
+     */
+    bool get(
+            uint32_t offset,
+            std::string& value,
+            uint32_t* next_offset = nullptr) const
+    {
+        uint32_t str_len = 0;
+        if (!get(offset, str_len) || str_len > size() - offset - 4u)
+        {
+            return false;
+        }
+
+        const char* str = reinterpret_cast<const char*>(data() + offset + 4u);
+        // Serialized length includes the terminating null character
+        value.assign(str, (str_len > 0 && '\0' == str[str_len - 1]) ? str_len - 1 : str_len);
+        if (nullptr != next_offset)
+        {
+            *next_offset = offset + 4u + str_len;
+        }
+        return true;
+    }
+
+    /*!
+     * @brief Decode the whole sample.
+     *
+     * @param [out] sample Pointer to a sample of the type of the DataReader.
+     *
+     * @return true when the sample could be deserialized.
+     */
+    bool deserialize(
+            void* sample) const
+    {
+        if (nullptr == type_ || nullptr == data_)
+        {
+            return false;
+        }
+
+        fastrtps::rtps::SerializedPayload_t payload;
+        payload.data = const_cast<octet*>(data_);
+        payload.length = length_;
+        payload.max_size = length_;
+        bool ret = type_->deserialize(&payload, sample);
+        payload.data = nullptr;
+        return ret;
+    }
+
+private:
+
+    friend struct detail::SampleLoanManager;
+
+    static constexpr uint32_t header_size =
+            static_cast<uint32_t>(fastrtps::rtps::SerializedPayload_t::representation_header_size);
+
+    static constexpr uint16_t invalid_encapsulation = 0xFFFF;
+
+    //! Encapsulation identifiers (big endian variant) from the XTypes specification
+    static constexpr uint16_t plain_cdr = CDR_BE;
+    static constexpr uint16_t plain_cdr2 = 0x0006;
+    static constexpr uint16_t delimited_cdr2 = 0x0008;
+
+    //! Maximum alignment of primitive fields on the encapsulation of the data, or 0 if it is not supported
+    uint32_t max_alignment() const noexcept
+    {
+        switch (encapsulation() & ~static_cast<uint16_t>(0x0001))
+        {
+            case plain_cdr:
+                return 8u;
+            case plain_cdr2:
+            case delimited_cdr2:
+                return 4u;
+            default:
+                return 0u;
+        }
+    }
+
+    //! Size of the DHEADER preceding the serialized members
+    uint32_t dheader_size() const noexcept
+    {
+        return delimited_cdr2 == (encapsulation() & ~static_cast<uint16_t>(0x0001)) ? 4u : 0u;
+    }
+
+    //! Decode a primitive value stored with the endianness of the data
+    template<typename T>
+    void decode(
+            const octet* src,
+            T& value) const noexcept
+    {
+        octet bytes[sizeof(T)];
+        memcpy(bytes, src, sizeof(T));
+        if (is_little_endian() != (fastrtps::rtps::LITTLEEND == fastrtps::rtps::DEFAULT_ENDIAN))
+        {
+            for (size_t i = 0; i < sizeof(T) / 2; ++i)
+            {
+                octet tmp = bytes[i];
+                bytes[i] = bytes[sizeof(T) - 1 - i];
+                bytes[sizeof(T) - 1 - i] = tmp;
+            }
+        }
+        memcpy(&value, bytes, sizeof(T));
+    }
+
+    //! Serialized data, including the encapsulation header
+    const octet* data_ = nullptr;
+    //! Length of the serialized data, including the encapsulation header
+    uint32_t length_ = 0;
+    //! Type used to deserialize the sample
+    TopicDataType* type_ = nullptr;
+};
+
+FASTDDS_SEQUENCE(SerializedSampleViewSeq, SerializedSampleView);
+
+}  // namespace dds
+}  // namespace fastdds
+}  // namespace eprosima
+
+#endif /* _FASTDDS_DDS_SUBSCRIBER_SERIALIZEDSAMPLEVIEW_HPP_*/
@@ -26,6 +26,7 @@
 #include <fastdds/rtps/attributes/WriterAttributes.h>
 #include <fastdds/rtps/builtin/data/BuiltinEndpoints.hpp>
 #include <fastdds/rtps/common/RemoteLocators.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
 #include <fastdds/rtps/common/Token.h>
 #include <fastdds/rtps/common/VendorId_t.hpp>
 #if HAVE_SECURITY
@@ -122,6 +123,32 @@ public:
 
     SampleIdentity m_sample_identity;
 
+    //! Hash of the serialized DATA(p) this object was read from. 0 when unknown.
+    uint64_t m_serialized_hash = 0;
+
+    //! Serialized DATA(p) this object was read from. Empty when unknown.
+    std::vector<octet> m_serialized_payload;
+
+    /**
+     * Keep the serialized DATA(p) this object was read from
+     * @param payload Serialized DATA(p)
+     * @param hash Hash of the payload, computed with ParameterList::payload_hash
+     */
+    RTPS_DllAPI void serialized_payload(
+            const SerializedPayload_t& payload,
+            uint64_t hash);
+
+    /**
+     * Check whether this object was read from a serialized DATA(p)
+     * The hash only discards different payloads without comparing them
+     * @param payload Serialized DATA(p)
+     * @param hash Hash of the payload, computed with ParameterList::payload_hash
+     * @return Whether the payload is the one this object was read from
+     */
+    RTPS_DllAPI bool is_read_from(
+            const SerializedPayload_t& payload,
+            uint64_t hash) const;
+
     /**
      * Update the data.
      * @param pdata Object to copy the data from
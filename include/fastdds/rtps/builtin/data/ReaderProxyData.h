@@ -25,6 +25,7 @@
 #include <fastdds/rtps/attributes/WriterAttributes.h>
 #include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
 #include <fastdds/rtps/common/RemoteLocators.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
 #include <fastdds/rtps/common/VendorId_t.hpp>
 #if HAVE_SECURITY
 #include <fastdds/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
@@ -408,6 +409,35 @@ public:
         return fastdds::dds::get_proxy_property<SampleIdentity>("PID_CLIENT_SERVER_KEY", m_properties);
     }
 
+    /**
+     * Keep the serialized DATA(r) this object was read from
+     * @param payload Serialized DATA(r)
+     * @param hash Hash of the payload, computed with ParameterList::payload_hash
+     */
+    RTPS_DllAPI void serialized_payload(
+            const SerializedPayload_t& payload,
+            uint64_t hash);
+
+    /**
+     * Check whether this object was read from a serialized DATA(r)
+     * The hash only discards different payloads without comparing them
+     * @param payload Serialized DATA(r)
+     * @param hash Hash of the payload, computed with ParameterList::payload_hash
+     * @return Whether the payload is the one this object was read from
+     */
+    RTPS_DllAPI bool is_read_from(
+            const SerializedPayload_t& payload,
+            uint64_t hash) const;
+
+    /**
+     * Get the hash of the serialized DATA(r) this object was read from
+     * @return Hash computed with ParameterList::payload_hash, or 0 when unknown
+     */
+    uint64_t serialized_hash() const
+    {
+        return serialized_hash_;
+    }
+
     /**
      * Get the size in bytes of the CDR serialization of this object.
      * @param include_encapsulation Whether to include the size of the encapsulation info.
@@ -513,6 +543,10 @@ private:
     ParameterPropertyList_t m_properties;
     //!Information on the content filter applied by the reader.
     fastdds::rtps::ContentFilterProperty content_filter_;
+    //!Hash of the serialized DATA(r) this object was read from. 0 when unknown.
+    uint64_t serialized_hash_ = 0;
+    //!Serialized DATA(r) this object was read from. Empty when unknown.
+    std::vector<octet> serialized_payload_;
 };
 
 } // namespace rtps
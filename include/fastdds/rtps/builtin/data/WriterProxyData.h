@@ -23,6 +23,7 @@
 
 #include <fastdds/rtps/attributes/RTPSParticipantAllocationAttributes.hpp>
 #include <fastdds/rtps/common/RemoteLocators.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
 #include <fastdds/rtps/common/VendorId_t.hpp>
 #if HAVE_SECURITY
 #include <fastdds/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
@@ -406,6 +407,35 @@ public:
         return fastdds::dds::get_proxy_property<SampleIdentity>("PID_CLIENT_SERVER_KEY", m_properties);
     }
 
+    /**
+     * Keep the serialized DATA(w) this object was read from
+     * @param payload Serialized DATA(w)
+     * @param hash Hash of the payload, computed with ParameterList::payload_hash
+     */
+    RTPS_DllAPI void serialized_payload(
+            const SerializedPayload_t& payload,
+            uint64_t hash);
+
+    /**
+     * Check whether this object was read from a serialized DATA(w)
+     * The hash only discards different payloads without comparing them
+     * @param payload Serialized DATA(w)
+     * @param hash Hash of the payload, computed with ParameterList::payload_hash
+     * @return Whether the payload is the one this object was read from
+     */
+    RTPS_DllAPI bool is_read_from(
+            const SerializedPayload_t& payload,
+            uint64_t hash) const;
+
+    /**
+     * Get the hash of the serialized DATA(w) this object was read from
+     * @return Hash computed with ParameterList::payload_hash, or 0 when unknown
+     */
+    uint64_t serialized_hash() const
+    {
+        return serialized_hash_;
+    }
+
 #if HAVE_SECURITY
     //!EndpointSecurityInfo.endpoint_security_attributes
     security::EndpointSecurityAttributesMask security_attributes_;
@@ -503,6 +533,11 @@ private:
 
     //!
     ParameterPropertyList_t m_properties;
+
+    //!Hash of the serialized DATA(w) this object was read from. 0 when unknown.
+    uint64_t serialized_hash_ = 0;
+    //!Serialized DATA(w) this object was read from. Empty when unknown.
+    std::vector<octet> serialized_payload_;
 };
 
 } /* namespace rtps */
@@ -118,6 +118,16 @@ public:
         (void) pdata;
     }
 
+    /**
+     * Process the update of the announcement of an already discovered participant.
+     * @param pdata Updated ParticipantProxyData
+     */
+    virtual void remote_participant_updated(
+            const ParticipantProxyData& pdata)
+    {
+        (void) pdata;
+    }
+
     //! Verify whether the given participant EDP endpoints are matched with us
     virtual bool areRemoteEndpointsMatched(
             const ParticipantProxyData*)
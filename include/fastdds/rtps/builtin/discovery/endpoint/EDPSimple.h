@@ -40,6 +40,7 @@ class ReaderAttributes;
 class WriterAttributes;
 class EDPListener;
 class ITopicPayloadPool;
+class TopicDigestFilter;
 
 /**
  * Class EDPSimple, implements the Simple Endpoint Discovery Protocol defined in the RTPS specification.
@@ -114,6 +115,14 @@ public:
     void removeRemoteEndpoints(
             ParticipantProxyData* pdata) override;
 
+    /**
+     * Announce again the local endpoints whose announcement was filtered out for the participant, when the
+     * update of its topic digest makes them relevant for it.
+     * @param pdata Updated ParticipantProxyData
+     */
+    void remote_participant_updated(
+            const ParticipantProxyData& pdata) override;
+
     //! Verify whether the given participant EDP endpoints are matched with us
     bool areRemoteEndpointsMatched(
             const ParticipantProxyData* pdata) override;
@@ -242,6 +251,9 @@ protected:
     t_p_StatefulReader get_builtin_reader_history_pair_by_entity(
             const EntityId_t& entity_id);
 
+    //! Filter of the SEDP writers by the topic digest of the remote participants. Only created when enabled.
+    TopicDigestFilter* topic_digest_filter_ = nullptr;
+
     std::shared_ptr<ITopicPayloadPool> pub_writer_payload_pool_;
     std::shared_ptr<ITopicPayloadPool> pub_reader_payload_pool_;
     std::shared_ptr<ITopicPayloadPool> sub_writer_payload_pool_;
@@ -271,6 +283,12 @@ private:
             bool remove_same_instance,
             CacheChange_t** created_change);
 
+    //! Create the topic digest filter when enabled with the fastdds.discovery.topic_digest property
+    void create_topic_digest_filter();
+
+    //! Update the topic digest on the local DATA(p) and announce it
+    void announce_local_topic_digest();
+
 #if HAVE_SECURITY
     bool create_sedp_secure_endpoints();
 
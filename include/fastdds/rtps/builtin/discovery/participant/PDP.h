@@ -203,6 +203,19 @@ public:
     bool has_reader_proxy_data(
             const GUID_t& reader);
 
+    /**
+     * This method returns whether a ReaderProxyData read from a given serialized DATA(r) exists
+     * among the registered RTPSParticipants.
+     * @param [in] reader GUID_t of the reader we are looking for.
+     * @param [in] payload Serialized DATA(r).
+     * @param [in] serialized_hash Hash of the serialized DATA(r), as computed by ParameterList::payload_hash.
+     * @return True if found.
+     */
+    bool has_reader_proxy_data(
+            const GUID_t& reader,
+            const SerializedPayload_t& payload,
+            uint64_t serialized_hash);
+
     /**
      * This method gets a copy of a ReaderProxyData object if it is found among the registered RTPSParticipants
      * (including the local RTPSParticipant).
@@ -223,6 +236,19 @@ public:
     bool has_writer_proxy_data(
             const GUID_t& writer);
 
+    /**
+     * This method returns whether a WriterProxyData read from a given serialized DATA(w) exists
+     * among the registered RTPSParticipants.
+     * @param [in] writer GUID_t of the writer we are looking for.
+     * @param [in] payload Serialized DATA(w).
+     * @param [in] serialized_hash Hash of the serialized DATA(w), as computed by ParameterList::payload_hash.
+     * @return True if found.
+     */
+    bool has_writer_proxy_data(
+            const GUID_t& writer,
+            const SerializedPayload_t& payload,
+            uint64_t serialized_hash);
+
     /**
      * This method gets a copy of a WriterProxyData object if it is found among the registered RTPSParticipants
      * (including the local RTPSParticipant).
@@ -596,6 +622,14 @@ protected:
             ParticipantProxyData* pdata,
             bool& should_be_ignored);
 
+    /**
+     * Whether the initial announcements of the local participant are still being sent
+     */
+    bool initial_announcements_pending() const
+    {
+        return initial_announcements_.count > 0;
+    }
+
 #ifdef FASTDDS_STATISTICS
 
     std::atomic<const fastdds::statistics::rtps::IProxyObserver*> proxy_observer_;
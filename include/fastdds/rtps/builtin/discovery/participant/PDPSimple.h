@@ -161,6 +161,11 @@ private:
             const ReaderProxyData& remote_reader_data) override;
 #endif // HAVE_SECURITY
 
+    //! Periodic announcements sent as a HEARTBEAT between two full DATA(p). 0 means every announcement is full.
+    uint32_t heartbeat_announcements_ = 0;
+
+    //! Periodic announcements sent as a HEARTBEAT since the last full DATA(p)
+    uint32_t consecutive_heartbeat_announcements_ = 0;
 };
 
 } /* namespace rtps */
@@ -29,6 +29,7 @@
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/attributes/HistoryAttributes.h>
 #include <fastrtps/utils/TimedMutex.hpp>
+#include <fastrtps/utils/collections/RingVector.hpp>
 
 #include <cassert>
 #include <functional>
@@ -57,9 +58,10 @@ protected:
 
 public:
 
-    using iterator = std::vector<CacheChange_t*>::iterator;
-    using reverse_iterator = std::vector<CacheChange_t*>::reverse_iterator;
-    using const_iterator = std::vector<CacheChange_t*>::const_iterator;
+    using changes_container = RingVector<CacheChange_t*>;
+    using iterator = changes_container::iterator;
+    using reverse_iterator = changes_container::reverse_iterator;
+    using const_iterator = changes_container::const_iterator;
 
     //!Attributes of the History
     HistoryAttributes m_att;
@@ -303,8 +305,8 @@ public:
 
 protected:
 
-    //!Vector of pointers to the CacheChange_t.
-    std::vector<CacheChange_t*> m_changes;
+    //!Collection of pointers to the CacheChange_t. Removing the oldest change is a constant time operation.
+    changes_container m_changes;
 
     //!Variable to know if the history is full without needing to block the History mutex.
     bool m_isHistoryFull = false;
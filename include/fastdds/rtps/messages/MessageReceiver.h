@@ -21,6 +21,7 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 #include <functional>
+#include <mutex>
 #include <unordered_map>
 
 #include <fastdds/rtps/common/all_common.h>
@@ -35,6 +36,7 @@ class RTPSParticipantImpl;
 class Endpoint;
 class RTPSWriter;
 class RTPSReader;
+class ReceiveDispatcher;
 struct SubmessageHeader_t;
 
 /**
@@ -77,22 +79,36 @@ private:
     mutable eprosima::shared_mutex mtx_;
     std::vector<RTPSWriter*> associated_writers_;
     std::unordered_map<EntityId_t, std::vector<RTPSReader*>> associated_readers_;
+    //!Builtin readers in associated_readers_. User readers are found through the participant's matched readers index.
+    std::vector<RTPSReader*> associated_builtin_readers_;
 
     RTPSParticipantImpl* participant_;
-    //!Protocol version of the message
-    ProtocolVersion_t source_version_;
-    //!VendorID that created the message
-    fastdds::rtps::VendorId_t source_vendor_id_;
-    //!GuidPrefix of the entity that created the message
-    GuidPrefix_t source_guid_prefix_;
-    //!GuidPrefix of the entity that receives the message. GuidPrefix of the RTPSParticipant.
-    GuidPrefix_t dest_guid_prefix_;
-    //!Has the message timestamp?
-    bool have_timestamp_;
-    //!Timestamp associated with the message
-    Time_t timestamp_;
+    //!Worker threads where user readers process the submessages. Null when processed on the reception thread.
+    ReceiveDispatcher* dispatcher_;
+
+    /**
+     * State of the receiver while processing a message.
+     * It lives on the stack of processCDRMsg, so several threads can process messages at the same time.
+     */
+    struct ReceptionState
+    {
+        //!Protocol version of the message
+        ProtocolVersion_t source_version = c_ProtocolVersion;
+        //!VendorID that created the message
+        fastdds::rtps::VendorId_t source_vendor_id = c_VendorId_Unknown;
+        //!GuidPrefix of the entity that created the message
+        GuidPrefix_t source_guid_prefix = c_GuidPrefix_Unknown;
+        //!GuidPrefix of the entity that receives the message. GuidPrefix of the RTPSParticipant.
+        GuidPrefix_t dest_guid_prefix = c_GuidPrefix_Unknown;
+        //!Has the message timestamp?
+        bool have_timestamp = false;
+        //!Timestamp associated with the message
+        Time_t timestamp = c_TimeInvalid;
+    };
 
 #if HAVE_SECURITY
+    //!Serializes the processing of secure messages, as they are decoded on the buffers below
+    std::mutex crypto_mtx_;
     //!Buffer to process the decoded RTPS message
     CDRMessage_t crypto_msg_;
     //!Buffer to process each decoded RTPS sub-message
@@ -115,16 +131,15 @@ private:
                 uint16_t,
                 bool)> process_data_fragment_message_function_;
 
-    //!Reset the MessageReceiver to process a new message.
-    void reset();
-
     /**
      * Check the RTPSHeader of a received message.
      * @param msg Pointer to the message.
+     * @param state Reception state, updated with the information in the header.
      * @return True if correct.
      */
     bool checkRTPSHeader(
-            CDRMessage_t* msg);
+            CDRMessage_t* msg,
+            ReceptionState& state);
     /**
      * Read the submessage header of a message.
      * @param msg Pointer to the CDRMessage_t to read.
@@ -146,12 +161,23 @@ private:
     /**
      * Find all readers (in associated_readers_), with the given entity ID, and call the
      * callback provided.
+     * When the entity ID is unknown, the readers matched with the given writer are found through the participant's
+     * matched readers index.
      */
     template<typename Functor>
     void findAllReaders(
             const EntityId_t& readerID,
+            const GUID_t& writerGUID,
             const Functor& callback) const;
 
+    /**
+     * Check whether a reader is associated to this receiver.
+     * The reader pointer is only compared, so it can be used with readers that could have been removed.
+     */
+    bool isAssociated(
+            const EntityId_t& readerID,
+            const RTPSReader* reader) const;
+
     /**@name Processing methods.
      * These methods are designed to read a part of the message
      * and perform the corresponding actions:
@@ -162,6 +188,7 @@ private:
      * @param[in] smh          Pointer to the submessage header
      * @param[out] WriterID    Writer EntityID (only for DATA messages)
      * @param[in] was_decoded  Whether the submessage being processed came from decoding a secured submessage
+     * @param[in,out] state    Reception state of the message being processed
      * @return True if correct, false otherwise
      */
 
@@ -178,40 +205,50 @@ private:
             CDRMessage_t* msg,
             SubmessageHeader_t* smh,
             EntityId_t& writerID,
-            bool was_decoded) const;
+            bool was_decoded,
+            const ReceptionState& state) const;
     bool proc_Submsg_DataFrag(
             CDRMessage_t* msg,
             SubmessageHeader_t* smh,
-            bool was_decoded) const;
+            bool was_decoded,
+            const ReceptionState& state) const;
     bool proc_Submsg_Heartbeat(
             CDRMessage_t* msg,
             SubmessageHeader_t* smh,
-            bool was_decoded) const;
+            bool was_decoded,
+            const ReceptionState& state) const;
     bool proc_Submsg_Acknack(
             CDRMessage_t* msg,
             SubmessageHeader_t* smh,
-            bool was_decoded) const;
+            bool was_decoded,
+            const ReceptionState& state) const;
     bool proc_Submsg_Gap(
             CDRMessage_t* msg,
             SubmessageHeader_t* smh,
-            bool was_decoded) const;
+            bool was_decoded,
+            const ReceptionState& state) const;
     bool proc_Submsg_InfoTS(
             CDRMessage_t* msg,
-            SubmessageHeader_t* smh);
+            SubmessageHeader_t* smh,
+            ReceptionState& state);
     bool proc_Submsg_InfoDST(
             CDRMessage_t* msg,
-            SubmessageHeader_t* smh);
+            SubmessageHeader_t* smh,
+            ReceptionState& state);
     bool proc_Submsg_InfoSRC(
             CDRMessage_t* msg,
-            SubmessageHeader_t* smh);
+            SubmessageHeader_t* smh,
+            ReceptionState& state);
     bool proc_Submsg_NackFrag(
             CDRMessage_t* msg,
             SubmessageHeader_t* smh,
-            bool was_decoded) const;
+            bool was_decoded,
+            const ReceptionState& state) const;
     bool proc_Submsg_HeartbeatFrag(
             CDRMessage_t* msg,
             SubmessageHeader_t* smh,
-            bool was_decoded) const;
+            bool was_decoded,
+            const ReceptionState& state) const;
     ///@}
 
 
@@ -234,6 +271,11 @@ private:
             const EntityId_t& reader_id,
             CacheChange_t& change,
             bool was_decoded);
+
+    void process_data_message_with_dispatcher(
+            const EntityId_t& reader_id,
+            CacheChange_t& change,
+            bool was_decoded);
     ///@}
 
     /**
@@ -266,21 +308,38 @@ private:
             uint32_t fragment_starting_num,
             uint16_t fragments_in_submessage,
             bool was_decoded);
+
+    void process_data_fragment_message_with_dispatcher(
+            const EntityId_t& reader_id,
+            CacheChange_t& change,
+            uint32_t sample_size,
+            uint32_t fragment_starting_num,
+            uint16_t fragments_in_submessage,
+            bool was_decoded);
     ///@}
 
+    /**
+     * Check whether the submessages directed to a reader should be processed on the receive dispatcher.
+     * Builtin readers are always processed on the reception thread.
+     */
+    bool is_dispatched(
+            const RTPSReader* reader) const;
+
     /**
      * Looks for the statistics specific submessage and notifies statistics related to the received message.
      *
      * @param [in] source_locator Locator indicating the sending address.
      * @param [in] reception_locator Locator indicating the listening address.
      * @param [in] msg Pointer to the message
+     * @param [in] state Reception state of the message
      *
      * @pre The message header has already been read and validated.
      */
     void notify_network_statistics(
             const Locator_t& source_locator,
             const Locator_t& reception_locator,
-            CDRMessage_t* msg) const;
+            CDRMessage_t* msg,
+            const ReceptionState& state) const;
 
 };
 
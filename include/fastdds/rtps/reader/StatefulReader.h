@@ -35,6 +35,7 @@ namespace rtps {
 
 class WriterProxy;
 class RTPSMessageSenderInterface;
+class FragmentReassemblyBudget;
 
 /**
  * Class StatefulReader, specialization of RTPSReader than stores the state of the matched writers.
@@ -357,6 +358,24 @@ private:
             const GUID_t& writerGUID,
             bool is_payload_pool_lost = false);
 
+    /**
+     * Reserve the reassembly memory for a new fragmented change.
+     * @return Whether the change fits in the reassembly limits of the participant and of the writer.
+     * @remarks Non thread-safe.
+     */
+    bool reserve_reassembly_nts(
+            WriterProxy* wp,
+            uint32_t sample_size);
+
+    /**
+     * Release the reassembly memory of a fragmented change that was completed or discarded.
+     * @param wp Writer of the change. May be null when the writer is no longer matched.
+     * @remarks Non thread-safe.
+     */
+    void release_reassembly_nts(
+            WriterProxy* wp,
+            uint32_t sample_size);
+
     //! Acknack Count
     uint32_t acknack_count_;
     //! NACKFRAG Count
@@ -373,6 +392,10 @@ private:
     bool disable_positive_acks_;
     //! False when being destroyed
     bool is_alive_;
+    //! Reassembly budget of the participant. Null when unlimited.
+    FragmentReassemblyBudget* reassembly_budget_ = nullptr;
+    //! Bytes reserved on the reassembly budget for the changes being reassembled
+    uint64_t reassembly_bytes_ = 0;
 };
 
 } /* namespace rtps */
@@ -33,6 +33,8 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+class FragmentReassemblyBudget;
+
 /**
  * Class StatelessReader, specialization of the RTPSReader for Best Effort Readers.
  * @ingroup READER_MODULE
@@ -266,6 +268,8 @@ private:
         GUID_t persistence_guid;
         bool has_manual_topic_liveliness = false;
         CacheChange_t* fragmented_change = nullptr;
+        //! Bytes reserved on the reassembly budget for fragmented_change
+        uint32_t reassembly_bytes = 0;
         bool is_datasharing = false;
         uint32_t ownership_strength;
     };
@@ -290,10 +294,24 @@ private:
             const GUID_t& writerGUID,
             bool is_payload_pool_lost = false);
 
+    /**
+     * Reserve the reassembly memory for a new fragmented change of a writer.
+     * @return Whether the change fits in the reassembly budget of the participant.
+     */
+    bool reserve_reassembly_nts(
+            RemoteWriterInfo_t& writer,
+            uint32_t sample_size);
+
+    //! Release the reassembly memory reserved for the fragmented change of a writer.
+    void release_reassembly_nts(
+            RemoteWriterInfo_t& writer);
+
 
     //!List of GUID_t os matched writers.
     //!Is only used in the Discovery, to correctly notify the user using SubscriptionListener::onSubscriptionMatched();
     ResourceLimitedVector<RemoteWriterInfo_t> matched_writers_;
+    //! Reassembly budget of the participant. Null when unlimited.
+    FragmentReassemblyBudget* reassembly_budget_ = nullptr;
 };
 
 } /* namespace rtps */
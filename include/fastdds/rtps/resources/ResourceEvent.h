@@ -23,6 +23,8 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -42,6 +44,9 @@ class TimedEventImpl;
 
 /**
  * This class centralizes all operations over timed events in the same thread.
+ *
+ * Events are kept on a hashed timing wheel, so scheduling and cancelling them takes constant time.
+ * Other threads hand the events to be updated to the internal thread through a lock-free queue.
  * @ingroup MANAGEMENT_MODULE
  */
 class ResourceEvent
@@ -130,14 +135,17 @@ private:
     //! The total number of created timers.
     size_t timers_count_ = 0;
 
-    //! Collection of events pending update action.
-    std::vector<TimedEventImpl*> pending_timers_;
+    //! Lock-free stack of events pending update action, linked through TimedEventImpl::next_pending_.
+    std::atomic<TimedEventImpl*> pending_timers_{ nullptr };
+
+    //! Slots of the timing wheel. Each slot is a list of events, linked through TimedEventImpl::wheel_next_.
+    std::vector<TimedEventImpl*> timer_wheel_;
 
-    //! Collection of registered events waiting completion.
-    std::vector<TimedEventImpl*> active_timers_;
+    //! Last tick of the timing wheel processed by the execution thread.
+    uint64_t last_tick_ = 0;
 
-    //! Prevents iterator invalidation when active_timers are manipulated inside loops
-    std::atomic<bool> skip_checking_active_timers_;
+    //! Collection of events being triggered by the execution thread.
+    std::vector<TimedEventImpl*> due_timers_;
 
     //! Current time as seen by the execution thread.
     std::chrono::steady_clock::time_point current_time_;
@@ -146,19 +154,27 @@ private:
     std::unique_ptr<eprosima::thread> thread_;
 
     /*!
-     * @brief Registers a new TimedEventImpl object in the internal queue to be processed.
-     * Non thread safe.
+     * @brief Adds a TimedEventImpl object to the queue of events pending update action, unless it is already there.
+     * Lock-free.
      * @param event Event to be added in the queue.
-     * @return True value if the insertion was successful. In other case, it return False.
+     * @return True value if the queue was empty, and the internal thread should be notified.
      */
-    bool register_timer_nts(
+    bool push_pending_timer(
+            TimedEventImpl* event);
+
+    //! Adds an event to the timing wheel, or to the collection of due events when its trigger time has been reached.
+    void schedule_timer(
+            TimedEventImpl* event);
+
+    //! Removes an event from the timing wheel.
+    void unschedule_timer(
             TimedEventImpl* event);
 
     //! Method called by the internal thread.
     void event_service();
 
-    //! Sorts waiting timers in ascending order of trigger time.
-    void sort_timers();
+    //! Returns the next time the internal thread should wake up to trigger the events on the timing wheel.
+    std::chrono::steady_clock::time_point next_wheel_time() const;
 
     //! Updates internal register of current time.
     void update_current_time();
@@ -169,8 +185,7 @@ private:
     //! Ensures internal collections can accommodate current total number of timers.
     void resize_collections()
     {
-        pending_timers_.reserve(timers_count_);
-        active_timers_.reserve(timers_count_);
+        due_timers_.reserve(timers_count_);
     }
 
 };
@@ -31,6 +31,9 @@ namespace rtps {
  * immediately if the buffer is full, but no error will be returned to the upper layer. This means that the
  * application will behave as if the datagram is sent and lost.
  *
+ * - \c input_sockets_per_locator: number of sockets, each one with its own reception thread, opened on each
+ * unicast input locator (Linux only).
+ *
  * @ingroup TRANSPORT_MODULE
  */
 struct UDPTransportDescriptor : public SocketTransportDescriptor
@@ -68,6 +71,17 @@ struct UDPTransportDescriptor : public SocketTransportDescriptor
      * datagram. This may hinder performance on high-frequency writers.
      */
     bool non_blocking_send = false;
+
+    /**
+     * Number of sockets opened on each unicast input locator.
+     *
+     * When greater than 1, the sockets are bound with SO_REUSEPORT, each one served by its own reception thread, and
+     * datagrams are steered to them by a hash of the sender's GUID prefix, so the messages of a remote participant
+     * are always received in order by the same thread. Only supported on Linux; ignored on other platforms.
+     * The port is still exclusive: opening it fails when it is already bound by any other socket, including the
+     * sockets of other transports enabling this option.
+     */
+    uint32_t input_sockets_per_locator = 1;
 };
 
 } // namespace rtps
@@ -140,33 +140,53 @@ public:
         }
     }
 
+    /**
+     * Mark the fragments requested by a NACK_FRAG to be sent again.
+     * @param unsentFragments Requested fragments.
+     * @param max_unsent Maximum number of fragments pending to be sent again. Requested fragments over the limit,
+     * which are the highest ones, are ignored and will be requested again by the reader. 0 means no limit.
+     */
     void markFragmentsAsUnsent(
-            const FragmentNumberSet_t& unsentFragments)
+            const FragmentNumberSet_t& unsentFragments,
+            uint32_t max_unsent = 0)
     {
         // Ignore NACK_FRAG messages during the first stage, until all fragments have been delivered once, and we
         // consider the whole change as delivered.
         if (delivered_)
         {
+            uint32_t pending = 0;
             if (unsent_fragments_.empty())
             {
                 // Current window is empty, so we can set it to the received one.
-                unsent_fragments_ = unsentFragments;
+                unsent_fragments_.base(unsentFragments.base());
             }
             else
             {
+                unsent_fragments_.for_each(
+                    [&pending](
+                        FragmentNumber_t)
+                    {
+                        ++pending;
+                    });
+
                 // Update window to send the lowest possible requested fragments first.
                 FragmentNumber_t other_base = unsentFragments.base();
                 if (other_base < unsent_fragments_.base())
                 {
                     unsent_fragments_.base_update(other_base);
                 }
-                unsentFragments.for_each(
-                    [this](
-                        FragmentNumber_t element)
-                    {
-                        unsent_fragments_.add(element);
-                    });
             }
+
+            unsentFragments.for_each(
+                [this, &pending, max_unsent](
+                    FragmentNumber_t element)
+                {
+                    if ((0 == max_unsent || pending < max_unsent) && !unsent_fragments_.is_set(element) &&
+                    unsent_fragments_.add(element))
+                    {
+                        ++pending;
+                    }
+                });
         }
     }
 
@@ -23,7 +23,11 @@
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 #include <fastrtps/utils/shared_mutex.hpp>
 
+#include <array>
+#include <limits>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -38,7 +42,11 @@ using LivelinessCallback = std::function<void (
 
 /**
  * @brief A class managing the liveliness of a set of writers. Writers are represented by their LivelinessData
- * @details Uses a shared timed event and informs outside classes on liveliness changes
+ * @details Uses a shared timed event and informs outside classes on liveliness changes.
+ * Writers are indexed by GUID and by liveliness kind, so asserting the liveliness of a writer does not depend on the
+ * number of writers being managed. The timer owner is only recalculated when a writer becomes alive earlier than it,
+ * when it is removed, or when the timer expires, so assertions of writers which are already alive never touch the
+ * timer.
  * @ingroup WRITER_MODULE
  */
 class LivelinessManager
@@ -133,21 +141,46 @@ public:
 
 private:
 
+    //! Position used when a writer is not in the set
+    static constexpr size_t no_position = (std::numeric_limits<size_t>::max)();
+
+    /**
+     * @brief Looks for a writer in the set
+     * @pre mutex_ must be taken
+     * @return The position of the writer in writers_, or no_position if the writer is not in the set
+     */
+    size_t find_writer_nts(
+            const GUID_t& guid,
+            LivelinessQosPolicyKind kind,
+            const Duration_t& lease_duration) const;
+
+    /**
+     * @brief Removes the writer at the given position, moving the last writer of the set to its place
+     * @pre The collection shared_mutex must be taken for writing and mutex_ must be taken
+     */
+    void remove_writer_nts(
+            size_t position);
+
     /**
      * @brief A method responsible for invoking the callback when liveliness is asserted
-     * @param writer The liveliness data of the writer asserting liveliness
+     * @param position The position in writers_ of the writer asserting liveliness
      * @pre The collection shared_mutex must be taken for reading
      */
     void assert_writer_liveliness(
-            LivelinessData& writer);
+            size_t position);
 
     /**
      * @brief A method to calculate the time when the next writer is going to lose liveliness
-     * @details This method is public for testing purposes but it should not be used from outside this class
-     * @pre std::mutex_ should not be taken on calling this method to avoid deadlock.
+     * @pre mutex_ must be taken
      * @return True if at least one writer is alive
      */
-    bool calculate_next();
+    bool calculate_next_nts();
+
+    /**
+     * @brief Schedules the timer to expire when the timer owner is due to lose its liveliness
+     * @pre mutex_ must be taken and there must be a timer owner
+     */
+    void schedule_timer_nts();
 
     //! @brief A method called if the timer expires
     //! @return True if the timer should be restarted
@@ -162,14 +195,27 @@ private:
     //! A vector of liveliness data
     ResourceLimitedVector<LivelinessData> writers_;
 
+    //! Positions in writers_ of the writers with each GUID
+    std::unordered_multimap<GUID_t, size_t> writer_positions_;
+
+    //! Positions in writers_ of the writers with each liveliness kind
+    std::array<std::vector<size_t>, 3> kind_positions_;
+
+    //! Number of alive writers with each liveliness kind
+    std::array<uint32_t, 3> alive_writers_;
+
     //! A mutex to protect the liveliness data included LivelinessData objects
     std::mutex mutex_;
 
     //! A mutex devoted to protect the writers_ collection
     eprosima::shared_mutex col_mutex_;
 
-    //! The timer owner, i.e. the writer which is next due to lose its liveliness
-    LivelinessData* timer_owner_;
+    //! Position in writers_ of the timer owner, i.e. the writer which was next due to lose its liveliness when the
+    //! timer was scheduled. Equal to no_position when there is no timer owner.
+    size_t timer_owner_;
+
+    //! The time when the timer owner was due to lose its liveliness when the timer was scheduled
+    std::chrono::steady_clock::time_point timer_time_;
 
     //! A timed callback expiring when a writer (the timer owner) loses its liveliness
     TimedEvent timer_;
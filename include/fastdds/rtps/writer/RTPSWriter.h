@@ -518,6 +518,36 @@ public:
 
     virtual LocatorSelectorSender& get_async_locator_selector() = 0;
 
+    /**
+     * Start a batch of new samples.
+     * Until end_sample_batch_nts() is called, the samples delivered synchronously by the flow controller are added to
+     * the same RTPS message group, so they are sent with as few datagrams as possible.
+     * It has no effect when the flow controller delivers the samples asynchronously, or when a batch is already open.
+     *
+     * @param max_blocking_time Future timepoint where blocking send should end.
+     * @note Must be called with the writer's mutex taken, which should not be released until the batch ends.
+     */
+    void begin_sample_batch_nts(
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
+    /**
+     * End the current batch of new samples, sending the pending submessages.
+     * Writers call it before waiting for their samples to be delivered, as the samples in the batch cannot be sent
+     * until it ends.
+     *
+     * @note Must be called with the writer's mutex taken.
+     */
+    void end_sample_batch_nts();
+
+    /**
+     * @return The message group of the current batch of new samples, or nullptr when there is no batch open.
+     * @note Must be called with the writer's mutex taken.
+     */
+    RTPSMessageGroup* sample_batch_group_nts() const
+    {
+        return sample_batch_group_;
+    }
+
     /**
      * Send a message through this interface.
      *
@@ -540,6 +570,8 @@ protected:
     fastdds::rtps::FlowController* flow_controller_;
     //! Maximum number of bytes allowed for an RTPS datagram generated by this writer.
     uint32_t max_output_message_size_ = std::numeric_limits<uint32_t>::max();
+    //! Message group shared by the samples of the current batch, if any.
+    RTPSMessageGroup* sample_batch_group_ = nullptr;
 
     //!WriterHistory
     WriterHistory* mp_history = nullptr;
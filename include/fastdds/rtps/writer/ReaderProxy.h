@@ -325,13 +325,16 @@ public:
      * @param nack_count Counter field of the submessage.
      * @param seq_num Sequence number field of the submessage.
      * @param fragments_state Bitmap indicating the requested fragments.
+     * @param max_repair_fragments Maximum number of fragments of the change pending to be sent again.
+     * 0 means no limit.
      * @return true if a change was modified, false otherwise.
      */
     bool process_nack_frag(
             const GUID_t& reader_guid,
             uint32_t nack_count,
             const SequenceNumber_t& seq_num,
-            const FragmentNumberSet_t& fragments_state);
+            const FragmentNumberSet_t& fragments_state,
+            uint32_t max_repair_fragments = 0);
 
     /**
      * Filter a CacheChange_t using the StatefulWriter's IReaderDataFilter.
@@ -475,11 +478,14 @@ private:
      * @brief Adds requested fragments. These fragments will be sent in next NackResponseDelay.
      * @param[in] seq_num Sequence number to be paired with the requested fragments.
      * @param[in] frag_set set containing the requested fragments to be sent.
+     * @param[in] max_repair_fragments Maximum number of fragments of the change pending to be sent again.
+     * 0 means no limit.
      * @return True if there is at least one requested fragment. False in other case.
      */
     bool requested_fragment_set(
             const SequenceNumber_t& seq_num,
-            const FragmentNumberSet_t& frag_set);
+            const FragmentNumberSet_t& frag_set,
+            uint32_t max_repair_fragments);
 
     void add_change(
             const ChangeForReader_t& change,
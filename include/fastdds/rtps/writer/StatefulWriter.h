@@ -521,6 +521,8 @@ private:
     SequenceNumber_t last_sequence_number_;
     //! Biggest sequence number removed from history
     SequenceNumber_t biggest_removed_sequence_number_;
+    //! Maximum number of fragments of a change pending to be resent to each reader. 0 means no limit.
+    uint32_t max_repair_fragments_ = 0;
 
     const uint32_t sendBufferSize_;
 
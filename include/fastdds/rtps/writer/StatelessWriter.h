@@ -165,6 +165,13 @@ public:
     //!Reset the unsent changes.
     void unsent_changes_reset();
 
+    /**
+     * Send a HEARTBEAT with the sequence numbers on the history to all the remote readers and fixed locators,
+     * without sending any change.
+     * @return True when the HEARTBEAT was sent.
+     */
+    bool send_heartbeat();
+
     /**
      * @brief Check if a specific change has been delivered to the transport layer at least once for every matched
      * remote RTPSReader.
@@ -283,6 +290,8 @@ private:
 
     uint64_t last_sequence_number_sent_ = 0;
 
+    Count_t heartbeat_count_ = 0;
+
     ResourceLimitedVector<std::unique_ptr<ReaderLocator>> matched_local_readers_;
     ResourceLimitedVector<std::unique_ptr<ReaderLocator>> matched_datasharing_readers_;
     ResourceLimitedVector<std::unique_ptr<ReaderLocator>> matched_readers_pool_;
@@ -0,0 +1,555 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RingVector.hpp
+ *
+ */
+
+#ifndef FASTRTPS_UTILS_COLLECTIONS_RINGVECTOR_HPP_
+#define FASTRTPS_UTILS_COLLECTIONS_RINGVECTOR_HPP_
+
+#include <assert.h>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * Sequence container with the interface and iterator invalidation rules of std::vector, stored on a circular
+ * buffer.
+ *
+ * Appending an element and removing the first one are constant time operations, so it is suited for collections
+ * used as FIFO queues where some elements are inserted or removed from the middle from time to time.
+ *
+ * As with std::vector, inserting or erasing an element invalidates the iterators to that element and all the ones
+ * after it, while the iterators before it remain valid. Growing the capacity invalidates all the iterators.
+ *
+ * @tparam _Ty  Element type.
+ *
+ * @ingroup UTILITIES_MODULE
+ */
+template <typename _Ty>
+class RingVector
+{
+    template<bool _IsConst>
+    class base_iterator;
+
+public:
+
+    using value_type = _Ty;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+    using iterator = base_iterator<false>;
+    using const_iterator = base_iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    RingVector() = default;
+
+    size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    bool empty() const noexcept
+    {
+        return 0 == size_;
+    }
+
+    size_type capacity() const noexcept
+    {
+        return buffer_.size();
+    }
+
+    /**
+     * Ensure the collection can hold a number of elements without growing.
+     *
+     * @param new_capacity Number of elements.
+     */
+    void reserve(
+            size_type new_capacity)
+    {
+        if (new_capacity > capacity())
+        {
+            size_type rounded = capacity() == 0 ? 1u : capacity();
+            while (rounded < new_capacity)
+            {
+                rounded *= 2u;
+            }
+            reallocate(rounded);
+        }
+    }
+
+    void clear() noexcept
+    {
+        while (size_ > 0)
+        {
+            pop_back();
+        }
+        head_ = 0;
+    }
+
+    reference operator [](
+            size_type pos)
+    {
+        assert(pos < size_);
+        return buffer_[physical(pos)];
+    }
+
+    const_reference operator [](
+            size_type pos) const
+    {
+        assert(pos < size_);
+        return buffer_[physical(pos)];
+    }
+
+    reference at(
+            size_type pos)
+    {
+        if (pos >= size_)
+        {
+            throw std::out_of_range("RingVector::at");
+        }
+        return buffer_[physical(pos)];
+    }
+
+    const_reference at(
+            size_type pos) const
+    {
+        if (pos >= size_)
+        {
+            throw std::out_of_range("RingVector::at");
+        }
+        return buffer_[physical(pos)];
+    }
+
+    reference front()
+    {
+        return (*this)[0];
+    }
+
+    const_reference front() const
+    {
+        return (*this)[0];
+    }
+
+    reference back()
+    {
+        return (*this)[size_ - 1];
+    }
+
+    const_reference back() const
+    {
+        return (*this)[size_ - 1];
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator(this, 0);
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+
+    iterator end() noexcept
+    {
+        return iterator(this, size_);
+    }
+
+    const_iterator end() const noexcept
+    {
+        return const_iterator(this, size_);
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(this, size_);
+    }
+
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    void push_back(
+            const value_type& value)
+    {
+        grow_if_full();
+        buffer_[physical(size_)] = value;
+        ++size_;
+    }
+
+    void pop_front()
+    {
+        assert(size_ > 0);
+        buffer_[head_] = value_type();
+        head_ = physical(1);
+        --size_;
+    }
+
+    void pop_back()
+    {
+        assert(size_ > 0);
+        --size_;
+        buffer_[physical(size_)] = value_type();
+    }
+
+    /**
+     * Insert an element before the given position.
+     * Inserting at the beginning is a constant time operation. Otherwise the elements after the position are moved.
+     *
+     * @param pos Position before which the element is inserted.
+     * @param value Element to insert.
+     * @return Iterator pointing to the inserted element.
+     */
+    iterator insert(
+            const_iterator pos,
+            const value_type& value)
+    {
+        size_type index = pos.index_;
+        assert(index <= size_);
+
+        grow_if_full();
+        if (0 == index)
+        {
+            // All the iterators are invalidated anyway, so the element can be placed before the current head
+            head_ = physical(capacity() - 1);
+        }
+        else
+        {
+            for (size_type i = size_; i > index; --i)
+            {
+                buffer_[physical(i)] = std::move(buffer_[physical(i - 1)]);
+            }
+        }
+        buffer_[physical(index)] = value;
+        ++size_;
+        return iterator(this, index);
+    }
+
+    /**
+     * Remove the element at the given position.
+     * Removing the first element is a constant time operation. Otherwise the elements after the position are moved.
+     *
+     * @param pos Position of the element to remove.
+     * @return Iterator following the removed element.
+     */
+    iterator erase(
+            const_iterator pos)
+    {
+        size_type index = pos.index_;
+        assert(index < size_);
+
+        if (0 == index)
+        {
+            pop_front();
+        }
+        else
+        {
+            for (size_type i = index + 1; i < size_; ++i)
+            {
+                buffer_[physical(i - 1)] = std::move(buffer_[physical(i)]);
+            }
+            pop_back();
+        }
+        return iterator(this, index);
+    }
+
+    /**
+     * Remove the elements on a range.
+     * Removing from the beginning takes a time proportional to the number of elements removed. Otherwise the
+     * elements after the range are moved.
+     *
+     * @param first Position of the first element to remove.
+     * @param last Position following the last element to remove.
+     * @return Iterator following the last removed element.
+     */
+    iterator erase(
+            const_iterator first,
+            const_iterator last)
+    {
+        size_type index = first.index_;
+        size_type count = last.index_ - index;
+        assert(index + count <= size_);
+
+        if (0 == index)
+        {
+            for (; count > 0; --count)
+            {
+                pop_front();
+            }
+        }
+        else if (count > 0)
+        {
+            for (size_type i = index + count; i < size_; ++i)
+            {
+                buffer_[physical(i - count)] = std::move(buffer_[physical(i)]);
+            }
+            for (; count > 0; --count)
+            {
+                pop_back();
+            }
+        }
+        return iterator(this, index);
+    }
+
+private:
+
+    template<bool _IsConst>
+    class base_iterator
+    {
+        using container_type = typename std::conditional<_IsConst, const RingVector, RingVector>::type;
+
+        friend class RingVector;
+        friend class base_iterator<!_IsConst>;
+
+    public:
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = _Ty;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<_IsConst, const _Ty*, _Ty*>::type;
+        using reference = typename std::conditional<_IsConst, const _Ty&, _Ty&>::type;
+
+        base_iterator() = default;
+
+        base_iterator(
+                container_type* container,
+                size_type index)
+            : container_(container)
+            , index_(index)
+        {
+        }
+
+        //! Conversion from iterator to const_iterator.
+        template<bool _OtherConst, typename = typename std::enable_if<_IsConst && !_OtherConst>::type>
+        base_iterator(
+                const base_iterator<_OtherConst>& other)
+            : container_(other.container_)
+            , index_(other.index_)
+        {
+        }
+
+        reference operator *() const
+        {
+            return (*container_)[index_];
+        }
+
+        pointer operator ->() const
+        {
+            return &(*container_)[index_];
+        }
+
+        reference operator [](
+                difference_type n) const
+        {
+            return (*container_)[index_ + n];
+        }
+
+        base_iterator& operator ++()
+        {
+            ++index_;
+            return *this;
+        }
+
+        base_iterator operator ++(
+                int)
+        {
+            base_iterator tmp(*this);
+            ++index_;
+            return tmp;
+        }
+
+        base_iterator& operator --()
+        {
+            --index_;
+            return *this;
+        }
+
+        base_iterator operator --(
+                int)
+        {
+            base_iterator tmp(*this);
+            --index_;
+            return tmp;
+        }
+
+        base_iterator& operator +=(
+                difference_type n)
+        {
+            index_ += n;
+            return *this;
+        }
+
+        base_iterator& operator -=(
+                difference_type n)
+        {
+            index_ -= n;
+            return *this;
+        }
+
+        friend base_iterator operator +(
+                base_iterator it,
+                difference_type n)
+        {
+            return it += n;
+        }
+
+        friend base_iterator operator +(
+                difference_type n,
+                base_iterator it)
+        {
+            return it += n;
+        }
+
+        friend base_iterator operator -(
+                base_iterator it,
+                difference_type n)
+        {
+            return it -= n;
+        }
+
+        friend difference_type operator -(
+                const base_iterator& lhs,
+                const base_iterator& rhs)
+        {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator ==(
+                const base_iterator& lhs,
+                const base_iterator& rhs)
+        {
+            return lhs.index_ == rhs.index_ && lhs.container_ == rhs.container_;
+        }
+
+        friend bool operator !=(
+                const base_iterator& lhs,
+                const base_iterator& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator <(
+                const base_iterator& lhs,
+                const base_iterator& rhs)
+        {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator >(
+                const base_iterator& lhs,
+                const base_iterator& rhs)
+        {
+            return lhs.index_ > rhs.index_;
+        }
+
+        friend bool operator <=(
+                const base_iterator& lhs,
+                const base_iterator& rhs)
+        {
+            return lhs.index_ <= rhs.index_;
+        }
+
+        friend bool operator >=(
+                const base_iterator& lhs,
+                const base_iterator& rhs)
+        {
+            return lhs.index_ >= rhs.index_;
+        }
+
+    private:
+
+        container_type* container_ = nullptr;
+        size_type index_ = 0;
+    };
+
+    //! Position on the buffer of the element at a logical position. Capacity is always a power of two.
+    size_type physical(
+            size_type pos) const
+    {
+        return (head_ + pos) & (buffer_.size() - 1);
+    }
+
+    void grow_if_full()
+    {
+        if (size_ == capacity())
+        {
+            reallocate(capacity() == 0 ? 1u : capacity() * 2u);
+        }
+    }
+
+    void reallocate(
+            size_type new_capacity)
+    {
+        std::vector<_Ty> new_buffer(new_capacity);
+        for (size_type i = 0; i < size_; ++i)
+        {
+            new_buffer[i] = std::move(buffer_[physical(i)]);
+        }
+        buffer_.swap(new_buffer);
+        head_ = 0;
+    }
+
+    std::vector<_Ty> buffer_;
+    size_type head_ = 0;
+    size_type size_ = 0;
+};
+
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif /* FASTRTPS_UTILS_COLLECTIONS_RINGVECTOR_HPP_ */
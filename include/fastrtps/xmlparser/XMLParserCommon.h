@@ -60,6 +60,7 @@ extern const char* RECEIVE_BUFFER_SIZE;
 extern const char* SEND_BUFFER_SIZE;
 extern const char* TTL;
 extern const char* NON_BLOCKING_SEND;
+extern const char* INPUT_SOCKETS_PER_LOCATOR;
 extern const char* WHITE_LIST;
 extern const char* NETWORK_INTERFACE;
 extern const char* NETMASK_FILTER;
@@ -196,6 +197,7 @@ extern const char* PREALLOCATED;
 extern const char* PREALLOCATED_WITH_REALLOC;
 extern const char* DYNAMIC;
 extern const char* DYNAMIC_REUSABLE;
+extern const char* DYNAMIC_SIZE_CLASS;
 extern const char* LOCATOR;
 extern const char* UDPv4_LOCATOR;
 extern const char* UDPv6_LOCATOR;
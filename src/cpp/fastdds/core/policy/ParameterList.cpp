@@ -21,6 +21,7 @@
 
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
 #include <fastdds/rtps/common/VendorId_t.hpp>
+#include <utils/hash.hpp>
 
 #include "ParameterList.hpp"
 #include "ParameterSerializer.hpp"
@@ -133,6 +134,14 @@ bool ParameterList::updateCacheChangeFromInlineQos(
     return readParameterListfromCDRMsg(*msg, parameter_process, false, qos_size);
 }
 
+uint64_t ParameterList::payload_hash(
+        const fastrtps::rtps::SerializedPayload_t& payload)
+{
+    // The whole payload is hashed, as it starts with the encapsulation
+    uint64_t hash = fastrtps::rtps::fnv1a_64(payload.data, payload.length);
+    return (0 == hash) ? 1 : hash;
+}
+
 bool ParameterList::read_guid_from_cdr_msg(
         fastrtps::rtps::CDRMessage_t& msg,
         uint16_t search_pid,
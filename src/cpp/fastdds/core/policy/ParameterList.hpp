@@ -139,6 +139,14 @@ public:
         return true;
     }
 
+    /**
+     * Compute a hash of a serialized parameter list, used to detect unchanged discovery data without parsing it.
+     * @param[in] payload Serialized payload with the parameter list, including its encapsulation.
+     * @return Hash of the payload. Never 0, which is reserved to mean that the hash is unknown.
+     */
+    static uint64_t payload_hash(
+            const fastrtps::rtps::SerializedPayload_t& payload);
+
     /**
      * Read guid from the KEY_HASH or another specific PID parameter of a CDRMessage
      * @param[in,out] msg Reference to the message (pos should be correct, otherwise the behaviour is undefined).
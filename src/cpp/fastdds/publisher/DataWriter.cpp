@@ -117,6 +117,20 @@ ReturnCode_t DataWriter::write_w_timestamp(
     return ReturnCode_t::RETCODE_UNSUPPORTED;
 }
 
+ReturnCode_t DataWriter::write_many(
+        const std::vector<void*>& samples,
+        fastrtps::rtps::WriteParams& params)
+{
+    return impl_->write_many(samples, params);
+}
+
+ReturnCode_t DataWriter::write_many(
+        const std::vector<void*>& samples)
+{
+    fastrtps::rtps::WriteParams params;
+    return impl_->write_many(samples, params);
+}
+
 InstanceHandle_t DataWriter::register_instance(
         void* instance)
 {
@@ -81,6 +81,13 @@ DataWriterHistory::DataWriterHistory(
     {
         resource_limited_qos_.max_samples_per_instance = std::numeric_limits<int32_t>::max();
     }
+
+    if (topic_att_.getTopicKind() == WITH_KEY &&
+            resource_limited_qos_.max_instances < std::numeric_limits<int32_t>::max())
+    {
+        // Avoid rehashing the instance map while the history is being filled
+        keyed_changes_.reserve(static_cast<size_t>(resource_limited_qos_.max_instances));
+    }
 }
 
 DataWriterHistory::~DataWriterHistory()
@@ -21,6 +21,7 @@
 
 #include <chrono>
 #include <mutex>
+#include <unordered_map>
 
 #include <fastdds/rtps/common/InstanceHandle.h>
 #include <fastdds/rtps/common/Time_t.h>
@@ -30,6 +31,7 @@
 #include <fastrtps/qos/QosPolicies.h>
 
 #include <fastdds/publisher/history/DataWriterInstance.hpp>
+#include <utils/hash.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -237,9 +239,10 @@ public:
 
 private:
 
-    typedef std::map<fastrtps::rtps::InstanceHandle_t, detail::DataWriterInstance> t_m_Inst_Caches;
+    typedef std::unordered_map<fastrtps::rtps::InstanceHandle_t, detail::DataWriterInstance,
+            fastrtps::rtps::InstanceHandleHash> t_m_Inst_Caches;
 
-    //!Map where keys are instance handles and values are vectors of cache changes associated
+    //!Hash map where keys are instance handles and values are vectors of cache changes associated
     t_m_Inst_Caches keyed_changes_;
     //!Time point when the next deadline will occur (only used for topics with no key)
     std::chrono::steady_clock::time_point next_deadline_us_;
@@ -20,6 +20,8 @@
 
 #include <functional>
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
 
 #include <fastdds/core/condition/StatusConditionImpl.hpp>
 #include <fastdds/core/policy/ParameterSerializer.hpp>
@@ -296,6 +298,7 @@ ReturnCode_t DataWriterImpl::enable()
         w_att.keep_duration = qos_.reliable_writer_qos().disable_positive_acks.duration;
     }
 
+    read_datasharing_size_classes();
     ReturnCode_t ret_code = check_datasharing_compatible(w_att, is_data_sharing_compatible_);
     if (ret_code != ReturnCode_t::RETCODE_OK)
     {
@@ -393,6 +396,8 @@ ReturnCode_t DataWriterImpl::enable()
         writer_->reader_data_filter(this);
     }
 
+    create_parallel_serializer();
+
     // In case it has been loaded from the persistence DB, rebuild instances on history
     history_.rebuild_instances();
 
@@ -441,6 +446,84 @@ ReturnCode_t DataWriterImpl::enable()
     return ReturnCode_t::RETCODE_OK;
 }
 
+void DataWriterImpl::create_parallel_serializer()
+{
+    const std::string* threads_property =
+            PropertyPolicyHelper::find_property(qos_.properties(), "fastdds.parallel_serialization.threads");
+    if (nullptr == threads_property)
+    {
+        return;
+    }
+
+    uint32_t num_threads = 0;
+    try
+    {
+        num_threads = static_cast<uint32_t>(std::stoul(*threads_property));
+
+        const std::string* min_size_property =
+                PropertyPolicyHelper::find_property(qos_.properties(), "fastdds.parallel_serialization.min_size");
+        if (nullptr != min_size_property)
+        {
+            parallel_serialization_min_size_ = static_cast<uint32_t>(std::stoul(*min_size_property));
+        }
+    }
+    catch (const std::exception&)
+    {
+        EPROSIMA_LOG_ERROR(DATA_WRITER, "Wrong value on the parallel serialization properties");
+        return;
+    }
+
+    if (0 < num_threads)
+    {
+        // Workers are part of the sending pipeline, so they share the settings of the flow controller threads
+        serializer_.reset(new ParallelSerializer(num_threads,
+                publisher_->get_participant()->get_qos().builtin_controllers_sender_thread(),
+                guid().entityId.to_uint32()));
+    }
+}
+
+void DataWriterImpl::read_datasharing_size_classes()
+{
+    datasharing_size_classes_.clear();
+
+    const std::string* size_classes_property =
+            PropertyPolicyHelper::find_property(qos_.properties(), "fastdds.datasharing.size_classes");
+    if (nullptr == size_classes_property)
+    {
+        return;
+    }
+
+    // Format is 'size:count[,size:count...]'
+    std::istringstream stream(*size_classes_property);
+    std::string item;
+    try
+    {
+        while (std::getline(stream, item, ','))
+        {
+            size_t separator = item.find(':');
+            if (std::string::npos == separator)
+            {
+                throw std::invalid_argument(item);
+            }
+
+            DataSharingPayloadPool::SizeClass size_class;
+            size_class.payload_size = static_cast<uint32_t>(std::stoul(item.substr(0, separator)));
+            size_class.count = static_cast<uint32_t>(std::stoul(item.substr(separator + 1)));
+            if (0 == size_class.payload_size || 0 == size_class.count)
+            {
+                throw std::invalid_argument(item);
+            }
+            datasharing_size_classes_.push_back(size_class);
+        }
+    }
+    catch (const std::exception&)
+    {
+        EPROSIMA_LOG_ERROR(DATA_WRITER, "Wrong value on the data sharing size classes property: " <<
+                *size_classes_property);
+        datasharing_size_classes_.clear();
+    }
+}
+
 void DataWriterImpl::disable()
 {
     set_listener(nullptr);
@@ -695,6 +778,150 @@ ReturnCode_t DataWriterImpl::write_w_timestamp(
     return ret;
 }
 
+ReturnCode_t DataWriterImpl::write_many(
+        const std::vector<void*>& samples,
+        WriteParams& params)
+{
+    if (writer_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    for (void* data : samples)
+    {
+        ReturnCode_t ret_code = check_new_change_preconditions(ALIVE, data);
+        if (!ret_code)
+        {
+            return ret_code;
+        }
+    }
+
+    if (samples.empty())
+    {
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    EPROSIMA_LOG_INFO(DATA_WRITER, "Writing a batch of " << samples.size() << " samples");
+
+    // Block lowlevel writer
+    auto max_blocking_time = steady_clock::now() +
+            microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
+
+#if HAVE_STRICT_REALTIME
+    std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex(), std::defer_lock);
+    if (!lock.try_lock_until(max_blocking_time))
+    {
+        return ReturnCode_t::RETCODE_TIMEOUT;
+    }
+#else
+    std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex());
+#endif // if HAVE_STRICT_REALTIME
+
+    bool is_key_protected = false;
+#if HAVE_SECURITY
+    is_key_protected = writer_->getAttributes().security_attributes().is_key_protected;
+#endif // if HAVE_SECURITY
+
+    // Get the payloads of all the samples. Loaned samples are already serialized.
+    bool use_serializer = false;
+    batch_samples_.resize(samples.size());
+    for (size_t i = 0; i < samples.size(); ++i)
+    {
+        BatchSample& sample = batch_samples_[i];
+        sample.handle = InstanceHandle_t();
+        if (type_->m_isGetKeyDefined)
+        {
+            type_->getKey(samples[i], &sample.handle, is_key_protected);
+        }
+
+        sample.was_loaned = check_and_remove_loan(samples[i], sample.payload);
+        if (!sample.was_loaned)
+        {
+            if (!get_free_payload_from_pool(type_->getSerializedSizeProvider(samples[i]), sample.payload))
+            {
+                for (size_t j = 0; j < i; ++j)
+                {
+                    discard_payload(samples[j], batch_samples_[j].payload, batch_samples_[j].was_loaned);
+                }
+                batch_samples_.clear();
+                return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
+            }
+            use_serializer |= sample.payload.payload.max_size >= parallel_serialization_min_size_;
+        }
+    }
+
+    auto serialize_sample = [this, &samples](size_t index) -> bool
+            {
+                BatchSample& sample = batch_samples_[index];
+                return sample.was_loaned ||
+                       type_->serialize(samples[index], &sample.payload.payload, data_representation_);
+            };
+
+    use_serializer = use_serializer && serializer_ && samples.size() > 1;
+    if (use_serializer)
+    {
+        // Samples are added to the history as soon as they are serialized, while the workers go on with the
+        // following ones
+        serializer_->start(samples.size(), serialize_sample);
+    }
+    else
+    {
+        // Serialize all the samples before adding any of them, so nothing is written when one of them fails
+        for (size_t i = 0; i < samples.size(); ++i)
+        {
+            if (!serialize_sample(i))
+            {
+                EPROSIMA_LOG_WARNING(DATA_WRITER, "Data serialization returned false");
+                for (size_t j = 0; j < samples.size(); ++j)
+                {
+                    discard_payload(samples[j], batch_samples_[j].payload, batch_samples_[j].was_loaned);
+                }
+                batch_samples_.clear();
+                return ReturnCode_t::RETCODE_ERROR;
+            }
+        }
+    }
+
+    // Samples sent synchronously are grouped on the same RTPS messages
+    ReturnCode_t ret_code = ReturnCode_t::RETCODE_OK;
+    WriteParams wparams;
+    for (size_t i = 0; i < samples.size(); ++i)
+    {
+        BatchSample& sample = batch_samples_[i];
+        if (ReturnCode_t::RETCODE_OK == ret_code && use_serializer && !serializer_->wait(i))
+        {
+            EPROSIMA_LOG_WARNING(DATA_WRITER, "Data serialization returned false");
+            ret_code = ReturnCode_t::RETCODE_ERROR;
+        }
+
+        if (!ret_code)
+        {
+            if (use_serializer)
+            {
+                // Payloads cannot be discarded while the workers may be serializing on them
+                serializer_->finish();
+            }
+            discard_payload(samples[i], sample.payload, sample.was_loaned);
+            continue;
+        }
+
+        // The batch is closed by the writer when it needs to wait for room in the history
+        writer_->begin_sample_batch_nts(max_blocking_time);
+        wparams = params;
+        ret_code = add_change_to_history(ALIVE, samples[i], sample.payload, sample.was_loaned, wparams,
+                        sample.handle, lock, max_blocking_time);
+    }
+    writer_->end_sample_batch_nts();
+    if (use_serializer)
+    {
+        serializer_->finish();
+    }
+    batch_samples_.clear();
+
+    params = wparams;
+    return ret_code;
+}
+
 ReturnCode_t DataWriterImpl::check_instance_preconditions(
         void* data,
         const InstanceHandle_t& handle,
@@ -975,7 +1202,23 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
 #endif // if HAVE_STRICT_REALTIME
 
     PayloadInfo_t payload;
-    bool was_loaned = check_and_remove_loan(data, payload);
+    bool was_loaned = false;
+    ReturnCode_t ret_code = prepare_payload(change_kind, data, payload, was_loaned);
+    if (!ret_code)
+    {
+        return ret_code;
+    }
+
+    return add_change_to_history(change_kind, data, payload, was_loaned, wparams, handle, lock, max_blocking_time);
+}
+
+ReturnCode_t DataWriterImpl::prepare_payload(
+        ChangeKind_t change_kind,
+        void* data,
+        PayloadInfo_t& payload,
+        bool& was_loaned)
+{
+    was_loaned = check_and_remove_loan(data, payload);
     if (!was_loaned)
     {
         if (!get_free_payload_from_pool(type_->getSerializedSizeProvider(data), payload))
@@ -991,6 +1234,34 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
         }
     }
 
+    return ReturnCode_t::RETCODE_OK;
+}
+
+void DataWriterImpl::discard_payload(
+        void* data,
+        PayloadInfo_t& payload,
+        bool was_loaned)
+{
+    if (was_loaned)
+    {
+        add_loan(data, payload);
+    }
+    else
+    {
+        return_payload_to_pool(payload);
+    }
+}
+
+ReturnCode_t DataWriterImpl::add_change_to_history(
+        ChangeKind_t change_kind,
+        void* data,
+        PayloadInfo_t& payload,
+        bool was_loaned,
+        WriteParams& wparams,
+        const InstanceHandle_t& handle,
+        std::unique_lock<RecursiveTimedMutex>& lock,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
     CacheChange_t* ch = writer_->new_change(change_kind, handle);
     if (ch != nullptr)
     {
@@ -1055,6 +1326,7 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
         return ReturnCode_t::RETCODE_OK;
     }
 
+    discard_payload(data, payload, was_loaned);
     return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
 }
 
@@ -2046,7 +2318,12 @@ std::shared_ptr<IPayloadPool> DataWriterImpl::get_payload_pool()
         // Get payload pool reference and allocate space for our history
         if (is_data_sharing_compatible_)
         {
-            payload_pool_ = DataSharingPayloadPool::get_writer_pool(config);
+            if (!datasharing_size_classes_.empty())
+            {
+                // The payload is taken from the size class matching the serialized size of each sample
+                fixed_payload_size_ = 0u;
+            }
+            payload_pool_ = DataSharingPayloadPool::get_writer_pool(config, datasharing_size_classes_);
         }
         else
         {
@@ -2116,10 +2393,11 @@ ReturnCode_t DataWriterImpl::check_datasharing_compatible(
     (void) writer_attributes;
 #endif // HAVE_SECURITY
 
+    // Size classes bound the size of the payloads of unbounded types
     bool has_bound_payload_size =
             (qos_.endpoint().history_memory_policy == eprosima::fastrtps::rtps::PREALLOCATED_MEMORY_MODE ||
             qos_.endpoint().history_memory_policy == eprosima::fastrtps::rtps::PREALLOCATED_WITH_REALLOC_MEMORY_MODE) &&
-            type_.is_bounded();
+            (type_.is_bounded() || !datasharing_size_classes_.empty());
 
     bool has_key = type_->m_isGetKeyDefined;
 
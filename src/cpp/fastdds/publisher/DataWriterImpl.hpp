@@ -20,6 +20,7 @@
 #define _FASTRTPS_DATAWRITERIMPL_HPP_
 
 #include <memory>
+#include <vector>
 
 #include <fastdds/dds/core/status/BaseStatus.hpp>
 #include <fastdds/dds/core/status/IncompatibleQosStatus.hpp>
@@ -45,6 +46,7 @@
 
 #include <fastdds/publisher/DataWriterHistory.hpp>
 #include <fastdds/publisher/filtering/ReaderFilterCollection.hpp>
+#include <fastdds/publisher/ParallelSerializer.hpp>
 
 #include <rtps/common/PayloadInfo_t.hpp>
 #include <rtps/history/ITopicPayloadPool.h>
@@ -218,6 +220,18 @@ public:
             const InstanceHandle_t& handle,
             const fastrtps::Time_t& timestamp);
 
+    /**
+     * Write a batch of samples, locking the history once.
+     *
+     * @param samples Pointers to the samples to publish.
+     * @param params  Extra write parameters, applied to all the samples. On return, holds the ones of the last sample.
+     *
+     * @return any of the standard return codes.
+     */
+    ReturnCode_t write_many(
+            const std::vector<void*>& samples,
+            fastrtps::rtps::WriteParams& params);
+
     /**
      * @brief Implementation of the DDS `register_instance` operation.
      * It deduces the instance's key and tries to get resources in the DataWriterHistory.
@@ -499,12 +513,32 @@ protected:
 
     uint32_t fixed_payload_size_ = 0u;
 
+    //! Size classes of the data sharing payload pool, read from property @c fastdds.datasharing.size_classes
+    std::vector<fastrtps::rtps::DataSharingPayloadPool::SizeClass> datasharing_size_classes_;
+
     std::shared_ptr<IPayloadPool> payload_pool_;
 
     bool is_custom_payload_pool_ = false;
 
     std::unique_ptr<LoanCollection> loans_;
 
+    //! Information of a sample being written by write_many
+    struct BatchSample
+    {
+        PayloadInfo_t payload;
+        InstanceHandle_t handle;
+        bool was_loaned = false;
+    };
+
+    //! Samples of the batch being written, reused to avoid allocations. Protected by the writer's mutex.
+    std::vector<BatchSample> batch_samples_;
+
+    //! Worker threads serializing the samples of large batches, when enabled.
+    std::unique_ptr<ParallelSerializer> serializer_;
+
+    //! Minimum serialized size of a sample for its batch to be serialized by the worker threads.
+    uint32_t parallel_serialization_min_size_ = 65536;
+
     fastrtps::rtps::GUID_t guid_;
 
     std::unique_ptr<ReaderFilterCollection> reader_filters_;
@@ -596,6 +630,50 @@ protected:
             fastrtps::rtps::WriteParams& wparams,
             const InstanceHandle_t& handle);
 
+    /**
+     * Create the worker threads used to serialize batches of large samples, when configured by the properties
+     * @c fastdds.parallel_serialization.threads and @c fastdds.parallel_serialization.min_size.
+     */
+    void create_parallel_serializer();
+
+    /**
+     * Read the size classes of the data sharing payload pool from the property @c fastdds.datasharing.size_classes,
+     * with format 'size:count[,size:count...]'.
+     */
+    void read_datasharing_size_classes();
+
+    /**
+     * Get the payload of a new change, serializing the sample unless it was loaned.
+     * Should be called with the writer's mutex taken.
+     */
+    ReturnCode_t prepare_payload(
+            fastrtps::rtps::ChangeKind_t change_kind,
+            void* data,
+            PayloadInfo_t& payload,
+            bool& was_loaned);
+
+    /**
+     * Give back a payload obtained with prepare_payload that will not be written.
+     */
+    void discard_payload(
+            void* data,
+            PayloadInfo_t& payload,
+            bool was_loaned);
+
+    /**
+     * Create a change holding the given payload and add it to the history.
+     * Should be called with the writer's mutex taken through @c lock.
+     */
+    ReturnCode_t add_change_to_history(
+            fastrtps::rtps::ChangeKind_t change_kind,
+            void* data,
+            PayloadInfo_t& payload,
+            bool was_loaned,
+            fastrtps::rtps::WriteParams& wparams,
+            const InstanceHandle_t& handle,
+            std::unique_lock<fastrtps::RecursiveTimedMutex>& lock,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
     static fastrtps::TopicAttributes get_topic_attributes(
             const DataWriterQos& qos,
             const Topic& topic,
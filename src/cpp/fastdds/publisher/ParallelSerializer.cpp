@@ -0,0 +1,134 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ParallelSerializer.cpp
+ */
+
+#include <fastdds/publisher/ParallelSerializer.hpp>
+
+#include <cassert>
+
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+ParallelSerializer::ParallelSerializer(
+        uint32_t num_workers,
+        const fastdds::rtps::ThreadSettings& thread_settings,
+        uint32_t writer_id)
+{
+    workers_.reserve(num_workers);
+    for (uint32_t i = 0; i < num_workers; ++i)
+    {
+        workers_.push_back(create_thread([this]()
+                {
+                    run();
+                }, thread_settings, "dds.ser.%u.%u", writer_id, i));
+    }
+}
+
+ParallelSerializer::~ParallelSerializer()
+{
+    {
+        std::lock_guard<std::mutex> guard(mtx_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+
+    for (auto& worker : workers_)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+}
+
+void ParallelSerializer::start(
+        size_t num_samples,
+        SerializeFunction&& serialize)
+{
+    {
+        std::lock_guard<std::mutex> guard(mtx_);
+        assert(next_sample_ >= num_samples_ && 0 == busy_workers_);
+
+        serialize_ = std::move(serialize);
+        states_.assign(num_samples, SampleState::PENDING);
+        next_sample_ = 0;
+        num_samples_ = num_samples;
+    }
+    work_cv_.notify_all();
+}
+
+bool ParallelSerializer::wait(
+        size_t index)
+{
+    std::unique_lock<std::mutex> lock(mtx_);
+    assert(index < states_.size());
+
+    done_cv_.wait(lock, [this, index]()
+            {
+                // A sample that will not be taken by any worker will never change its state
+                return SampleState::PENDING != states_[index] || index >= num_samples_;
+            });
+    return SampleState::SERIALIZED == states_[index];
+}
+
+void ParallelSerializer::finish()
+{
+    std::unique_lock<std::mutex> lock(mtx_);
+
+    // Prevent the workers from taking more samples, and wait for the ones being serialized
+    num_samples_ = next_sample_;
+    done_cv_.wait(lock, [this]()
+            {
+                return 0 == busy_workers_;
+            });
+    serialize_ = nullptr;
+}
+
+void ParallelSerializer::run()
+{
+    std::unique_lock<std::mutex> lock(mtx_);
+    while (true)
+    {
+        work_cv_.wait(lock, [this]()
+                {
+                    return stop_ || next_sample_ < num_samples_;
+                });
+
+        if (stop_)
+        {
+            break;
+        }
+
+        size_t index = next_sample_++;
+        ++busy_workers_;
+        lock.unlock();
+
+        bool serialized = serialize_(index);
+
+        lock.lock();
+        states_[index] = serialized ? SampleState::SERIALIZED : SampleState::FAILED;
+        --busy_workers_;
+        done_cv_.notify_all();
+    }
+}
+
+}  // namespace dds
+}  // namespace fastdds
+}  // namespace eprosima
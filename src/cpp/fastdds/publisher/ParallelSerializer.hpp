@@ -0,0 +1,121 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ParallelSerializer.hpp
+ */
+
+#ifndef _FASTDDS_PUBLISHER_PARALLELSERIALIZER_HPP_
+#define _FASTDDS_PUBLISHER_PARALLELSERIALIZER_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
+#include <utils/thread.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/**
+ * Pool of worker threads serializing the samples of a batch written by DataWriterImpl::write_many.
+ *
+ * Samples are taken by the workers in order, so the writing thread can add the first samples of the batch to the
+ * history, and send them, while the following ones are still being serialized.
+ */
+class ParallelSerializer
+{
+public:
+
+    //! Serializes the sample at the given position of the batch, returning whether it succeeded.
+    using SerializeFunction = std::function<bool(size_t)>;
+
+    /**
+     * Construct a ParallelSerializer and start its worker threads.
+     * @param num_workers Number of worker threads.
+     * @param thread_settings Settings of the worker threads.
+     * @param writer_id Identifier of the DataWriter, used on the name of the threads.
+     */
+    ParallelSerializer(
+            uint32_t num_workers,
+            const fastdds::rtps::ThreadSettings& thread_settings,
+            uint32_t writer_id);
+
+    ~ParallelSerializer();
+
+    /**
+     * Start serializing a batch of samples.
+     * @param num_samples Number of samples in the batch.
+     * @param serialize Function performing the serialization of each sample.
+     * @pre No other batch is being serialized.
+     */
+    void start(
+            size_t num_samples,
+            SerializeFunction&& serialize);
+
+    /**
+     * Wait for a sample of the current batch to be serialized.
+     * @param index Position of the sample in the batch.
+     * @return Whether the sample was correctly serialized.
+     */
+    bool wait(
+            size_t index);
+
+    /**
+     * Finish the current batch.
+     * Samples not yet taken by the workers are not serialized, and the method waits for the ones being serialized.
+     */
+    void finish();
+
+private:
+
+    enum class SampleState : uint8_t
+    {
+        PENDING,
+        SERIALIZED,
+        FAILED
+    };
+
+    void run();
+
+    std::mutex mtx_;
+    //! Notified when there are samples to serialize or the workers should stop.
+    std::condition_variable work_cv_;
+    //! Notified when a sample finishes its serialization.
+    std::condition_variable done_cv_;
+
+    SerializeFunction serialize_;
+    std::vector<SampleState> states_;
+    //! Position of the next sample to be taken by a worker.
+    size_t next_sample_ = 0;
+    //! Number of samples on the current batch that can be taken by the workers.
+    size_t num_samples_ = 0;
+    //! Number of samples being serialized.
+    size_t busy_workers_ = 0;
+    bool stop_ = false;
+
+    std::vector<eprosima::thread> workers_;
+};
+
+}  // namespace dds
+}  // namespace fastdds
+}  // namespace eprosima
+
+#endif  // _FASTDDS_PUBLISHER_PARALLELSERIALIZER_HPP_
@@ -24,6 +24,7 @@
 #include <fastdds/rtps/common/CacheChange.h>
 #include <fastdds/rtps/common/ChangeKind_t.hpp>
 #include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastrtps/utils/collections/RingVector.hpp>
 
 #include <utils/constructor_macros.hpp>
 
@@ -35,8 +36,8 @@ namespace detail {
 /// Book-keeping information for an instance
 struct DataWriterInstance
 {
-    //! A vector of cache changes
-    std::vector<fastrtps::rtps::CacheChange_t*> cache_changes;
+    //! A vector of cache changes. Removing the oldest one, as KEEP_LAST does, is a constant time operation.
+    fastrtps::RingVector<fastrtps::rtps::CacheChange_t*> cache_changes;
     //! The time when the group will miss the deadline
     std::chrono::steady_clock::time_point next_deadline_us;
     //! Serialized payload for key holder
@@ -243,6 +243,45 @@ ReturnCode_t DataReader::return_loan(
     return impl_->return_loan(data_values, sample_infos);
 }
 
+ReturnCode_t DataReader::read_serialized(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return impl_->read_serialized(data_values, sample_infos, max_samples, sample_states, view_states,
+                   instance_states);
+}
+
+ReturnCode_t DataReader::take_serialized(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return impl_->take_serialized(data_values, sample_infos, max_samples, sample_states, view_states,
+                   instance_states);
+}
+
+ReturnCode_t DataReader::take_batch(
+        LoanableCollection& data_values,
+        SampleInfoBatch& sample_infos,
+        int32_t max_samples)
+{
+    return impl_->take_batch(data_values, sample_infos, max_samples);
+}
+
+ReturnCode_t DataReader::return_loan(
+        LoanableCollection& data_values,
+        SampleInfoBatch& sample_infos)
+{
+    return impl_->return_loan(data_values, sample_infos);
+}
+
 ReturnCode_t DataReader::get_key_value(
         void* key_holder,
         const InstanceHandle_t& handle)
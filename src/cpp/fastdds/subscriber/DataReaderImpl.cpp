@@ -405,6 +405,13 @@ ReturnCode_t DataReaderImpl::check_collection_preconditions_and_calc_max_samples
         return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
     }
 
+    return check_data_collection_preconditions_and_calc_max_samples(data_values, max_samples);
+}
+
+ReturnCode_t DataReaderImpl::check_data_collection_preconditions_and_calc_max_samples(
+        LoanableCollection& data_values,
+        int32_t& max_samples)
+{
     // Check if a loan is required
     if (0 < data_values.maximum())
     {
@@ -469,6 +476,19 @@ ReturnCode_t DataReaderImpl::prepare_loan(
         }
     }
 
+    ReturnCode_t code = limit_loaned_samples(max_samples);
+    if (!code)
+    {
+        return code;
+    }
+
+    // Check if there are enough loans
+    return loan_manager_.get_loan(data_values, sample_infos);
+}
+
+ReturnCode_t DataReaderImpl::limit_loaned_samples(
+        int32_t& max_samples)
+{
     if (max_samples > 0)
     {
         // Check if there are enough samples
@@ -492,13 +512,6 @@ ReturnCode_t DataReaderImpl::prepare_loan(
         }
     }
 
-    // Check if there are enough loans
-    ReturnCode_t code = loan_manager_.get_loan(data_values, sample_infos);
-    if (!code)
-    {
-        return code;
-    }
-
     return ReturnCode_t::RETCODE_OK;
 }
 
@@ -512,13 +525,20 @@ ReturnCode_t DataReaderImpl::read_or_take(
         InstanceStateMask instance_states,
         bool exact_instance,
         bool single_instance,
-        bool should_take)
+        bool should_take,
+        bool serialized_views)
 {
     if (reader_ == nullptr)
     {
         return ReturnCode_t::RETCODE_NOT_ENABLED;
     }
 
+    // Serialized views reference the payloads kept by the reader, so they can only be loaned
+    if (serialized_views && 0 < data_values.maximum())
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
     ReturnCode_t code = check_collection_preconditions_and_calc_max_samples(data_values, sample_infos, max_samples);
     if (!code)
     {
@@ -568,7 +588,8 @@ ReturnCode_t DataReaderImpl::read_or_take(
         states,
         it.second,
         single_instance,
-        !exact_instance);
+        !exact_instance,
+        serialized_views);
 
     while (!cmd.is_finished())
     {
@@ -656,6 +677,194 @@ ReturnCode_t DataReaderImpl::take_next_instance(
                    sample_states, view_states, instance_states, false, true, true);
 }
 
+ReturnCode_t DataReaderImpl::read_serialized(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return read_or_take(data_values, sample_infos, max_samples, HANDLE_NIL,
+                   sample_states, view_states, instance_states, false, false, false, true);
+}
+
+ReturnCode_t DataReaderImpl::take_serialized(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return read_or_take(data_values, sample_infos, max_samples, HANDLE_NIL,
+                   sample_states, view_states, instance_states, false, false, true, true);
+}
+
+ReturnCode_t DataReaderImpl::take_batch(
+        LoanableCollection& data_values,
+        SampleInfoBatch& sample_infos,
+        int32_t max_samples)
+{
+    if (reader_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    ReturnCode_t code = check_data_collection_preconditions_and_calc_max_samples(data_values, max_samples);
+    if (!code)
+    {
+        return code;
+    }
+
+#if HAVE_STRICT_REALTIME
+    auto max_blocking_time = std::chrono::steady_clock::now() +
+            std::chrono::microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
+    std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex(), std::defer_lock);
+
+    if (!lock.try_lock_until(max_blocking_time))
+    {
+        return ReturnCode_t::RETCODE_TIMEOUT;
+    }
+#else
+    std::lock_guard<RecursiveTimedMutex> _(reader_->getMutex());
+#endif // if HAVE_STRICT_REALTIME
+
+    set_read_communication_status(false);
+    sample_infos.clear();
+
+    auto it = history_.lookup_available_instance(HANDLE_NIL, false);
+    if (!it.first)
+    {
+        return ReturnCode_t::RETCODE_NO_DATA;
+    }
+
+    bool is_loan = 0 == data_values.maximum();
+    if (is_loan)
+    {
+        code = limit_loaned_samples(max_samples);
+        if (!code)
+        {
+            return code;
+        }
+
+        code = loan_manager_.get_loan(data_values);
+        if (!code)
+        {
+            return code;
+        }
+    }
+    else
+    {
+        data_values.length(0);
+    }
+
+    // Traverse all the instances with available data, as take would do with the default masks
+    detail::DataReaderHistory::instance_info instance = it.second;
+    int32_t remaining_samples = max_samples;
+    bool has_more_instances = true;
+    while (remaining_samples > 0 && has_more_instances)
+    {
+        InstanceHandle_t handle = instance->first;
+        if (take_batch_from_instance(data_values, sample_infos, remaining_samples, instance))
+        {
+            history_.instance_viewed_nts(instance->second);
+        }
+
+        history_.check_and_remove_instance(instance);
+        auto next = history_.next_available_instance_nts(handle, instance);
+        has_more_instances = next.first;
+        instance = next.second;
+    }
+
+    try_notify_read_conditions();
+
+    if (0 == sample_infos.size())
+    {
+        if (is_loan)
+        {
+            loan_manager_.return_loan(data_values);
+            data_values.unloan();
+        }
+        return ReturnCode_t::RETCODE_NO_DATA;
+    }
+
+    return ReturnCode_t::RETCODE_OK;
+}
+
+bool DataReaderImpl::take_batch_from_instance(
+        LoanableCollection& data_values,
+        SampleInfoBatch& sample_infos,
+        int32_t& remaining_samples,
+        detail::DataReaderHistory::instance_info& instance)
+{
+    bool has_ownership = data_values.has_ownership();
+    bool ret_val = false;
+
+    auto it = instance->second->cache_changes.begin();
+    while (remaining_samples > 0 && it != instance->second->cache_changes.end())
+    {
+        CacheChange_t* change = *it;
+        WriterProxy* wp = nullptr;
+        bool is_future_change = false;
+        if (!reader_->begin_sample_access_nts(change, wp, is_future_change) ||
+                !detail::ReadTakeCommand::check_datasharing_validity(change, has_ownership))
+        {
+            // Remove from history. Current iterator will point to change next to the one removed.
+            history_.remove_change_sub(change, it);
+            continue;
+        }
+
+        if (is_future_change)
+        {
+            ++it;
+            continue;
+        }
+
+        LoanableCollection::size_type slot = data_values.length();
+        bool valid_data = eprosima::fastrtps::rtps::ALIVE == change->kind;
+        bool added = true;
+        data_values.length(slot + 1);
+        if (valid_data)
+        {
+            if (has_ownership)
+            {
+                added = type_->deserialize(&change->serializedPayload, data_values.buffer()[slot]) &&
+                        detail::ReadTakeCommand::check_datasharing_validity(change, has_ownership);
+            }
+            else
+            {
+                void* sample = nullptr;
+                sample_pool_->get_loan(change, sample);
+                const_cast<void**>(data_values.buffer())[slot] = sample;
+            }
+        }
+
+        history_.change_was_processed_nts(change, added);
+        reader_->end_sample_access_nts(change, wp, added);
+
+        if (added)
+        {
+            sample_infos.source_timestamp.push_back(change->sourceTimestamp);
+            sample_infos.instance_handle.push_back(change->instanceHandle);
+            sample_infos.writer_guid.push_back(change->writerGUID);
+            sample_infos.sequence_number.push_back(change->sequenceNumber);
+            sample_infos.valid_data.push_back(valid_data);
+            --remaining_samples;
+            ret_val = true;
+        }
+        else
+        {
+            data_values.length(slot);
+        }
+
+        // Samples are always taken, and the ones that could not be deserialized are discarded
+        history_.remove_change_sub(change, it);
+    }
+
+    return ret_val;
+}
+
 ReturnCode_t DataReaderImpl::return_loan(
         LoanableCollection& data_values,
         SampleInfoSeq& sample_infos)
@@ -708,6 +917,48 @@ ReturnCode_t DataReaderImpl::return_loan(
     return ReturnCode_t::RETCODE_OK;
 }
 
+ReturnCode_t DataReaderImpl::return_loan(
+        LoanableCollection& data_values,
+        SampleInfoBatch& sample_infos)
+{
+    if (reader_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    // Collections should have been loaned by take_batch
+    if (data_values.has_ownership() == true ||
+            static_cast<size_t>(data_values.length()) != sample_infos.size())
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
+
+    // Check if they were loaned by this reader
+    ReturnCode_t code = loan_manager_.return_loan(data_values);
+    if (!code)
+    {
+        return code;
+    }
+
+    // Return samples
+    LoanableCollection::size_type n = data_values.length();
+    while (n > 0)
+    {
+        --n;
+        if (sample_infos.valid_data[n])
+        {
+            sample_pool_->return_loan(data_values.buffer()[n]);
+        }
+    }
+
+    data_values.unloan();
+    sample_infos.clear();
+
+    return ReturnCode_t::RETCODE_OK;
+}
+
 ReturnCode_t DataReaderImpl::read_or_take_next_sample(
         void* data,
         SampleInfo* info,
@@ -1871,6 +2122,13 @@ ReturnCode_t DataReaderImpl::check_datasharing_compatible(
 
     bool has_key = type_->m_isGetKeyDefined;
 
+    // Payloads of unbounded types can be shared by writers using size classes, but the application should state
+    // that the matched writers are configured accordingly
+    const std::string* unbounded_property =
+            PropertyPolicyHelper::find_property(qos_.properties(), "fastdds.datasharing.unbounded_types");
+    bool has_bound_payload_size = type_.is_bounded() ||
+            (nullptr != unbounded_property && "true" == *unbounded_property);
+
     is_datasharing_compatible = false;
     switch (qos_.data_sharing().kind())
     {
@@ -1885,7 +2143,7 @@ ReturnCode_t DataReaderImpl::check_datasharing_compatible(
                 return ReturnCode_t::RETCODE_NOT_ALLOWED_BY_SECURITY;
             }
 #endif // if HAVE_SECURITY
-            if (!type_.is_bounded())
+            if (!has_bound_payload_size)
             {
                 EPROSIMA_LOG_INFO(DATA_READER, "Data sharing cannot be used with unbounded data types");
                 return ReturnCode_t::RETCODE_BAD_PARAMETER;
@@ -1909,7 +2167,7 @@ ReturnCode_t DataReaderImpl::check_datasharing_compatible(
             }
 #endif // if HAVE_SECURITY
 
-            if (!type_.is_bounded())
+            if (!has_bound_payload_size)
             {
                 EPROSIMA_LOG_INFO(DATA_READER, "Data sharing disabled because data type is not bounded");
                 return ReturnCode_t::RETCODE_OK;
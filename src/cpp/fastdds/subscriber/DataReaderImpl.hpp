@@ -30,6 +30,7 @@
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/subscriber/ReadCondition.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/SampleInfoBatch.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 #include <fastdds/rtps/attributes/ReaderAttributes.h>
 #include <fastdds/rtps/common/Guid.h>
@@ -191,10 +192,35 @@ public:
 
     ///@}
 
+    ReturnCode_t take_batch(
+            LoanableCollection& data_values,
+            SampleInfoBatch& sample_infos,
+            int32_t max_samples = LENGTH_UNLIMITED);
+
+    ReturnCode_t read_serialized(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples = LENGTH_UNLIMITED,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE);
+
+    ReturnCode_t take_serialized(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples = LENGTH_UNLIMITED,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE);
+
     ReturnCode_t return_loan(
             LoanableCollection& data_values,
             SampleInfoSeq& sample_infos);
 
+    ReturnCode_t return_loan(
+            LoanableCollection& data_values,
+            SampleInfoBatch& sample_infos);
+
     /**
      * @brief Returns information about the first untaken sample. This method is meant to be called prior to
      * a read() or take() operation as it does not modify the status condition of the entity.
@@ -549,11 +575,24 @@ protected:
             SampleInfoSeq& sample_infos,
             int32_t& max_samples);
 
+    ReturnCode_t check_data_collection_preconditions_and_calc_max_samples(
+            LoanableCollection& data_values,
+            int32_t& max_samples);
+
     ReturnCode_t prepare_loan(
             LoanableCollection& data_values,
             SampleInfoSeq& sample_infos,
             int32_t& max_samples);
 
+    ReturnCode_t limit_loaned_samples(
+            int32_t& max_samples);
+
+    bool take_batch_from_instance(
+            LoanableCollection& data_values,
+            SampleInfoBatch& sample_infos,
+            int32_t& remaining_samples,
+            detail::DataReaderHistory::instance_info& instance);
+
     ReturnCode_t read_or_take(
             LoanableCollection& data_values,
             SampleInfoSeq& sample_infos,
@@ -564,7 +603,8 @@ protected:
             InstanceStateMask instance_states,
             bool exact_instance,
             bool single_instance,
-            bool should_take);
+            bool should_take,
+            bool serialized_views = false);
 
     ReturnCode_t read_or_take_next_sample(
             void* data,
@@ -76,30 +76,30 @@ struct DataReaderLoanManager
             LoanableCollection& data_values,
             SampleInfoSeq& sample_infos)
     {
-        OutstandingLoanItem* result = nullptr;
-
-        if (free_loans_.empty())
+        OutstandingLoanItem* result = get_loan_item();
+        if (nullptr == result)
         {
-            OutstandingLoanItem tmp;
-            result = used_loans_.push_back(tmp);
-            if (nullptr == result)
-            {
-                return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
-            }
-
-            result->data_values = new LoanableCollection::element_type[max_samples_];
-            result->sample_infos = new LoanableCollection::element_type[max_samples_];
+            return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
         }
-        else
+
+        data_values.loan(result->data_values, max_samples_, 0);
+        sample_infos.loan(result->sample_infos, max_samples_, 0);
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    /**
+     * Loan a buffer only for the data values, as used when the sample infos are returned on a SampleInfoBatch.
+     */
+    ReturnCode_t get_loan(
+            LoanableCollection& data_values)
+    {
+        OutstandingLoanItem* result = get_loan_item();
+        if (nullptr == result)
         {
-            result = used_loans_.push_back(free_loans_.back());
-            static_cast<void>(result);
-            assert(result != nullptr);
-            free_loans_.pop_back();
+            return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
         }
 
         data_values.loan(result->data_values, max_samples_, 0);
-        sample_infos.loan(result->sample_infos, max_samples_, 0);
         return ReturnCode_t::RETCODE_OK;
     }
 
@@ -122,6 +122,28 @@ struct DataReaderLoanManager
         return ReturnCode_t::RETCODE_OK;
     }
 
+    ReturnCode_t return_loan(
+            LoanableCollection& data_values)
+    {
+        const LoanableCollection::element_type* buffer = data_values.buffer();
+        auto it = std::find_if(used_loans_.begin(), used_loans_.end(), [buffer](const OutstandingLoanItem& item)
+                        {
+                            return item.data_values == buffer;
+                        });
+        if (it == used_loans_.end())
+        {
+            return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+        }
+
+        OutstandingLoanItem tmp = *it;
+        used_loans_.remove(tmp);
+
+        OutstandingLoanItem* result = free_loans_.push_back(tmp);
+        static_cast<void>(result);
+        assert(result != nullptr);
+        return ReturnCode_t::RETCODE_OK;
+    }
+
 private:
 
     struct OutstandingLoanItem
@@ -139,6 +161,31 @@ private:
 
     using collection_type = eprosima::fastrtps::ResourceLimitedVector<OutstandingLoanItem>;
 
+    OutstandingLoanItem* get_loan_item()
+    {
+        OutstandingLoanItem* result = nullptr;
+
+        if (free_loans_.empty())
+        {
+            OutstandingLoanItem tmp;
+            result = used_loans_.push_back(tmp);
+            if (nullptr != result)
+            {
+                result->data_values = new LoanableCollection::element_type[max_samples_];
+                result->sample_infos = new LoanableCollection::element_type[max_samples_];
+            }
+        }
+        else
+        {
+            result = used_loans_.push_back(free_loans_.back());
+            static_cast<void>(result);
+            assert(result != nullptr);
+            free_loans_.pop_back();
+        }
+
+        return result;
+    }
+
     int32_t max_samples_ = 0;
     collection_type free_loans_;
     collection_type used_loans_;
@@ -66,7 +66,8 @@ struct ReadTakeCommand
             const StateFilter& states,
             const history_type::instance_info& instance,
             bool single_instance,
-            bool loop_for_data)
+            bool loop_for_data,
+            bool serialized_views = false)
         : type_(reader.type_)
         , loan_manager_(reader.loan_manager_)
         , history_(reader.history_)
@@ -81,6 +82,7 @@ struct ReadTakeCommand
         , handle_(instance->first)
         , single_instance_(single_instance)
         , loop_for_data_(loop_for_data)
+        , serialized_views_(serialized_views)
     {
         assert(0 <= remaining_samples_);
 
@@ -264,6 +266,31 @@ struct ReadTakeCommand
         }
     }
 
+    static bool check_datasharing_validity(
+            CacheChange_t* change,
+            bool has_ownership)
+    {
+        bool is_valid = true;
+        if (has_ownership)  //< On loans the user must check the validity anyways
+        {
+            DataSharingPayloadPool* pool = dynamic_cast<DataSharingPayloadPool*>(change->payload_owner());
+            if (pool)
+            {
+                //Check if the payload is dirty
+                is_valid = pool->is_sample_valid(*change);
+            }
+        }
+
+        if (!is_valid)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_READER,
+                    "Change " << change->sequenceNumber << " from " << change->writerGUID << " is overidden");
+            return false;
+        }
+
+        return true;
+    }
+
 private:
 
     const TypeSupport& type_;
@@ -280,6 +307,7 @@ private:
     InstanceHandle_t handle_;
     bool single_instance_;
     bool loop_for_data_;
+    bool serialized_views_;
 
     bool finished_ = false;
     ReturnCode_t return_value_ = ReturnCode_t::RETCODE_NO_DATA;
@@ -377,7 +405,7 @@ private:
         {
             // loan
             void* sample;
-            sample_pool_->get_loan(change, sample);
+            sample_pool_->get_loan(change, sample, serialized_views_);
             const_cast<void**>(data_values_.buffer())[current_slot_] = sample;
             return true;
         }
@@ -398,31 +426,6 @@ private:
         generate_info(info, *instance_->second, item);
     }
 
-    bool check_datasharing_validity(
-            CacheChange_t* change,
-            bool has_ownership)
-    {
-        bool is_valid = true;
-        if (has_ownership)  //< On loans the user must check the validity anyways
-        {
-            DataSharingPayloadPool* pool = dynamic_cast<DataSharingPayloadPool*>(change->payload_owner());
-            if (pool)
-            {
-                //Check if the payload is dirty
-                is_valid = pool->is_sample_valid(*change);
-            }
-        }
-
-        if (!is_valid)
-        {
-            EPROSIMA_LOG_WARNING(RTPS_READER,
-                    "Change " << change->sequenceNumber << " from " << change->writerGUID << " is overidden");
-            return false;
-        }
-
-        return true;
-    }
-
 };
 
 } /* namespace detail */
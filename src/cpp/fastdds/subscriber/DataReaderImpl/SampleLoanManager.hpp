@@ -23,6 +23,7 @@
 #include <cassert>
 
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/subscriber/SerializedSampleView.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 
 #include <fastdds/rtps/common/CacheChange.h>
@@ -58,6 +59,7 @@ struct SampleLoanManager
                 pool_config.maximum_size ? pool_config.maximum_size : std::numeric_limits<size_t>::max(),
                 1)
         , free_loans_(limits_)
+        , free_views_(limits_)
         , used_loans_(limits_)
         , type_(type)
     {
@@ -81,6 +83,11 @@ struct SampleLoanManager
                 type_->deleteData(item.sample);
             }
         }
+
+        for (const OutstandingLoanItem& item : free_views_)
+        {
+            delete static_cast<SerializedSampleView*>(item.sample);
+        }
     }
 
     int32_t num_allocated() const
@@ -89,12 +96,21 @@ struct SampleLoanManager
         return static_cast<int32_t>(used_loans_.size());
     }
 
+    /**
+     * Loan a sample for a change.
+     *
+     * @param change   Change whose payload should be loaned.
+     * @param sample   Pointer to the loaned sample.
+     * @param as_view  When true, the sample is a SerializedSampleView over the payload instead of a deserialized
+     *                 sample.
+     */
     void get_loan(
             CacheChange_t* change,
-            void*& sample)
+            void*& sample,
+            bool as_view = false)
     {
         // Early return an already loaned item
-        OutstandingLoanItem* item = find_by_change(change);
+        OutstandingLoanItem* item = find_by_change(change, as_view);
         if (nullptr != item)
         {
             item->num_refs += 1;
@@ -103,14 +119,20 @@ struct SampleLoanManager
         }
 
         // Get an item from the pool
-        if (free_loans_.empty())
+        collection_type& free_items = as_view ? free_views_ : free_loans_;
+        if (free_items.empty())
         {
             // Try to create a new entry
             item = used_loans_.push_back({});
             if (nullptr != item)
             {
                 // Create sample if necessary
-                if (!is_plain_)
+                item->is_view = as_view;
+                if (as_view)
+                {
+                    item->sample = new SerializedSampleView();
+                }
+                else if (!is_plain_)
                 {
                     item->sample = type_->createData();
                 }
@@ -119,9 +141,9 @@ struct SampleLoanManager
         else
         {
             // Reuse a free entry
-            item = used_loans_.push_back(free_loans_.back());
+            item = used_loans_.push_back(free_items.back());
             assert(nullptr != item);
-            free_loans_.pop_back();
+            free_items.pop_back();
         }
 
         // Should always find an entry, as resource limits are checked before calling this method
@@ -141,7 +163,15 @@ struct SampleLoanManager
         tmp.serializedPayload.data = nullptr;
 
         // Perform deserialization
-        if (is_plain_)
+        if (item->is_view)
+        {
+            // Deserialization is deferred until the application accesses the view
+            SerializedSampleView* view = static_cast<SerializedSampleView*>(item->sample);
+            view->data_ = item->payload.data;
+            view->length_ = item->payload.length;
+            view->type_ = type_.get();
+        }
+        else if (is_plain_)
         {
             auto ptr = item->payload.data;
             ptr += item->payload.representation_header_size;
@@ -173,7 +203,7 @@ struct SampleLoanManager
             item->payload.data = nullptr;
             item->owner = nullptr;
 
-            item = free_loans_.push_back(*item);
+            item = (item->is_view ? free_views_ : free_loans_).push_back(*item);
             assert(nullptr != item);
             used_loans_.remove(*item);
         }
@@ -188,6 +218,7 @@ private:
         SerializedPayload_t payload;
         IPayloadPool* owner = nullptr;
         uint32_t num_refs = 0;
+        bool is_view = false;
 
         ~OutstandingLoanItem()
         {
@@ -217,19 +248,21 @@ private:
     bool is_plain_;
     eprosima::fastrtps::ResourceLimitedContainerConfig limits_;
     collection_type free_loans_;
+    collection_type free_views_;
     collection_type used_loans_;
     TypeSupport type_;
 
     OutstandingLoanItem* find_by_change(
-            CacheChange_t* change)
+            CacheChange_t* change,
+            bool as_view)
     {
         SampleIdentity id;
         id.writer_guid(change->writerGUID);
         id.sequence_number(change->sequenceNumber);
 
-        auto comp = [id](const OutstandingLoanItem& item)
+        auto comp = [id, as_view](const OutstandingLoanItem& item)
                 {
-                    return id == item.identity;
+                    return id == item.identity && as_view == item.is_view;
                 };
         auto it = std::find_if(used_loans_.begin(), used_loans_.end(), comp);
         if (it != used_loans_.end())
@@ -93,6 +93,12 @@ DataReaderHistory::DataReaderHistory(
         {
             key_changes_allocation_.maximum = resource_limited_qos_.max_samples_per_instance;
         }
+
+        if (resource_limited_qos_.max_instances < std::numeric_limits<int32_t>::max())
+        {
+            // Avoid rehashing the instance index while the history is being filled
+            instances_.reserve(static_cast<size_t>(resource_limited_qos_.max_instances));
+        }
     }
     else
     {
@@ -226,7 +232,7 @@ bool DataReaderHistory::received_change_keep_all(
     }
 
     bool ret_value = false;
-    InstanceCollection::iterator vit;
+    InstanceIndex::iterator vit;
     if (find_key(a_change->instanceHandle, vit))
     {
         DataReaderInstance::ChangeCollection& instance_changes = vit->second->cache_changes;
@@ -262,7 +268,7 @@ bool DataReaderHistory::received_change_keep_last(
     }
 
     bool ret_value = false;
-    InstanceCollection::iterator vit;
+    InstanceIndex::iterator vit;
     if (find_key(a_change->instanceHandle, vit))
     {
         DataReaderInstance::ChangeCollection& instance_changes = vit->second->cache_changes;
@@ -380,9 +386,9 @@ bool DataReaderHistory::get_first_untaken_info(
 
 bool DataReaderHistory::find_key(
         const InstanceHandle_t& handle,
-        InstanceCollection::iterator& vit_out)
+        InstanceIndex::iterator& vit_out)
 {
-    InstanceCollection::iterator vit;
+    InstanceIndex::iterator vit;
     vit = instances_.find(handle);
     if (vit != instances_.end())
     {
@@ -437,7 +443,7 @@ bool DataReaderHistory::remove_change_sub(
 
     std::lock_guard<RecursiveTimedMutex> guard(*getMutex());
     bool found = false;
-    InstanceCollection::iterator vit;
+    InstanceIndex::iterator vit;
     if (find_key(change->instanceHandle, vit))
     {
         for (auto chit = vit->second->cache_changes.begin(); chit != vit->second->cache_changes.end(); ++chit)
@@ -500,7 +506,7 @@ bool DataReaderHistory::remove_change_sub(
 
     if (new_it == changesEnd() || !matches_change(&dummy_change, *new_it)) // Change was successfully removed.
     {
-        InstanceCollection::iterator vit;
+        InstanceIndex::iterator vit;
         if (find_key(dummy_change.instanceHandle, vit))
         {
             auto in_it = std::find(vit->second->cache_changes.begin(), vit->second->cache_changes.end(), change);
@@ -566,8 +572,8 @@ bool DataReaderHistory::get_next_deadline(
     auto min = std::min_element(instances_.begin(),
                     instances_.end(),
                     [](
-                        const InstanceCollection::value_type& lhs,
-                        const InstanceCollection::value_type& rhs)
+                        const InstanceIndex::value_type& lhs,
+                        const InstanceIndex::value_type& rhs)
                     {
                         return lhs.second->next_deadline_us < rhs.second->next_deadline_us;
                     });
@@ -753,7 +759,7 @@ bool DataReaderHistory::completed_change(
 
     if (compute_key_for_change_fn_(change))
     {
-        InstanceCollection::iterator vit;
+        InstanceIndex::iterator vit;
         if (find_key(change->instanceHandle, vit))
         {
             ret_value = !change->instanceHandle.isDefined() ||
@@ -853,7 +859,7 @@ void DataReaderHistory::instance_viewed_nts(
 bool DataReaderHistory::update_instance_nts(
         CacheChange_t* const change)
 {
-    InstanceCollection::iterator vit;
+    InstanceIndex::iterator vit;
     vit = instances_.find(change->instanceHandle);
 
     assert(vit != instances_.end());
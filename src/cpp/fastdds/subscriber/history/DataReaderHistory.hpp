@@ -23,6 +23,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
@@ -45,6 +46,8 @@
 #include <fastrtps/utils/fixed_size_string.hpp>
 #include <fastrtps/utils/collections/ResourceLimitedContainerConfig.hpp>
 
+#include <utils/hash.hpp>
+
 #include "DataReaderHistoryCounters.hpp"
 #include "DataReaderInstance.hpp"
 
@@ -67,6 +70,8 @@ public:
     using SequenceNumber_t = eprosima::fastrtps::rtps::SequenceNumber_t;
 
     using InstanceCollection = std::map<InstanceHandle_t, std::shared_ptr<DataReaderInstance>>;
+    using InstanceIndex = std::unordered_map<InstanceHandle_t, std::shared_ptr<DataReaderInstance>,
+                    eprosima::fastrtps::rtps::InstanceHandleHash>;
     using instance_info = InstanceCollection::iterator;
 
     /**
@@ -373,8 +378,8 @@ private:
     //!Resource limits for allocating the array of alive writers per instance
     eprosima::fastrtps::ResourceLimitedContainerConfig key_writers_allocation_;
     //!Collection of DataReaderInstance objects accessible by their handle
-    InstanceCollection instances_;
-    //!Collection of DataReaderInstance objects with available data, accessible by their handle
+    InstanceIndex instances_;
+    //!Collection of DataReaderInstance objects with available data, ordered by their handle
     InstanceCollection data_available_instances_;
     //!HistoryQosPolicy values.
     HistoryQosPolicy history_qos_;
@@ -410,7 +415,7 @@ private:
      */
     bool find_key(
             const InstanceHandle_t& handle,
-            InstanceCollection::iterator& map_it);
+            InstanceIndex::iterator& map_it);
 
     /**
      * @name Variants of incoming change processing.
@@ -21,6 +21,7 @@
 #include <utils/thread.hpp>
 #include <utils/threading.hpp>
 
+#include <chrono>
 #include <memory>
 #include <mutex>
 
@@ -34,6 +35,7 @@ DataSharingListener::DataSharingListener(
         const std::string& datasharing_pools_directory,
         const fastdds::rtps::ThreadSettings& thr_config,
         ResourceLimitedContainerConfig limits,
+        uint32_t spin_budget_us,
         RTPSReader* reader)
     : notification_(notification)
     , is_running_(false)
@@ -42,6 +44,7 @@ DataSharingListener::DataSharingListener(
     , writer_pools_changed_(false)
     , datasharing_pools_directory_(datasharing_pools_directory)
     , thread_config_(thr_config)
+    , spin_budget_us_(spin_budget_us)
 {
 }
 
@@ -51,25 +54,52 @@ DataSharingListener::~DataSharingListener()
     notification_->destroy();
 }
 
-void DataSharingListener::run()
+bool DataSharingListener::spin_for_new_data() const
 {
-    std::unique_lock<Segment::mutex> lock(notification_->notification_->notification_mutex, std::defer_lock);
-    while (is_running_.load())
+    if (0 == spin_budget_us_)
     {
-        try
-        {
-            lock.lock();
-            notification_->notification_->notification_cv.wait(lock, [&]
-                    {
-                        return !is_running_.load() || notification_->notification_->new_data.load();
-                    });
+        return false;
+    }
 
-            lock.unlock();
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(spin_budget_us_);
+    do
+    {
+        if (!is_running_.load() || notification_->notification_->new_data.load())
+        {
+            return true;
         }
-        catch (const boost::interprocess::interprocess_exception& /*e*/)
+    } while (std::chrono::steady_clock::now() < deadline);
+
+    return false;
+}
+
+void DataSharingListener::run()
+{
+    Notification* notification = notification_->notification_;
+    std::unique_lock<Segment::mutex> lock(notification->notification_mutex, std::defer_lock);
+    while (is_running_.load())
+    {
+        // Writers do not signal the condition variable while the listener is spinning
+        if (!spin_for_new_data())
         {
-            // Timeout when locking
-            continue;
+            try
+            {
+                lock.lock();
+                notification->listener_waiting.store(true);
+                notification->notification_cv.wait(lock, [&]
+                        {
+                            return !is_running_.load() || notification->new_data.load();
+                        });
+                notification->listener_waiting.store(false);
+
+                lock.unlock();
+            }
+            catch (const boost::interprocess::interprocess_exception& /*e*/)
+            {
+                // Timeout when locking
+                notification->listener_waiting.store(false);
+                continue;
+            }
         }
 
         if (!is_running_.load())
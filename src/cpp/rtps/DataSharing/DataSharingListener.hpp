@@ -51,6 +51,7 @@ public:
             const std::string& datasharing_pools_directory,
             const fastdds::rtps::ThreadSettings& thr_config,
             ResourceLimitedContainerConfig limits,
+            uint32_t spin_budget_us,
             RTPSReader* reader);
 
     virtual ~DataSharingListener();
@@ -91,6 +92,12 @@ protected:
      */
     void run();
 
+    /**
+     * Busy-waits for new data during the configured spin budget, before blocking on the notification.
+     * @return true if there is new data, or the listener was stopped, before the budget expired.
+     */
+    bool spin_for_new_data() const;
+
     /**
      * Processes a notification
      */
@@ -120,6 +127,8 @@ protected:
     std::atomic<bool> writer_pools_changed_;
     std::string datasharing_pools_directory_;
     fastdds::rtps::ThreadSettings thread_config_;
+    //! Microseconds to busy-wait for new data before blocking. 0 disables spinning.
+    uint32_t spin_budget_us_;
     mutable std::mutex mutex_;
 
 };
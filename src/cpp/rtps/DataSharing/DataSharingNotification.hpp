@@ -49,14 +49,23 @@ public:
     virtual ~DataSharingNotification() = default;
 
     /**
-     * Notifies of new data
+     * Notifies of new data.
+     * The condition variable is only signaled when the listener is blocked on it. Otherwise the listener is
+     * processing or spinning, and will find the new data flag set, so notifications of a burst are coalesced.
      */
     inline void notify()
     {
+        // Both flags are sequentially consistent: either the listener sees new_data before blocking,
+        // or this sees listener_waiting and signals the condition variable.
+        notification_->new_data.store(true);
+        if (!notification_->listener_waiting.load())
+        {
+            return;
+        }
+
         try
         {
             std::unique_lock<Segment::mutex> lock(notification_->notification_mutex);
-            notification_->new_data.store(true);
             lock.unlock();
             notification_->notification_cv.notify_all();
         }
@@ -96,6 +105,16 @@ public:
         return "fast_datasharing";
     }
 
+    /**
+     * Name of the Notification object inside the segment.
+     * It carries the version of the Notification layout, so an endpoint using a different layout fails to
+     * attach to the segment instead of reading it with the wrong layout.
+     */
+    constexpr static const char* notification_node_name()
+    {
+        return "notification_node_v2";
+    }
+
 protected:
 
 #pragma warning(push)
@@ -110,6 +129,9 @@ protected:
 
         //! New data available
         std::atomic<bool> new_data;
+
+        //! The listener is blocked (or about to block) on notification_cv
+        std::atomic<bool> listener_waiting;
     };
 #pragma warning(pop)
 
@@ -167,8 +189,9 @@ protected:
         try
         {
             // Alloc and initialize the Node
-            notification_ = local_segment->get().template construct<Notification>("notification_node")();
+            notification_ = local_segment->get().template construct<Notification>(notification_node_name())();
             notification_->new_data.store(false);
+            notification_->listener_waiting.store(false);
         }
         catch (std::exception& e)
         {
@@ -209,12 +232,13 @@ protected:
 
         // Initialize values from the segment
         notification_ = (local_segment->get().template find<Notification>(
-                    "notification_node")).first;
+                    notification_node_name())).first;
         if (!notification_)
         {
             local_segment.reset();
 
-            EPROSIMA_LOG_ERROR(HISTORY_DATASHARING_LISTENER, "Failed to open listener queue " << segment_name_);
+            EPROSIMA_LOG_ERROR(HISTORY_DATASHARING_LISTENER,
+                    "Failed to open listener queue " << segment_name_ << ": missing or incompatible version");
             return false;
         }
 
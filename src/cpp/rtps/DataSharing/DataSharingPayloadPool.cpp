@@ -107,6 +107,19 @@ std::shared_ptr<DataSharingPayloadPool> DataSharingPayloadPool::get_writer_pool(
         config.payload_initial_size);
 }
 
+std::shared_ptr<DataSharingPayloadPool> DataSharingPayloadPool::get_writer_pool(
+        const PoolConfig& config,
+        const std::vector<SizeClass>& size_classes)
+{
+    assert (config.memory_policy == PREALLOCATED_MEMORY_MODE ||
+            config.memory_policy == PREALLOCATED_WITH_REALLOC_MEMORY_MODE);
+
+    return std::make_shared<WriterPool>(
+        config.maximum_size,
+        config.payload_initial_size,
+        size_classes);
+}
+
 }  // namespace rtps
 }  // namespace fastrtps
 }  // namespace eprosima
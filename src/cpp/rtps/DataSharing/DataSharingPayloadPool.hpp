@@ -27,6 +27,7 @@
 #include <utils/shared_memory/SharedMemSegment.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -48,6 +49,13 @@ public:
     template <class M>
     using sharable_lock = Segment::sharable_lock<M>;
 
+    //! Payloads of the same maximum size on a writer pool
+    struct SizeClass
+    {
+        uint32_t payload_size;  //< Maximum size of the serialized payload data
+        uint32_t count;         //< Number of payloads
+    };
+
     DataSharingPayloadPool() = default;
 
     ~DataSharingPayloadPool() = default;
@@ -61,6 +69,15 @@ public:
     static std::shared_ptr<DataSharingPayloadPool> get_writer_pool(
             const PoolConfig& config);
 
+    /**
+     * Get a writer pool whose payloads are split into size classes.
+     * @param config Configuration of the pool. Only the memory policy is used when @c size_classes is not empty.
+     * @param size_classes Size classes of the payloads. When empty, all the payloads have the size on @c config.
+     */
+    static std::shared_ptr<DataSharingPayloadPool> get_writer_pool(
+            const PoolConfig& config,
+            const std::vector<SizeClass>& size_classes);
+
     static std::string get_default_directory()
     {
         std::string dir;
@@ -26,7 +26,9 @@
 #include <rtps/DataSharing/DataSharingPayloadPool.hpp>
 #include <utils/collections/FixedSizeQueue.hpp>
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -37,14 +39,41 @@ class WriterPool : public DataSharingPayloadPool
 
 public:
 
+    /**
+     * @param pool_size Number of payloads in the pool, when no size classes are given.
+     * @param payload_size Maximum size of the serialized payloads, when no size classes are given.
+     * @param size_classes Size classes the payloads of the pool are split into.
+     * When not empty, @c pool_size and @c payload_size are ignored, and each payload is taken from the smallest
+     * class able to hold it.
+     */
     WriterPool(
             uint32_t pool_size,
-            uint32_t payload_size)
-        : max_data_size_(payload_size)
-        , pool_size_(pool_size)
+            uint32_t payload_size,
+            const std::vector<SizeClass>& size_classes = {})
+        : pool_size_(pool_size)
         , free_history_size_(0)
         , writer_(nullptr)
     {
+        if (size_classes.empty())
+        {
+            add_size_class(payload_size, pool_size);
+        }
+        else
+        {
+            std::vector<SizeClass> sorted_classes(size_classes);
+            std::sort(sorted_classes.begin(), sorted_classes.end(),
+                    [](const SizeClass& a, const SizeClass& b)
+                    {
+                        return a.payload_size < b.payload_size;
+                    });
+
+            pool_size_ = 0;
+            for (const SizeClass& size_class : sorted_classes)
+            {
+                add_size_class(size_class.payload_size, size_class.count);
+                pool_size_ += size_class.count;
+            }
+        }
     }
 
     ~WriterPool()
@@ -60,24 +89,30 @@ public:
     }
 
     bool get_payload(
-            uint32_t /*size*/,
+            uint32_t size,
             CacheChange_t& cache_change) override
     {
-        if (free_payloads_.empty())
+        // Classes are sorted by size, so the payload is taken from the smallest class with free payloads
+        for (SizeClassPool& size_class : size_classes_)
         {
-            return false;
-        }
+            if (size_class.payload_size < size || size_class.free_payloads->empty())
+            {
+                continue;
+            }
 
-        PayloadNode* payload = free_payloads_.front();
-        free_payloads_.pop_front();
-        // Reset all the metadata to signal the reader that the payload is dirty
-        payload->reset();
+            PayloadNode* payload = size_class.free_payloads->front();
+            size_class.free_payloads->pop_front();
+            // Reset all the metadata to signal the reader that the payload is dirty
+            payload->reset();
 
-        cache_change.serializedPayload.data = payload->data();
-        cache_change.serializedPayload.max_size = max_data_size_;
-        cache_change.payload_owner(this);
+            cache_change.serializedPayload.data = payload->data();
+            cache_change.serializedPayload.max_size = size_class.payload_size;
+            cache_change.payload_owner(this);
 
-        return true;
+            return true;
+        }
+
+        return false;
     }
 
     bool get_payload(
@@ -132,7 +167,7 @@ public:
         }
         else
         {
-            free_payloads_.push_back(payload);
+            free_payload(payload);
         }
         EPROSIMA_LOG_INFO(DATASHARING_PAYLOADPOOL, "Change released with SN " << cache_change.sequenceNumber);
 
@@ -148,7 +183,6 @@ public:
         segment_id_ = writer_->getGuid();
         segment_name_ = generate_segment_name(shared_dir, segment_id_);
         std::unique_ptr<T> local_segment;
-        size_t payload_size;
         uint64_t estimated_size_for_payloads_pool;
         uint64_t estimated_size_for_history;
         uint32_t size_for_payloads_pool;
@@ -160,9 +194,13 @@ public:
             bool overflow = false;
             size_t per_allocation_extra_size = T::compute_per_allocation_extra_size(
                 alignof(PayloadNode), DataSharingPayloadPool::domain_name());
-            payload_size = DataSharingPayloadPool::node_size(max_data_size_);
-
-            estimated_size_for_payloads_pool = pool_size_ * payload_size;
+            estimated_size_for_payloads_pool = 0;
+            for (const SizeClassPool& size_class : size_classes_)
+            {
+                estimated_size_for_payloads_pool +=
+                        static_cast<uint64_t>(size_class.count) *
+                        DataSharingPayloadPool::node_size(size_class.payload_size);
+            }
             overflow |= (estimated_size_for_payloads_pool != static_cast<uint32_t>(estimated_size_for_payloads_pool));
             size_for_payloads_pool = static_cast<uint32_t>(estimated_size_for_payloads_pool);
 
@@ -210,17 +248,23 @@ public:
             // which is not considered in sizeof(PayloadNode).
             payloads_pool_ = static_cast<octet*>(local_segment->get().allocate(size_for_payloads_pool));
 
-            // Initialize each node in the pool
-            free_payloads_.init(pool_size_);
+            // Initialize each node in the pool. Nodes of each size class are contiguous.
             octet* payload = payloads_pool_;
-            for (uint32_t i = 0; i < pool_size_; ++i)
+            for (SizeClassPool& size_class : size_classes_)
             {
-                new (payload) PayloadNode();
+                size_t payload_size = DataSharingPayloadPool::node_size(size_class.payload_size);
+                size_class.begin = payload;
+                size_class.free_payloads->init(size_class.count);
+                for (uint32_t i = 0; i < size_class.count; ++i)
+                {
+                    new (payload) PayloadNode();
 
-                // All payloads are free
-                free_payloads_.push_back(reinterpret_cast<PayloadNode*>(payload));
+                    // All payloads are free
+                    size_class.free_payloads->push_back(reinterpret_cast<PayloadNode*>(payload));
 
-                payload += (ptrdiff_t)payload_size;
+                    payload += (ptrdiff_t)payload_size;
+                }
+                size_class.end = payload;
             }
 
             //Alloc the memory for the history
@@ -335,7 +379,7 @@ public:
             }
 
             payload->has_been_removed(false);
-            free_payloads_.push_back(payload);
+            free_payload(payload);
             advance(descriptor_->notified_begin);
             ++free_history_size_;
         }
@@ -355,13 +399,52 @@ private:
 
     using DataSharingPayloadPool::init_shared_memory;
 
+    //! Payloads of a size class
+    struct SizeClassPool
+    {
+        uint32_t payload_size;  //< Maximum size of the serialized payload data on the class
+        uint32_t count;         //< Number of payloads on the class
+        octet* begin;           //< First node of the class in the shared pool
+        octet* end;             //< End of the last node of the class in the shared pool
+        std::unique_ptr<FixedSizeQueue<PayloadNode*>> free_payloads;    //< Pointers to the free payloads of the class
+    };
+
+    void add_size_class(
+            uint32_t payload_size,
+            uint32_t count)
+    {
+        size_classes_.emplace_back();
+        SizeClassPool& size_class = size_classes_.back();
+        size_class.payload_size = payload_size;
+        size_class.count = count;
+        size_class.begin = nullptr;
+        size_class.end = nullptr;
+        size_class.free_payloads.reset(new FixedSizeQueue<PayloadNode*>());
+    }
+
+    //! Return a payload to the free queue of its size class
+    void free_payload(
+            PayloadNode* payload)
+    {
+        octet* address = reinterpret_cast<octet*>(payload);
+        for (SizeClassPool& size_class : size_classes_)
+        {
+            if (address >= size_class.begin && address < size_class.end)
+            {
+                size_class.free_payloads->push_back(payload);
+                return;
+            }
+        }
+
+        assert(false);
+    }
+
     octet* payloads_pool_;          //< Shared pool of payloads
 
-    uint32_t max_data_size_;        //< Maximum size of the serialized payload data
     uint32_t pool_size_;            //< Number of payloads in the pool
     uint32_t free_history_size_;    //< Number of elements currently unused in the shared history
 
-    FixedSizeQueue<PayloadNode*> free_payloads_;    //< Pointers to the free payloads in the pool
+    std::vector<SizeClassPool> size_classes_;       //< Size classes of the pool, sorted by payload size
 
     const RTPSWriter* writer_;      //< Writer that is owner of the pool
 
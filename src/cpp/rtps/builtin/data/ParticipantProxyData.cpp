@@ -20,6 +20,7 @@
 #include <fastdds/rtps/builtin/data/ParticipantProxyData.h>
 
 #include <chrono>
+#include <cstring>
 #include <mutex>
 
 #include <fastdds/core/policy/ParameterList.hpp>
@@ -104,6 +105,8 @@ ParticipantProxyData::ParticipantProxyData(
     , m_readers(nullptr)
     , m_writers(nullptr)
     , m_sample_identity(pdata.m_sample_identity)
+    , m_serialized_hash(pdata.m_serialized_hash)
+    , m_serialized_payload(pdata.m_serialized_payload)
     , lease_duration_(pdata.lease_duration_)
 {
 }
@@ -762,6 +765,8 @@ void ParticipantProxyData::clear()
     m_properties.length = 0;
     m_userData.clear();
     m_userData.length = 0;
+    m_serialized_hash = 0;
+    m_serialized_payload.clear();
 }
 
 void ParticipantProxyData::copy(
@@ -783,6 +788,8 @@ void ParticipantProxyData::copy(
     m_userData = pdata.m_userData;
     m_properties = pdata.m_properties;
     m_sample_identity = pdata.m_sample_identity;
+    m_serialized_hash = pdata.m_serialized_hash;
+    m_serialized_payload = pdata.m_serialized_payload;
 
     // This method is only called when a new participant is discovered.The destination of the copy
     // will always be a new ParticipantProxyData or one from the pool, so there is no need for
@@ -805,6 +812,8 @@ bool ParticipantProxyData::updateData(
     isAlive = true;
     m_userData = pdata.m_userData;
     m_properties = pdata.m_properties;
+    m_serialized_hash = pdata.m_serialized_hash;
+    m_serialized_payload = pdata.m_serialized_payload;
 #if HAVE_SECURITY
     identity_token_ = pdata.identity_token_;
     permissions_token_ = pdata.permissions_token_;
@@ -829,6 +838,23 @@ bool ParticipantProxyData::updateData(
     return true;
 }
 
+void ParticipantProxyData::serialized_payload(
+        const SerializedPayload_t& payload,
+        uint64_t hash)
+{
+    m_serialized_hash = hash;
+    m_serialized_payload.assign(payload.data, payload.data + payload.length);
+}
+
+bool ParticipantProxyData::is_read_from(
+        const SerializedPayload_t& payload,
+        uint64_t hash) const
+{
+    return (0 != m_serialized_hash) && (hash == m_serialized_hash) &&
+           (payload.length == m_serialized_payload.size()) &&
+           ((0 == payload.length) || (0 == memcmp(m_serialized_payload.data(), payload.data, payload.length)));
+}
+
 void ParticipantProxyData::set_persistence_guid(
         const GUID_t& guid)
 {
@@ -17,6 +17,8 @@
  *
  */
 
+#include <cstring>
+
 #include <fastdds/core/policy/ParameterList.hpp>
 #include <fastdds/core/policy/QosPoliciesSerializer.hpp>
 #include <fastdds/dds/log/Log.hpp>
@@ -105,6 +107,8 @@ ReaderProxyData::ReaderProxyData(
     , m_type_information(nullptr)
     , m_properties(readerInfo.m_properties)
     , content_filter_(readerInfo.content_filter_)
+    , serialized_hash_(readerInfo.serialized_hash_)
+    , serialized_payload_(readerInfo.serialized_payload_)
 {
     if (readerInfo.m_type_id)
     {
@@ -146,6 +150,8 @@ ReaderProxyData& ReaderProxyData::operator =(
     m_qos.setQos(readerInfo.m_qos, true);
     m_properties = readerInfo.m_properties;
     content_filter_ = readerInfo.content_filter_;
+    serialized_hash_ = readerInfo.serialized_hash_;
+    serialized_payload_ = readerInfo.serialized_payload_;
 
     if (readerInfo.m_type_id)
     {
@@ -1166,6 +1172,8 @@ void ReaderProxyData::clear()
     content_filter_.related_topic_name = "";
     content_filter_.filter_expression = "";
     content_filter_.expression_parameters.clear();
+    serialized_hash_ = 0;
+    serialized_payload_.clear();
 
     if (m_type_id)
     {
@@ -1206,6 +1214,8 @@ void ReaderProxyData::update(
     m_isAlive = rdata->m_isAlive;
     m_expectsInlineQos = rdata->m_expectsInlineQos;
     content_filter_ = rdata->content_filter_;
+    serialized_hash_ = rdata->serialized_hash_;
+    serialized_payload_ = rdata->serialized_payload_;
 }
 
 void ReaderProxyData::copy(
@@ -1225,6 +1235,8 @@ void ReaderProxyData::copy(
     m_topicKind = rdata->m_topicKind;
     m_properties = rdata->m_properties;
     content_filter_ = rdata->content_filter_;
+    serialized_hash_ = rdata->serialized_hash_;
+    serialized_payload_ = rdata->serialized_payload_;
 
     if (rdata->m_type_id)
     {
@@ -1257,6 +1269,23 @@ void ReaderProxyData::copy(
     }
 }
 
+void ReaderProxyData::serialized_payload(
+        const SerializedPayload_t& payload,
+        uint64_t hash)
+{
+    serialized_hash_ = hash;
+    serialized_payload_.assign(payload.data, payload.data + payload.length);
+}
+
+bool ReaderProxyData::is_read_from(
+        const SerializedPayload_t& payload,
+        uint64_t hash) const
+{
+    return (0 != serialized_hash_) && (hash == serialized_hash_) &&
+           (payload.length == serialized_payload_.size()) &&
+           ((0 == payload.length) || (0 == memcmp(serialized_payload_.data(), payload.data, payload.length)));
+}
+
 void ReaderProxyData::add_unicast_locator(
         const Locator_t& locator)
 {
@@ -17,6 +17,8 @@
  *
  */
 
+#include <cstring>
+
 #include <fastdds/core/policy/ParameterList.hpp>
 #include <fastdds/core/policy/QosPoliciesSerializer.hpp>
 #include <fastdds/dds/log/Log.hpp>
@@ -90,6 +92,8 @@ WriterProxyData::WriterProxyData(
     , m_type(nullptr)
     , m_type_information(nullptr)
     , m_properties(writerInfo.m_properties)
+    , serialized_hash_(writerInfo.serialized_hash_)
+    , serialized_payload_(writerInfo.serialized_payload_)
 {
     if (writerInfo.m_type_id)
     {
@@ -138,6 +142,8 @@ WriterProxyData& WriterProxyData::operator =(
     persistence_guid_ = writerInfo.persistence_guid_;
     m_qos.setQos(writerInfo.m_qos, true);
     m_properties = writerInfo.m_properties;
+    serialized_hash_ = writerInfo.serialized_hash_;
+    serialized_payload_ = writerInfo.serialized_payload_;
 
     if (writerInfo.m_type_id)
     {
@@ -1152,6 +1158,8 @@ void WriterProxyData::clear()
     persistence_guid_ = c_Guid_Unknown;
     m_properties.clear();
     m_properties.length = 0;
+    serialized_hash_ = 0;
+    serialized_payload_.clear();
 
     if (m_type_id)
     {
@@ -1183,6 +1191,8 @@ void WriterProxyData::copy(
     m_topicKind = wdata->m_topicKind;
     persistence_guid_ = wdata->persistence_guid_;
     m_properties = wdata->m_properties;
+    serialized_hash_ = wdata->serialized_hash_;
+    serialized_payload_ = wdata->serialized_payload_;
 
     if (wdata->m_type_id)
     {
@@ -1239,6 +1249,25 @@ void WriterProxyData::update(
     // m_networkConfiguration = wdata->m_networkConfiguration; // TODO: update?
     remote_locators_ = wdata->remote_locators_;
     m_qos.setQos(wdata->m_qos, false);
+    serialized_hash_ = wdata->serialized_hash_;
+    serialized_payload_ = wdata->serialized_payload_;
+}
+
+void WriterProxyData::serialized_payload(
+        const SerializedPayload_t& payload,
+        uint64_t hash)
+{
+    serialized_hash_ = hash;
+    serialized_payload_.assign(payload.data, payload.data + payload.length);
+}
+
+bool WriterProxyData::is_read_from(
+        const SerializedPayload_t& payload,
+        uint64_t hash) const
+{
+    return (0 != serialized_hash_) && (hash == serialized_hash_) &&
+           (payload.length == serialized_payload_.size()) &&
+           ((0 == payload.length) || (0 == memcmp(serialized_payload_.data(), payload.data, payload.length)));
 }
 
 void WriterProxyData::add_unicast_locator(
@@ -25,6 +25,7 @@
 #include <fastdds/rtps/common/GuidPrefix_t.hpp>
 #include <fastdds/rtps/common/RemoteLocators.hpp>
 #include <statistics/rtps/GuidUtils.hpp>
+#include <utils/threading.hpp>
 
 #include <rtps/builtin/discovery/database/DiscoveryDataBase.hpp>
 
@@ -45,12 +46,16 @@ DiscoveryDataBase::DiscoveryDataBase(
     , enabled_(true)
     , new_updates_(0)
     , processing_backup_(false)
+    , restoring_backup_queue_(false)
     , is_persistent_(false)
+    , backup_queue_size_(0)
 {
 }
 
 DiscoveryDataBase::~DiscoveryDataBase()
 {
+    stop_matching_workers();
+
     if (!clear().empty())
     {
         EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Destroying a NOT cleared database");
@@ -122,14 +127,19 @@ std::vector<fastrtps::rtps::CacheChange_t*> DiscoveryDataBase::clear()
 
     /* Clear list of dirty topics */
     dirty_topics_.clear();
+    dirty_topics_index_.clear();
 
     /* Clear disposals list */
     disposals_.clear();
+    disposals_index_.clear();
 
     /* Clear to_send collections */
     pdp_to_send_.clear();
+    pdp_to_send_index_.clear();
     edp_publications_to_send_.clear();
+    edp_publications_to_send_index_.clear();
     edp_subscriptions_to_send_.clear();
+    edp_subscriptions_to_send_index_.clear();
 
     /* Clear writers_ */
     for (auto writers_it = writers_.begin(); writers_it != writers_.end();)
@@ -336,12 +346,7 @@ bool DiscoveryDataBase::update(
     // The own server changes are not stored
     if (is_persistent_ && guid_from_change(change).guidPrefix != server_guid_prefix_)
     {
-        // Does not allow to the server to erase the ddb before this message has been processed
-        std::lock_guard<std::recursive_mutex> guard(data_queues_mutex_);
-        nlohmann::json j;
-        ddb::to_json(j, *change);
-        backup_file_ << j;
-        backup_file_.flush();
+        backup_change_(*change);
     }
 
     if (!enabled_)
@@ -368,12 +373,7 @@ bool DiscoveryDataBase::update(
     // in case the ddb is persistent, we store every cache in queue in a file
     if (is_persistent_ && guid_from_change(change).guidPrefix != server_guid_prefix_)
     {
-        // Does not allow to the server to erase the ddb before this message has been process
-        std::lock_guard<std::recursive_mutex> guard(data_queues_mutex_);
-        nlohmann::json j;
-        ddb::to_json(j, *change);
-        backup_file_ << j;
-        backup_file_.flush();
+        backup_change_(*change);
     }
 
     if (!enabled_)
@@ -406,6 +406,7 @@ void DiscoveryDataBase::clear_changes_to_dispose()
     // lock(exclusive mode) mutex locally
     std::lock_guard<std::recursive_mutex> guard(mutex_);
     disposals_.clear();
+    disposals_index_.clear();
 }
 
 ////////////
@@ -422,6 +423,7 @@ void DiscoveryDataBase::clear_pdp_to_send()
     // lock(exclusive mode) mutex locally
     std::lock_guard<std::recursive_mutex> guard(mutex_);
     pdp_to_send_.clear();
+    pdp_to_send_index_.clear();
 }
 
 const std::vector<eprosima::fastrtps::rtps::CacheChange_t*> DiscoveryDataBase::edp_publications_to_send()
@@ -436,6 +438,7 @@ void DiscoveryDataBase::clear_edp_publications_to_send()
     // lock(exclusive mode) mutex locally
     std::lock_guard<std::recursive_mutex> guard(mutex_);
     edp_publications_to_send_.clear();
+    edp_publications_to_send_index_.clear();
 }
 
 const std::vector<eprosima::fastrtps::rtps::CacheChange_t*> DiscoveryDataBase::edp_subscriptions_to_send()
@@ -450,6 +453,7 @@ void DiscoveryDataBase::clear_edp_subscriptions_to_send()
     // lock(exclusive mode) mutex locally
     std::lock_guard<std::recursive_mutex> guard(mutex_);
     edp_subscriptions_to_send_.clear();
+    edp_subscriptions_to_send_index_.clear();
 }
 
 const std::vector<eprosima::fastrtps::rtps::CacheChange_t*> DiscoveryDataBase::changes_to_release()
@@ -678,7 +682,7 @@ void DiscoveryDataBase::create_new_participant_from_change_(
 {
     fastrtps::rtps::GUID_t change_guid = guid_from_change(ch);
 
-    std::pair<std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator, bool> ret =
+    std::pair<ParticipantMap::iterator, bool> ret =
             participants_.insert(
         std::make_pair(
             change_guid.guidPrefix,
@@ -863,7 +867,7 @@ void DiscoveryDataBase::create_writers_from_change_(
             topic_name == virtual_topic_,
             server_guid_prefix_);
 
-        std::pair<std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator, bool> ret =
+        std::pair<EndpointMap::iterator, bool> ret =
                 writers_.insert(std::make_pair(writer_guid, tmp_writer));
         if (!ret.second)
         {
@@ -876,7 +880,7 @@ void DiscoveryDataBase::create_writers_from_change_(
         new_updates_++;
 
         // Add entry to participants_[guid_prefix]::writers
-        std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator writer_part_it =
+        ParticipantMap::iterator writer_part_it =
                 participants_.find(writer_guid.guidPrefix);
         if (writer_part_it != participants_.end())
         {
@@ -899,7 +903,7 @@ void DiscoveryDataBase::create_writers_from_change_(
         // if topic is virtual, it must iterate over all readers
         if (topic_name == virtual_topic_)
         {
-            for (auto reader_it : readers_)
+            for (const auto& reader_it : readers_)
             {
                 match_writer_reader_(writer_guid, reader_it.first);
             }
@@ -981,7 +985,7 @@ void DiscoveryDataBase::create_readers_from_change_(
             topic_name == virtual_topic_,
             server_guid_prefix_);
 
-        std::pair<std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator, bool> ret =
+        std::pair<EndpointMap::iterator, bool> ret =
                 readers_.insert(std::make_pair(reader_guid, tmp_reader));
         if (!ret.second)
         {
@@ -994,7 +998,7 @@ void DiscoveryDataBase::create_readers_from_change_(
         new_updates_++;
 
         // Add entry to participants_[guid_prefix]::readers
-        std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator reader_part_it =
+        ParticipantMap::iterator reader_part_it =
                 participants_.find(reader_guid.guidPrefix);
         if (reader_part_it != participants_.end())
         {
@@ -1017,7 +1021,7 @@ void DiscoveryDataBase::create_readers_from_change_(
         // if topic is virtual, it must iterate over all readers
         if (topic_name == virtual_topic_)
         {
-            for (auto writer_it : writers_)
+            for (const auto& writer_it : writers_)
             {
                 match_writer_reader_(writer_it.first, reader_guid);
             }
@@ -1201,24 +1205,23 @@ bool DiscoveryDataBase::set_dirty_topic_(
     {
         // Set all topics to dirty
         dirty_topics_.clear();
+        dirty_topics_index_.clear();
 
         // It is enough to use writers_by_topic because the topics are simetrical in writers and readers:
         //  if a topic exists in one, it exists in the other
-        for (auto topic_it : writers_by_topic_)
+        for (const auto& topic_it : writers_by_topic_)
         {
             if (topic_it.first != virtual_topic_)
             {
                 dirty_topics_.push_back(topic_it.first);
+                dirty_topics_index_.insert(topic_it.first);
             }
         }
         return true;
     }
     else
     {
-        if (std::find(
-                    dirty_topics_.begin(),
-                    dirty_topics_.end(),
-                    topic) == dirty_topics_.end())
+        if (dirty_topics_index_.insert(topic).second)
         {
             dirty_topics_.push_back(topic);
             return true;
@@ -1233,7 +1236,7 @@ void DiscoveryDataBase::process_dispose_participant_(
     const eprosima::fastrtps::rtps::GUID_t& participant_guid = guid_from_change(ch);
 
     // Change DATA(p) with DATA(Up) in participants map
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator pit =
+    ParticipantMap::iterator pit =
             participants_.find(participant_guid.guidPrefix);
     if (pit != participants_.end())
     {
@@ -1291,10 +1294,7 @@ void DiscoveryDataBase::process_dispose_participant_(
     unmatch_participant_(participant_guid.guidPrefix);
 
     // Add entry to disposals_
-    if (std::find(disposals_.begin(), disposals_.end(), ch) == disposals_.end())
-    {
-        disposals_.push_back(ch);
-    }
+    add_disposal_(ch);
 }
 
 void DiscoveryDataBase::process_dispose_writer_(
@@ -1303,7 +1303,7 @@ void DiscoveryDataBase::process_dispose_writer_(
     const eprosima::fastrtps::rtps::GUID_t& writer_guid = guid_from_change(ch);
 
     // Check if the writer is still alive (if DATA(Up) is processed before it will be erased)
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator wit = writers_.find(writer_guid);
+    EndpointMap::iterator wit = writers_.find(writer_guid);
     if (wit != writers_.end())
     {
         // Change DATA(w) with DATA(Uw)
@@ -1315,10 +1315,7 @@ void DiscoveryDataBase::process_dispose_writer_(
         // Add entry to disposals_
         if (wit->second.topic() != virtual_topic_)
         {
-            if (std::find(disposals_.begin(), disposals_.end(), ch) == disposals_.end())
-            {
-                disposals_.push_back(ch);
-            }
+            add_disposal_(ch);
         }
 
         // Any change in the entities known must be reported as a change in the discovery
@@ -1333,7 +1330,7 @@ void DiscoveryDataBase::process_dispose_reader_(
 
     // Check if the writer is still alive (if DATA(Up) is processed before it will be erased)
 
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator rit = readers_.find(reader_guid);
+    EndpointMap::iterator rit = readers_.find(reader_guid);
     if (rit != readers_.end())
     {
         // Change DATA(r) with DATA(Ur)
@@ -1345,10 +1342,7 @@ void DiscoveryDataBase::process_dispose_reader_(
         // Add entry to disposals_
         if (rit->second.topic() != virtual_topic_)
         {
-            if (std::find(disposals_.begin(), disposals_.end(), ch) == disposals_.end())
-            {
-                disposals_.push_back(ch);
-            }
+            add_disposal_(ch);
         }
 
         // Any change in the entities known must be reported as a change in the discovery
@@ -1368,135 +1362,307 @@ bool DiscoveryDataBase::process_dirty_topics()
     // Get shared lock
     std::lock_guard<std::recursive_mutex> guard(mutex_);
 
-    // Iterator objects are declared here because they are reused in each iteration of the loops
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator parts_reader_it;
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator parts_writer_it;
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator readers_it;
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator writers_it;
+    if (topic_match_results_.size() < dirty_topics_.size())
+    {
+        topic_match_results_.resize(dirty_topics_.size());
+    }
+
+    if (!matching_workers_.empty() && dirty_topics_.size() > 1)
+    {
+        // Shard the dirty topics by the hash of their name
+        uint32_t num_shards = static_cast<uint32_t>(matching_workers_.size() + 1);
+        topic_match_shards_.resize(dirty_topics_.size());
+        for (size_t i = 0; i < dirty_topics_.size(); ++i)
+        {
+            topic_match_shards_[i] = static_cast<uint32_t>(std::hash<std::string>()(dirty_topics_[i]) % num_shards);
+        }
+
+        {
+            std::lock_guard<std::mutex> matching_guard(matching_mutex_);
+            ++matching_round_;
+            matching_pending_ = num_shards - 1;
+            matching_claimed_.assign(num_shards, false);
+        }
+        matching_cv_.notify_all();
+
+        match_shard_(0);
+
+        // Match the shards no worker has started yet, so only the shards being matched are waited for
+        std::unique_lock<std::mutex> matching_lock(matching_mutex_);
+        for (uint32_t shard = 1; shard < num_shards; ++shard)
+        {
+            if (!matching_claimed_[shard])
+            {
+                matching_claimed_[shard] = true;
+                matching_lock.unlock();
+                match_shard_(shard);
+                matching_lock.lock();
+                --matching_pending_;
+            }
+        }
+        matching_done_cv_.wait(matching_lock, [this]()
+                {
+                    return 0 == matching_pending_;
+                });
+    }
+    else
+    {
+        for (size_t i = 0; i < dirty_topics_.size(); ++i)
+        {
+            match_topic_(dirty_topics_[i], topic_match_results_[i]);
+        }
+    }
 
-    // Iterate over dirty_topics_
-    for (auto topic_it = dirty_topics_.begin(); topic_it != dirty_topics_.end();)
+    // Apply the results following the order of dirty_topics_, removing the topics that can be cleared
+    size_t still_dirty = 0;
+    for (size_t i = 0; i < dirty_topics_.size(); ++i)
     {
-        EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Processing topic: " << *topic_it);
-        // Flag to store whether a topic can be cleared.
-        bool is_clearable = true;
+        const TopicMatchResult& result = topic_match_results_[i];
+        apply_topic_match_(result);
 
-        // Get all the writers in the topic
-        std::vector<fastrtps::rtps::GUID_t> writers;
-        auto ret = writers_by_topic_.find(*topic_it);
-        if (ret != writers_by_topic_.end())
+        // Check whether the topic is still dirty or it can be cleared
+        if (result.is_clearable)
         {
-            writers = ret->second;
+            // Delete topic from dirty_topics_
+            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Topic " << dirty_topics_[i] << " has been cleaned");
+            dirty_topics_index_.erase(dirty_topics_[i]);
         }
-        // Get all the readers in the topic
-        std::vector<fastrtps::rtps::GUID_t> readers;
-        ret = readers_by_topic_.find(*topic_it);
-        if (ret != readers_by_topic_.end())
+        else
         {
-            readers = ret->second;
+            // Proceed with next topic
+            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Topic " << dirty_topics_[i] << " is still dirty");
+            if (still_dirty != i)
+            {
+                dirty_topics_[still_dirty] = std::move(dirty_topics_[i]);
+            }
+            ++still_dirty;
         }
+    }
+    dirty_topics_.resize(still_dirty);
+
+    // Return whether there still are dirty topics
+    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Are there dirty topics? " << !dirty_topics_.empty());
+
+    return !dirty_topics_.empty();
+}
+
+void DiscoveryDataBase::match_topic_(
+        const std::string& topic,
+        TopicMatchResult& result) const
+{
+    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Processing topic: " << topic);
+    result.clear();
+
+    // Get all the writers and readers in the topic
+    auto writers_topic_it = writers_by_topic_.find(topic);
+    auto readers_topic_it = readers_by_topic_.find(topic);
+    if (writers_topic_it == writers_by_topic_.end() || readers_topic_it == readers_by_topic_.end())
+    {
+        return;
+    }
+
+    auto add_change = [&result](
+        std::vector<fastrtps::rtps::CacheChange_t*>& to_send,
+        fastrtps::rtps::CacheChange_t* change)
+            {
+                if (result.added.insert(change).second)
+                {
+                    to_send.push_back(change);
+                }
+            };
+
+    // Iterate over readers in the topic:
+    for (const fastrtps::rtps::GUID_t& reader : readers_topic_it->second)
+    {
+        EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "[" << topic << "]" << " Processing reader: " << reader);
+
+        // Find participant with reader info in participants_ and reader info in readers_
+        ParticipantMap::const_iterator parts_reader_it = participants_.find(reader.guidPrefix);
+        EndpointMap::const_iterator readers_it = readers_.find(reader);
 
-        for (fastrtps::rtps::GUID_t writer: writers)
         // Iterate over writers in the topic:
+        for (const fastrtps::rtps::GUID_t& writer : writers_topic_it->second)
         {
-            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "[" << *topic_it << "]" << " Processing writer: " << writer);
-            // Iterate over readers in the topic:
-            for (fastrtps::rtps::GUID_t reader : readers)
+            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "[" << topic << "]" << " Processing writer: " << writer);
+
+            // Check in `participants_` whether the client with the reader has acknowledge the PDP of the client
+            // with the writer.
+            if (parts_reader_it != participants_.end())
             {
-                EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "[" << *topic_it << "]" << " Processing reader: " << reader);
-                // Find participants with writer info and participant with reader info in participants_
-                parts_reader_it = participants_.find(reader.guidPrefix);
-                parts_writer_it = participants_.find(writer.guidPrefix);
-                // Find reader info in readers_
-                readers_it = readers_.find(reader);
-                // Find writer info in writers_
-                writers_it = writers_.find(writer);
-
-                // Check in `participants_` whether the client with the reader has acknowledge the PDP of the client
-                // with the writer.
-                if (parts_reader_it != participants_.end())
+                if (parts_reader_it->second.is_matched(writer.guidPrefix))
                 {
-                    if (parts_reader_it->second.is_matched(writer.guidPrefix))
+                    // Check the status of the writer in `readers_[reader]::relevant_participants_builtin_ack_status`.
+                    if (readers_it != readers_.end() &&
+                            readers_it->second.is_relevant_participant(writer.guidPrefix) &&
+                            !readers_it->second.is_matched(writer.guidPrefix))
                     {
-                        // Check the status of the writer in `readers_[reader]::relevant_participants_builtin_ack_status`.
-                        if (readers_it != readers_.end() &&
-                                readers_it->second.is_relevant_participant(writer.guidPrefix) &&
-                                !readers_it->second.is_matched(writer.guidPrefix))
-                        {
-                            // If the status is 0, add DATA(r) to a `edp_publications_to_send_` (if it's not there).
-                            if (add_edp_subscriptions_to_send_(readers_it->second.change()))
-                            {
-                                EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind DATA(r) to send: "
-                                        << readers_it->second.change()->instanceHandle);
-                            }
-                        }
-                    }
-                    else if (parts_reader_it->second.is_relevant_participant(writer.guidPrefix))
-                    {
-                        // Add DATA(p) of the client with the writer to `pdp_to_send_` (if it's not there).
-                        if (add_pdp_to_send_(parts_reader_it->second.change()))
-                        {
-                            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind readers' DATA(p) to send: "
-                                    << parts_reader_it->second.change()->instanceHandle);
-                        }
-                        // Set topic as not-clearable.
-                        is_clearable = false;
+                        // If the status is 0, add DATA(r) to a `edp_publications_to_send_` (if it's not there).
+                        add_change(result.edp_subscriptions_to_send, readers_it->second.change());
                     }
                 }
+                else if (parts_reader_it->second.is_relevant_participant(writer.guidPrefix))
+                {
+                    // Add DATA(p) of the client with the writer to `pdp_to_send_` (if it's not there).
+                    add_change(result.pdp_to_send, parts_reader_it->second.change());
+                    // Set topic as not-clearable.
+                    result.is_clearable = false;
+                }
+            }
 
-                // Check in `participants_` whether the client with the writer has acknowledge the PDP of the client
-                // with the reader.
-                if (parts_writer_it != participants_.end())
+            // Find participant with writer info in participants_ and writer info in writers_
+            ParticipantMap::const_iterator parts_writer_it = participants_.find(writer.guidPrefix);
+            EndpointMap::const_iterator writers_it = writers_.find(writer);
+
+            // Check in `participants_` whether the client with the writer has acknowledge the PDP of the client
+            // with the reader.
+            if (parts_writer_it != participants_.end())
+            {
+                if (parts_writer_it->second.is_matched(reader.guidPrefix))
                 {
-                    if (parts_writer_it->second.is_matched(reader.guidPrefix))
-                    {
-                        // Check the status of the reader in `writers_[writer]::relevant_participants_builtin_ack_status`.
-                        if (writers_it != writers_.end() &&
-                                writers_it->second.is_relevant_participant(reader.guidPrefix) &&
-                                !writers_it->second.is_matched(reader.guidPrefix))
-                        {
-                            // If the status is 0, add DATA(w) to a `edp_subscriptions_to_send_` (if it's not there).
-                            if (add_edp_publications_to_send_(writers_it->second.change()))
-                            {
-                                EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind DATA(w) to send: "
-                                        << writers_it->second.change()->instanceHandle);
-                            }
-                        }
-                    }
-                    else if (parts_writer_it->second.is_relevant_participant(reader.guidPrefix))
+                    // Check the status of the reader in `writers_[writer]::relevant_participants_builtin_ack_status`.
+                    if (writers_it != writers_.end() &&
+                            writers_it->second.is_relevant_participant(reader.guidPrefix) &&
+                            !writers_it->second.is_matched(reader.guidPrefix))
                     {
-                        // Add DATA(p) of the client with the reader to `pdp_to_send_` (if it's not there).
-                        if (add_pdp_to_send_(parts_writer_it->second.change()))
-                        {
-                            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind writers' DATA(p) to send: "
-                                    << parts_writer_it->second.change()->instanceHandle);
-                        }
-                        // Set topic as not-clearable.
-                        is_clearable = false;
+                        // If the status is 0, add DATA(w) to a `edp_subscriptions_to_send_` (if it's not there).
+                        add_change(result.edp_publications_to_send, writers_it->second.change());
                     }
                 }
+                else if (parts_writer_it->second.is_relevant_participant(reader.guidPrefix))
+                {
+                    // Add DATA(p) of the client with the reader to `pdp_to_send_` (if it's not there).
+                    add_change(result.pdp_to_send, parts_writer_it->second.change());
+                    // Set topic as not-clearable.
+                    result.is_clearable = false;
+                }
             }
         }
+    }
+}
 
-        // Check whether the topic is still dirty or it can be cleared
-        if (is_clearable)
+void DiscoveryDataBase::apply_topic_match_(
+        const TopicMatchResult& result)
+{
+    for (fastrtps::rtps::CacheChange_t* change : result.edp_subscriptions_to_send)
+    {
+        if (add_edp_subscriptions_to_send_(change))
         {
-            // Delete topic from dirty_topics_
-            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Topic " << *topic_it << " has been cleaned");
-            topic_it = dirty_topics_.erase(topic_it);
+            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind DATA(r) to send: " << change->instanceHandle);
         }
-        else
+    }
+
+    for (fastrtps::rtps::CacheChange_t* change : result.edp_publications_to_send)
+    {
+        if (add_edp_publications_to_send_(change))
         {
-            // Proceed with next topic
-            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Topic " << *topic_it << " is still dirty");
-            ++topic_it;
+            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind DATA(w) to send: " << change->instanceHandle);
         }
     }
 
-    // Return whether there still are dirty topics
-    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Are there dirty topics? " << !dirty_topics_.empty());
+    for (fastrtps::rtps::CacheChange_t* change : result.pdp_to_send)
+    {
+        if (add_pdp_to_send_(change))
+        {
+            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind DATA(p) to send: " << change->instanceHandle);
+        }
+    }
+}
 
-    return !dirty_topics_.empty();
+void DiscoveryDataBase::match_shard_(
+        uint32_t shard)
+{
+    for (size_t i = 0; i < dirty_topics_.size(); ++i)
+    {
+        if (shard == topic_match_shards_[i])
+        {
+            match_topic_(dirty_topics_[i], topic_match_results_[i]);
+        }
+    }
+}
+
+void DiscoveryDataBase::start_matching_workers(
+        uint32_t num_workers,
+        const fastdds::rtps::ThreadSettings& thread_settings,
+        uint32_t id_for_thread)
+{
+    std::lock_guard<std::recursive_mutex> guard(mutex_);
+    if (!matching_workers_.empty())
+    {
+        return;
+    }
+
+    uint64_t round = 0;
+    {
+        std::lock_guard<std::mutex> matching_guard(matching_mutex_);
+        matching_stop_ = false;
+        round = matching_round_;
+    }
+
+    matching_workers_.reserve(num_workers);
+    for (uint32_t i = 1; i <= num_workers; ++i)
+    {
+        matching_workers_.push_back(create_thread([this, i, round]()
+                {
+                    run_matching_worker_(i, round);
+                }, thread_settings, "dds.ds_mt.%u.%u", id_for_thread, i));
+    }
+}
+
+void DiscoveryDataBase::stop_matching_workers()
+{
+    {
+        std::lock_guard<std::mutex> matching_guard(matching_mutex_);
+        matching_stop_ = true;
+    }
+    matching_cv_.notify_all();
+
+    for (auto& worker : matching_workers_)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+    matching_workers_.clear();
+}
+
+void DiscoveryDataBase::run_matching_worker_(
+        uint32_t shard,
+        uint64_t last_round)
+{
+    std::unique_lock<std::mutex> matching_lock(matching_mutex_);
+    while (true)
+    {
+        matching_cv_.wait(matching_lock, [this, last_round]()
+                {
+                    return matching_stop_ || last_round != matching_round_;
+                });
+
+        if (matching_stop_)
+        {
+            break;
+        }
+
+        last_round = matching_round_;
+
+        // The thread that started the round may have already matched this shard
+        if (matching_claimed_[shard])
+        {
+            continue;
+        }
+        matching_claimed_[shard] = true;
+        matching_lock.unlock();
+
+        // The thread that started the round holds mutex_ until every shard has been processed, so the database is
+        // not modified meanwhile
+        match_shard_(shard);
+
+        matching_lock.lock();
+        if (0 == --matching_pending_)
+        {
+            matching_done_cv_.notify_one();
+        }
+    }
 }
 
 bool DiscoveryDataBase::delete_entity_of_change(
@@ -1616,7 +1782,7 @@ const std::vector<fastrtps::rtps::GuidPrefix_t> DiscoveryDataBase::direct_client
 
     std::vector<fastrtps::rtps::GuidPrefix_t> direct_clients_and_servers;
     // Iterate over participants to add the remote ones that are direct clients or servers
-    for (auto participant: participants_)
+    for (const auto& participant: participants_)
     {
         // Only add participants other than the server
         if (server_guid_prefix_ != participant.first)
@@ -1969,7 +2135,7 @@ void DiscoveryDataBase::remove_writer_from_topic_(
 {
     if (topic_name == virtual_topic_)
     {
-        std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>::iterator topic_it;
+        TopicMap::iterator topic_it;
         for (topic_it = writers_by_topic_.begin(); topic_it != writers_by_topic_.end(); topic_it++)
         {
             for (std::vector<eprosima::fastrtps::rtps::GUID_t>::iterator writer_it = topic_it->second.begin();
@@ -1986,7 +2152,7 @@ void DiscoveryDataBase::remove_writer_from_topic_(
     }
     else
     {
-        std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>::iterator topic_it =
+        TopicMap::iterator topic_it =
                 writers_by_topic_.find(topic_name);
         if (topic_it != writers_by_topic_.end())
         {
@@ -2017,7 +2183,7 @@ void DiscoveryDataBase::remove_reader_from_topic_(
 
     if (topic_name == virtual_topic_)
     {
-        std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>::iterator topic_it;
+        TopicMap::iterator topic_it;
         for (topic_it = readers_by_topic_.begin(); topic_it != readers_by_topic_.end(); topic_it++)
         {
             for (std::vector<eprosima::fastrtps::rtps::GUID_t>::iterator reader_it = topic_it->second.begin();
@@ -2034,7 +2200,7 @@ void DiscoveryDataBase::remove_reader_from_topic_(
     }
     else
     {
-        std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>::iterator topic_it =
+        TopicMap::iterator topic_it =
                 readers_by_topic_.find(topic_name);
         if (topic_it != readers_by_topic_.end())
         {
@@ -2203,9 +2369,9 @@ bool DiscoveryDataBase::delete_participant_entity_(
     return true;
 }
 
-std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator
+DiscoveryDataBase::ParticipantMap::iterator
 DiscoveryDataBase::delete_participant_entity_(
-        std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator it)
+        ParticipantMap::iterator it)
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Deleting participant: " << it->first);
     if (it == participants_.end())
@@ -2230,8 +2396,8 @@ bool DiscoveryDataBase::delete_reader_entity_(
     return true;
 }
 
-std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator DiscoveryDataBase::delete_reader_entity_(
-        std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it)
+DiscoveryDataBase::EndpointMap::iterator DiscoveryDataBase::delete_reader_entity_(
+        EndpointMap::iterator it)
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Deleting reader: " << it->first.guidPrefix);
     if (it == readers_.end())
@@ -2279,8 +2445,8 @@ bool DiscoveryDataBase::delete_writer_entity_(
     return true;
 }
 
-std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator DiscoveryDataBase::delete_writer_entity_(
-        std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it)
+DiscoveryDataBase::EndpointMap::iterator DiscoveryDataBase::delete_writer_entity_(
+        EndpointMap::iterator it)
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Deleting writer: " << it->first.guidPrefix);
     if (it == writers_.end())
@@ -2314,14 +2480,23 @@ std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator Disc
     return writers_.erase(it);
 }
 
+bool DiscoveryDataBase::add_disposal_(
+        eprosima::fastrtps::rtps::CacheChange_t* change)
+{
+    // Add change to disposals if it is not already there
+    if (disposals_index_.insert(change).second)
+    {
+        disposals_.push_back(change);
+        return true;
+    }
+    return false;
+}
+
 bool DiscoveryDataBase::add_pdp_to_send_(
         eprosima::fastrtps::rtps::CacheChange_t* change)
 {
     // Add DATA(p) to send in next iteration if it is not already there
-    if (std::find(
-                pdp_to_send_.begin(),
-                pdp_to_send_.end(),
-                change) == pdp_to_send_.end())
+    if (pdp_to_send_index_.insert(change).second)
     {
         EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind DATA(p) to send: "
                 << change->instanceHandle);
@@ -2335,10 +2510,7 @@ bool DiscoveryDataBase::add_edp_publications_to_send_(
         eprosima::fastrtps::rtps::CacheChange_t* change)
 {
     // Add DATA(w) to send in next iteration if it is not already there
-    if (std::find(
-                edp_publications_to_send_.begin(),
-                edp_publications_to_send_.end(),
-                change) == edp_publications_to_send_.end())
+    if (edp_publications_to_send_index_.insert(change).second)
     {
         EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind DATA(w) to send: "
                 << change->instanceHandle);
@@ -2352,10 +2524,7 @@ bool DiscoveryDataBase::add_edp_subscriptions_to_send_(
         eprosima::fastrtps::rtps::CacheChange_t* change)
 {
     // Add DATA(r) to send in next iteration if it is not already there
-    if (std::find(
-                edp_subscriptions_to_send_.begin(),
-                edp_subscriptions_to_send_.end(),
-                change) == edp_subscriptions_to_send_.end())
+    if (edp_subscriptions_to_send_index_.insert(change).second)
     {
         EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind DATA(r) to send: "
                 << change->instanceHandle);
@@ -2474,7 +2643,7 @@ bool DiscoveryDataBase::from_json(
             // In case the change is NOT ALIVE it must be set as dispose so it can be communicate to others and erased
             if (change->kind != fastrtps::rtps::ALIVE)
             {
-                disposals_.push_back(change);
+                add_disposal_(change);
             }
         }
 
@@ -2514,7 +2683,7 @@ bool DiscoveryDataBase::from_json(
             add_writer_to_topic_(guid_aux, topic);
 
             // Add writer to its participant
-            std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator writer_part_it =
+            ParticipantMap::iterator writer_part_it =
                     participants_.find(guid_aux.guidPrefix);
             if (writer_part_it != participants_.end())
             {
@@ -2534,7 +2703,7 @@ bool DiscoveryDataBase::from_json(
 
             if (change->kind != fastrtps::rtps::ALIVE)
             {
-                disposals_.push_back(change);
+                add_disposal_(change);
             }
         }
 
@@ -2572,7 +2741,7 @@ bool DiscoveryDataBase::from_json(
             add_reader_to_topic_(guid_aux, topic);
 
             // Add reader to its participant
-            std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator reader_part_it =
+            ParticipantMap::iterator reader_part_it =
                     participants_.find(guid_aux.guidPrefix);
             if (reader_part_it != participants_.end())
             {
@@ -2588,7 +2757,7 @@ bool DiscoveryDataBase::from_json(
 
             if (change->kind != fastrtps::rtps::ALIVE)
             {
-                disposals_.push_back(change);
+                add_disposal_(change);
             }
         }
     }
@@ -2608,11 +2777,12 @@ bool DiscoveryDataBase::from_json(
 
 void DiscoveryDataBase::clean_backup()
 {
-    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Restoring queue DDB in json backup");
+    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Restoring queue DDB in binary backup");
 
     // This will erase the last backup stored
     backup_file_.close();
-    backup_file_.open(backup_file_name_, std::ios_base::out);
+    backup_file_.open(backup_file_name_, std::ios_base::out | std::ios_base::binary);
+    backup_queue_size_ = 0;
 }
 
 void DiscoveryDataBase::persistence_enable(
@@ -2621,7 +2791,38 @@ void DiscoveryDataBase::persistence_enable(
     is_persistent_ = true;
     backup_file_name_ = backup_file_name;
     // It opens the file in append mode because the info in it has not been yet
-    backup_file_.open(backup_file_name_, std::ios::app);
+    backup_file_.open(backup_file_name_, std::ios::app | std::ios::binary);
+    std::ifstream current_file(backup_file_name_, std::ios::ate | std::ios::binary);
+    backup_queue_size_ = current_file.is_open() ? static_cast<size_t>(current_file.tellg()) : 0;
+}
+
+void DiscoveryDataBase::backup_change_(
+        const eprosima::fastrtps::rtps::CacheChange_t& change)
+{
+    if (restoring_backup_queue_)
+    {
+        return;
+    }
+
+    nlohmann::json j;
+    ddb::to_json(j, change);
+    std::vector<uint8_t> record = nlohmann::json::to_cbor(j);
+
+    // Each record is the CBOR encoding of the change, preceded by its little endian 32 bits length
+    uint32_t record_size = static_cast<uint32_t>(record.size());
+    char size_bytes[4] = {
+        static_cast<char>(record_size & 0xFF),
+        static_cast<char>((record_size >> 8) & 0xFF),
+        static_cast<char>((record_size >> 16) & 0xFF),
+        static_cast<char>((record_size >> 24) & 0xFF)
+    };
+
+    // Does not allow to the server to erase the ddb before this message has been processed
+    std::lock_guard<std::recursive_mutex> guard(data_queues_mutex_);
+    backup_file_.write(size_bytes, sizeof(size_bytes));
+    backup_file_.write(reinterpret_cast<const char*>(record.data()), static_cast<std::streamsize>(record.size()));
+    backup_file_.flush();
+    backup_queue_size_ += sizeof(size_bytes) + record.size();
 }
 
 bool DiscoveryDataBase::is_participant_local(
@@ -20,14 +20,18 @@
 #ifndef _FASTDDS_RTPS_DISCOVERY_DATABASE_H_
 #define _FASTDDS_RTPS_DISCOVERY_DATABASE_H_
 
+#include <condition_variable>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <mutex>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <fastrtps/utils/fixed_size_string.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/history/WriterHistory.h>
 #include <fastdds/rtps/writer/ReaderProxy.h>
 #include <fastdds/rtps/common/CacheChange.h>
@@ -37,6 +41,8 @@
 #include <rtps/builtin/discovery/database/DiscoveryParticipantInfo.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryEndpointInfo.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryDataQueueInfo.hpp>
+#include <utils/hash.hpp>
+#include <utils/thread.hpp>
 
 #include <nlohmann/json.hpp>
 
@@ -177,6 +183,13 @@ public:
         processing_backup_ = v;
     }
 
+    //! Stop journaling the incoming changes while the journal of a backup is replayed, as they are already in it
+    void restoring_backup_queue(
+            bool v)
+    {
+        restoring_backup_queue_ = v;
+    }
+
     /* Clear all the collections in the database
      * @return: The changes that can be released
      */
@@ -209,6 +222,22 @@ public:
     // Functions to process_dirty_topics()
     bool process_dirty_topics();
 
+    /* Start the threads matching the endpoints of the dirty topics in parallel
+     * Dirty topics are sharded by the hash of their name between the workers and the thread calling
+     * process_dirty_topics(). The results are applied following the order of the dirty topics, so the changes to
+     * send are the same than when matching them sequentially.
+     * @param num_workers: Number of worker threads. 0 keeps the matching on the calling thread.
+     * @param thread_settings: Settings of the worker threads.
+     * @param id_for_thread: Identifier used on the name of the worker threads.
+     */
+    void start_matching_workers(
+            uint32_t num_workers,
+            const fastdds::rtps::ThreadSettings& thread_settings,
+            uint32_t id_for_thread);
+
+    //! Stop and join the matching worker threads
+    void stop_matching_workers();
+
     ////////////
     // Functions to process_disposals()
     const std::vector<eprosima::fastrtps::rtps::CacheChange_t*> changes_to_dispose();
@@ -316,6 +345,13 @@ public:
     // This function must be called with the incoming datas blocked
     void clean_backup();
 
+    //! Size in bytes of the changes journaled since the last backup
+    size_t backup_queue_size()
+    {
+        std::lock_guard<std::recursive_mutex> guard(data_queues_mutex_);
+        return backup_queue_size_;
+    }
+
     // Lock the incoming of new data to the DDB queue. This locks the Listener as well
     void lock_incoming_data()
     {
@@ -355,6 +391,12 @@ public:
 
 protected:
 
+    //! Hash indexes of the entities known by the database
+    using ParticipantMap = std::unordered_map<fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo,
+                    fastrtps::rtps::GuidPrefixHash>;
+    using EndpointMap = std::unordered_map<fastrtps::rtps::GUID_t, DiscoveryEndpointInfo, fastrtps::rtps::GuidHash>;
+    using TopicMap = std::unordered_map<std::string, std::vector<fastrtps::rtps::GUID_t>>;
+
     // change a cacheChange by update or new disposal
     void update_change_and_unmatch_(
             fastrtps::rtps::CacheChange_t* new_change,
@@ -446,22 +488,22 @@ protected:
     bool delete_participant_entity_(
             const fastrtps::rtps::GuidPrefix_t& guid_prefix);
 
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator delete_participant_entity_(
-            std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator it);
+    ParticipantMap::iterator delete_participant_entity_(
+            ParticipantMap::iterator it);
 
     // delete an entity and set its change to release. Assumes the entity has been unmatched before
     bool delete_writer_entity_(
             const fastrtps::rtps::GUID_t& guid);
 
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator delete_writer_entity_(
-            std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it);
+    EndpointMap::iterator delete_writer_entity_(
+            EndpointMap::iterator it);
 
     // delete an entity and set its change to release. Assumes the entity has been unmatched before
     bool delete_reader_entity_(
             const fastrtps::rtps::GUID_t& guid);
 
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator delete_reader_entity_(
-            std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it);
+    EndpointMap::iterator delete_reader_entity_(
+            EndpointMap::iterator it);
 
     // return if there are more than one writer in the participant in the same topic
     bool repeated_writer_topic_(
@@ -498,6 +540,54 @@ protected:
     bool set_dirty_topic_(
             std::string topic);
 
+    //! Changes to send found when matching the endpoints of a dirty topic
+    struct TopicMatchResult
+    {
+        std::vector<eprosima::fastrtps::rtps::CacheChange_t*> pdp_to_send;
+        std::vector<eprosima::fastrtps::rtps::CacheChange_t*> edp_publications_to_send;
+        std::vector<eprosima::fastrtps::rtps::CacheChange_t*> edp_subscriptions_to_send;
+        //! Used to add each change only once
+        std::unordered_set<eprosima::fastrtps::rtps::CacheChange_t*> added;
+        bool is_clearable = true;
+
+        void clear()
+        {
+            pdp_to_send.clear();
+            edp_publications_to_send.clear();
+            edp_subscriptions_to_send.clear();
+            added.clear();
+            is_clearable = true;
+        }
+
+    };
+
+    // Match the endpoints of a dirty topic without modifying the database, so several topics can be matched
+    // concurrently while mutex_ is held by the thread processing the dirty topics
+    void match_topic_(
+            const std::string& topic,
+            TopicMatchResult& result) const;
+
+    // Add the changes found by match_topic_() to the lists of changes to send
+    void apply_topic_match_(
+            const TopicMatchResult& result);
+
+    // Match the dirty topics assigned to a shard
+    void match_shard_(
+            uint32_t shard);
+
+    // Body of the matching worker threads, waiting for the rounds after last_round
+    void run_matching_worker_(
+            uint32_t shard,
+            uint64_t last_round);
+
+    // Append a received change to the journal of the backup file
+    void backup_change_(
+            const eprosima::fastrtps::rtps::CacheChange_t& change);
+
+    // Add data in disposals if not already in it
+    bool add_disposal_(
+            eprosima::fastrtps::rtps::CacheChange_t* change);
+
     // Add data in pdp_to_send if not already in it
     bool add_pdp_to_send_(
             eprosima::fastrtps::rtps::CacheChange_t* change);
@@ -526,32 +616,55 @@ protected:
     fastrtps::DBQueue<eprosima::fastdds::rtps::ddb::DiscoveryEDPDataQueueInfo> edp_data_queue_;
 
     //! Covenient per-topic mapping of readers and writers to speed-up queries
-    std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>> readers_by_topic_;
-    std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>> writers_by_topic_;
+    TopicMap readers_by_topic_;
+    TopicMap writers_by_topic_;
 
     //! Collection of participant proxies that:
     //  - stores the CacheChange_t
     //  - keeps track of its acknowledgement status
     //  - keeps an account of participant's readers and writers
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo> participants_;
+    ParticipantMap participants_;
 
     //! Collection of reader and writer proxies that:
     //  - stores the CacheChange_t
     //  - keeps track of its acknowledgement status
     //  - stores the topic name (only matching criteria available)
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo> readers_;
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo> writers_;
+    EndpointMap readers_;
+    EndpointMap writers_;
 
     //! Collection of topics whose related endpoints have changed and require a match recalculation
     std::vector<std::string> dirty_topics_;
+    std::unordered_set<std::string> dirty_topics_index_;
+
+    //! Result of matching each of the dirty_topics_, and the shard processing it
+    std::vector<TopicMatchResult> topic_match_results_;
+    std::vector<uint32_t> topic_match_shards_;
+
+    //! Threads matching the dirty topics in parallel. Shard 0 is processed by the routine thread
+    std::vector<eprosima::thread> matching_workers_;
+    std::mutex matching_mutex_;
+    //! Notified when a new matching round starts or the workers should stop
+    std::condition_variable matching_cv_;
+    //! Notified when a worker finishes its shard
+    std::condition_variable matching_done_cv_;
+    uint64_t matching_round_ = 0;
+    uint32_t matching_pending_ = 0;
+    //! Shards of the current round already taken by a worker or the routine thread
+    std::vector<bool> matching_claimed_;
+    bool matching_stop_ = false;
 
     //! Collection of changes to take out of the server builtin writers
     std::vector<eprosima::fastrtps::rtps::CacheChange_t*> disposals_;
+    std::unordered_set<eprosima::fastrtps::rtps::CacheChange_t*> disposals_index_;
 
-    //! Collection of changes to put into the server builtin writers
+    //! Collection of changes to put into the server builtin writers.
+    //  Each one has an index to check in constant time whether a change is already in it
     std::vector<eprosima::fastrtps::rtps::CacheChange_t*> pdp_to_send_;
+    std::unordered_set<eprosima::fastrtps::rtps::CacheChange_t*> pdp_to_send_index_;
     std::vector<eprosima::fastrtps::rtps::CacheChange_t*> edp_publications_to_send_;
+    std::unordered_set<eprosima::fastrtps::rtps::CacheChange_t*> edp_publications_to_send_index_;
     std::vector<eprosima::fastrtps::rtps::CacheChange_t*> edp_subscriptions_to_send_;
+    std::unordered_set<eprosima::fastrtps::rtps::CacheChange_t*> edp_subscriptions_to_send_index_;
 
     //! changes that are no longer associated to living endpoints and should be returned to it's pool
     std::vector<eprosima::fastrtps::rtps::CacheChange_t*> changes_to_release_;
@@ -583,6 +696,9 @@ protected:
     // Whether the database is restoring a backup
     std::atomic<bool> processing_backup_;
 
+    // Whether the database is replaying the journal of a backup
+    std::atomic<bool> restoring_backup_queue_;
+
     // Whether the database is persistent, so it must store every cache it arrives
     bool is_persistent_;
 
@@ -591,6 +707,8 @@ protected:
     // This file will keep open to write it fast every time a new cache arrives
     // It needs a flush every time a new change is added
     std::ofstream backup_file_;
+    // Size in bytes of the backup file
+    size_t backup_queue_size_;
 };
 
 
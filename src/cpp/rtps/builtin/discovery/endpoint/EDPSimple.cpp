@@ -25,6 +25,7 @@
 #include <fastdds/rtps/writer/StatefulWriter.h>
 #include <fastdds/rtps/reader/StatefulReader.h>
 #include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/attributes/WriterAttributes.h>
 #include <fastdds/rtps/attributes/ReaderAttributes.h>
 #include <fastdds/rtps/history/ReaderHistory.h>
@@ -42,6 +43,7 @@
 #endif //FASTDDS_STATISTICS
 
 #include <rtps/builtin/discovery/endpoint/EDPUtils.hpp>
+#include <rtps/builtin/discovery/endpoint/TopicDigestFilter.hpp>
 
 #include <mutex>
 #include <forward_list>
@@ -113,6 +115,11 @@ EDPSimple::~EDPSimple()
     delete_writer(mp_RTPSParticipant, publications_writer_, pub_writer_payload_pool_);
     delete_writer(mp_RTPSParticipant, subscriptions_writer_, sub_writer_payload_pool_);
 
+    if (nullptr != topic_digest_filter_)
+    {
+        delete(topic_digest_filter_);
+    }
+
     if (nullptr != publications_listener_)
     {
         delete(publications_listener_);
@@ -144,9 +151,60 @@ bool EDPSimple::initEDP(
     }
 #endif // if HAVE_SECURITY
 
+    create_topic_digest_filter();
+
     return true;
 }
 
+void EDPSimple::create_topic_digest_filter()
+{
+    // Discovery servers have their own filtering of the endpoint announcements
+    if (DiscoveryProtocol_t::SIMPLE != m_discovery.discovery_config.discoveryProtocol)
+    {
+        return;
+    }
+
+    const std::string* enabled = PropertyPolicyHelper::find_property(
+        mp_RTPSParticipant->getAttributes().properties, "fastdds.discovery.topic_digest");
+    if (nullptr == enabled || "true" != *enabled)
+    {
+        return;
+    }
+
+    topic_digest_filter_ = new TopicDigestFilter();
+    if (nullptr != publications_writer_.first)
+    {
+        publications_writer_.first->reader_data_filter(topic_digest_filter_);
+    }
+    if (nullptr != subscriptions_writer_.first)
+    {
+        subscriptions_writer_.first->reader_data_filter(topic_digest_filter_);
+    }
+
+    // The digest has a fixed length, so it can be updated in place on the local DATA(p)
+    std::lock_guard<std::recursive_mutex> lock(*mp_PDP->getMutex());
+    mp_PDP->getLocalParticipantProxyData()->m_properties.push_back(
+        fastdds::dds::parameter_property_topic_digest, topic_digest_filter_->local_digest());
+}
+
+void EDPSimple::announce_local_topic_digest()
+{
+    std::string digest = topic_digest_filter_->local_digest();
+    {
+        std::lock_guard<std::recursive_mutex> lock(*mp_PDP->getMutex());
+        ParameterPropertyList_t& properties = mp_PDP->getLocalParticipantProxyData()->m_properties;
+        for (auto it = properties.begin(); it != properties.end(); ++it)
+        {
+            if (it->first() == fastdds::dds::parameter_property_topic_digest)
+            {
+                it->modify(std::make_pair(it->first(), digest));
+                break;
+            }
+        }
+    }
+    mp_PDP->announceParticipantState(true);
+}
+
 //! Process the info recorded in the persistence database
 void EDPSimple::processPersistentData(
         t_p_StatefulReader& reader,
@@ -536,12 +594,22 @@ bool EDPSimple::processLocalReaderProxyData(
         writer = &subscriptions_secure_writer_;
     }
 #endif // if HAVE_SECURITY
+
+    // Only the announcements on the non-secure writers are filtered
+    bool digest_changed = nullptr != topic_digest_filter_ && writer == &subscriptions_writer_ &&
+            topic_digest_filter_->add_local_endpoint(rdata->guid(), rdata->topicName().to_string());
+
     CacheChange_t* change = nullptr;
     bool ret_val = serialize_reader_proxy_data(*rdata, *writer, true, &change);
     if (change != nullptr)
     {
         writer->second->add_change(change);
     }
+
+    if (digest_changed)
+    {
+        announce_local_topic_digest();
+    }
     return ret_val;
 }
 
@@ -561,12 +629,21 @@ bool EDPSimple::processLocalWriterProxyData(
     }
 #endif // if HAVE_SECURITY
 
+    // Only the announcements on the non-secure writers are filtered
+    bool digest_changed = nullptr != topic_digest_filter_ && writer == &publications_writer_ &&
+            topic_digest_filter_->add_local_endpoint(wdata->guid(), wdata->topicName().to_string());
+
     CacheChange_t* change = nullptr;
     bool ret_val = serialize_writer_proxy_data(*wdata, *writer, true, &change);
     if (change != nullptr)
     {
         writer->second->add_change(change);
     }
+
+    if (digest_changed)
+    {
+        announce_local_topic_digest();
+    }
     return ret_val;
 }
 
@@ -685,6 +762,11 @@ bool EDPSimple::removeLocalWriter(
         }
     }
 
+    if (nullptr != topic_digest_filter_ && topic_digest_filter_->remove_local_endpoint(W->getGuid()))
+    {
+        announce_local_topic_digest();
+    }
+
 #ifdef FASTDDS_STATISTICS
     // notify monitor service about the new local entity proxy update
     if (nullptr != this->mp_PDP->get_proxy_observer())
@@ -738,6 +820,11 @@ bool EDPSimple::removeLocalReader(
         }
     }
 
+    if (nullptr != topic_digest_filter_ && topic_digest_filter_->remove_local_endpoint(R->getGuid()))
+    {
+        announce_local_topic_digest();
+    }
+
 #ifdef FASTDDS_STATISTICS
     // notify monitor service about the new local entity proxy update
     if (nullptr != this->mp_PDP->get_proxy_observer())
@@ -754,6 +841,10 @@ void EDPSimple::assignRemoteEndpoints(
         bool assign_secure_endpoints)
 {
     EPROSIMA_LOG_INFO(RTPS_EDP, "New DPD received, adding remote endpoints to our SimpleEDP endpoints");
+
+    // The digest of the participant should be known before matching it, so the filter applies to the history
+    remote_participant_updated(pdata);
+
     const NetworkFactory& network = mp_RTPSParticipant->network_factory();
     uint32_t endp = pdata.m_availableBuiltinEndpoints;
     uint32_t auxendp;
@@ -888,6 +979,11 @@ void EDPSimple::removeRemoteEndpoints(
     GUID_t tmp_guid;
     tmp_guid.guidPrefix = pdata->m_guid.guidPrefix;
 
+    if (nullptr != topic_digest_filter_)
+    {
+        topic_digest_filter_->remove_remote_participant(pdata->m_guid.guidPrefix);
+    }
+
     uint32_t endp = pdata->m_availableBuiltinEndpoints;
     uint32_t auxendp = endp;
     auxendp &= DISC_BUILTIN_ENDPOINT_PUBLICATION_ANNOUNCER;
@@ -972,6 +1068,48 @@ void EDPSimple::removeRemoteEndpoints(
 #endif // if HAVE_SECURITY
 }
 
+void EDPSimple::remote_participant_updated(
+        const ParticipantProxyData& pdata)
+{
+    if (nullptr == topic_digest_filter_)
+    {
+        return;
+    }
+
+    std::vector<GUID_t> endpoints;
+    if (!topic_digest_filter_->update_remote_participant(pdata.m_guid.guidPrefix, pdata.m_properties, endpoints))
+    {
+        return;
+    }
+
+    // The remote participant considered the previous announcements of these endpoints irrelevant, so they are
+    // announced again on new changes
+    for (const GUID_t& guid : endpoints)
+    {
+        CacheChange_t* change = nullptr;
+        if (guid.entityId.is_writer())
+        {
+            auto temp_writer_data = get_temporary_writer_proxies_pool().get();
+            if (mp_PDP->lookupWriterProxyData(guid, *temp_writer_data) &&
+                    serialize_writer_proxy_data(*temp_writer_data, publications_writer_, true, &change) &&
+                    change != nullptr)
+            {
+                publications_writer_.second->add_change(change);
+            }
+        }
+        else
+        {
+            auto temp_reader_data = get_temporary_reader_proxies_pool().get();
+            if (mp_PDP->lookupReaderProxyData(guid, *temp_reader_data) &&
+                    serialize_reader_proxy_data(*temp_reader_data, subscriptions_writer_, true, &change) &&
+                    change != nullptr)
+            {
+                subscriptions_writer_.second->add_change(change);
+            }
+        }
+    }
+}
+
 bool EDPSimple::areRemoteEndpointsMatched(
         const ParticipantProxyData* pdata)
 {
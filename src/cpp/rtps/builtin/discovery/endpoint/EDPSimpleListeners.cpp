@@ -66,6 +66,15 @@ void EDPBasePUBListener::add_writer_from_change(
         EDP* edp,
         bool release_change /*=true*/)
 {
+    // Announcements equal to the one the known proxy was read from do not need to be parsed again
+    uint64_t serialized_hash = ParameterList::payload_hash(change->serializedPayload);
+    if (edp->mp_PDP->has_writer_proxy_data(iHandle2GUID(change->instanceHandle), change->serializedPayload,
+            serialized_hash))
+    {
+        reader_history->remove_change(reader_history->find_change(change), release_change);
+        return;
+    }
+
     //LOAD INFORMATION IN DESTINATION WRITER PROXY DATA
     const NetworkFactory& network = edp->mp_RTPSParticipant->network_factory();
     CDRMessage_t tempMsg(change->serializedPayload);
@@ -74,6 +83,8 @@ void EDPBasePUBListener::add_writer_from_change(
     if (temp_writer_data->readFromCDRMessage(&tempMsg, network,
             edp->mp_RTPSParticipant->has_shm_transport(), true, change->vendor_id))
     {
+        temp_writer_data->serialized_payload(change->serializedPayload, serialized_hash);
+
         if (temp_writer_data->guid().guidPrefix == edp->mp_RTPSParticipant->getGuid().guidPrefix)
         {
             EPROSIMA_LOG_INFO(RTPS_EDP, "Message from own RTPSParticipant, ignoring");
@@ -177,6 +188,15 @@ void EDPBaseSUBListener::add_reader_from_change(
         EDP* edp,
         bool release_change /*=true*/)
 {
+    // Announcements equal to the one the known proxy was read from do not need to be parsed again
+    uint64_t serialized_hash = ParameterList::payload_hash(change->serializedPayload);
+    if (edp->mp_PDP->has_reader_proxy_data(iHandle2GUID(change->instanceHandle), change->serializedPayload,
+            serialized_hash))
+    {
+        reader_history->remove_change(reader_history->find_change(change), release_change);
+        return;
+    }
+
     //LOAD INFORMATION IN TEMPORAL WRITER PROXY DATA
     const NetworkFactory& network = edp->mp_RTPSParticipant->network_factory();
     CDRMessage_t tempMsg(change->serializedPayload);
@@ -185,6 +205,8 @@ void EDPBaseSUBListener::add_reader_from_change(
     if (temp_reader_data->readFromCDRMessage(&tempMsg, network,
             edp->mp_RTPSParticipant->has_shm_transport(), true, change->vendor_id))
     {
+        temp_reader_data->serialized_payload(change->serializedPayload, serialized_hash);
+
         if (temp_reader_data->guid().guidPrefix == edp->mp_RTPSParticipant->getGuid().guidPrefix)
         {
             EPROSIMA_LOG_INFO(RTPS_EDP, "From own RTPSParticipant, ignoring");
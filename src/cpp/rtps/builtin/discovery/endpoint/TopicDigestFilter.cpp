@@ -0,0 +1,279 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TopicDigestFilter.cpp
+ */
+
+#include <rtps/builtin/discovery/endpoint/TopicDigestFilter.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+constexpr size_t TopicDigestFilter::digest_bits;
+constexpr size_t TopicDigestFilter::num_hashes;
+
+// The digest is interpreted by other participants, so it cannot depend on the implementation of std::hash
+static uint64_t topic_hash(
+        const std::string& topic_name)
+{
+    return fnv1a_64(topic_name.data(), topic_name.size());
+}
+
+// Position of the i-th bit of a topic name, using double hashing
+static size_t bit_position(
+        uint64_t hash,
+        size_t i)
+{
+    uint32_t h1 = static_cast<uint32_t>(hash);
+    uint32_t h2 = static_cast<uint32_t>(hash >> 32) | 1u;
+    return static_cast<size_t>(h1 + static_cast<uint32_t>(i) * h2) % TopicDigestFilter::digest_bits;
+}
+
+void TopicDigestFilter::add_topic(
+        Digest& digest,
+        const std::string& topic_name)
+{
+    uint64_t hash = topic_hash(topic_name);
+    for (size_t i = 0; i < num_hashes; ++i)
+    {
+        size_t bit = bit_position(hash, i);
+        digest[bit / 8] |= static_cast<uint8_t>(1u << (bit % 8));
+    }
+}
+
+bool TopicDigestFilter::may_contain(
+        const Digest& digest,
+        const std::string& topic_name)
+{
+    uint64_t hash = topic_hash(topic_name);
+    for (size_t i = 0; i < num_hashes; ++i)
+    {
+        size_t bit = bit_position(hash, i);
+        if (0 == (digest[bit / 8] & (1u << (bit % 8))))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string TopicDigestFilter::to_string(
+        const Digest& digest)
+{
+    static const char hex_digits[] = "0123456789abcdef";
+
+    std::string value;
+    value.reserve(digest.size() * 2);
+    for (uint8_t byte : digest)
+    {
+        value.push_back(hex_digits[byte >> 4]);
+        value.push_back(hex_digits[byte & 0x0F]);
+    }
+    return value;
+}
+
+bool TopicDigestFilter::from_string(
+        const std::string& value,
+        Digest& digest)
+{
+    if (value.size() != digest.size() * 2)
+    {
+        return false;
+    }
+
+    auto nibble = [](char c) -> int
+            {
+                if (c >= '0' && c <= '9')
+                {
+                    return c - '0';
+                }
+                if (c >= 'a' && c <= 'f')
+                {
+                    return c - 'a' + 10;
+                }
+                if (c >= 'A' && c <= 'F')
+                {
+                    return c - 'A' + 10;
+                }
+                return -1;
+            };
+
+    for (size_t i = 0; i < digest.size(); ++i)
+    {
+        int high = nibble(value[2 * i]);
+        int low = nibble(value[2 * i + 1]);
+        if (high < 0 || low < 0)
+        {
+            return false;
+        }
+        digest[i] = static_cast<uint8_t>((high << 4) | low);
+    }
+    return true;
+}
+
+bool TopicDigestFilter::add_local_endpoint(
+        const GUID_t& guid,
+        const std::string& topic_name)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    auto it = local_topics_.find(guid);
+    if (it != local_topics_.end())
+    {
+        if (it->second == topic_name)
+        {
+            return false;
+        }
+        it->second = topic_name;
+        Digest old_digest = local_digest_;
+        rebuild_local_digest_nts();
+        return old_digest != local_digest_;
+    }
+
+    local_topics_.emplace(guid, topic_name);
+    Digest old_digest = local_digest_;
+    add_topic(local_digest_, topic_name);
+    return old_digest != local_digest_;
+}
+
+bool TopicDigestFilter::remove_local_endpoint(
+        const GUID_t& guid)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    if (0 == local_topics_.erase(guid))
+    {
+        return false;
+    }
+
+    // Bloom filters do not support removals, so the digest is computed again from the remaining topics
+    Digest old_digest = local_digest_;
+    rebuild_local_digest_nts();
+    return old_digest != local_digest_;
+}
+
+std::string TopicDigestFilter::local_digest() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return to_string(local_digest_);
+}
+
+bool TopicDigestFilter::update_remote_participant(
+        const GuidPrefix_t& guid_prefix,
+        const fastdds::dds::ParameterPropertyList_t& properties,
+        std::vector<GUID_t>& newly_relevant_endpoints)
+{
+    Digest new_digest{};
+    bool has_digest = false;
+    for (auto it = properties.begin(); it != properties.end(); ++it)
+    {
+        if (it->first() == fastdds::dds::parameter_property_topic_digest)
+        {
+            has_digest = from_string(it->second(), new_digest);
+            break;
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    auto remote_it = remote_digests_.find(guid_prefix);
+    if (!has_digest)
+    {
+        // Every announcement is relevant for participants not announcing a digest
+        if (remote_it == remote_digests_.end())
+        {
+            return false;
+        }
+        Digest old_digest = remote_it->second;
+        remote_digests_.erase(remote_it);
+        for (const auto& local : local_topics_)
+        {
+            if (!may_contain(old_digest, local.second))
+            {
+                newly_relevant_endpoints.push_back(local.first);
+            }
+        }
+        return !newly_relevant_endpoints.empty();
+    }
+
+    if (remote_it == remote_digests_.end())
+    {
+        // Nothing has been filtered out yet for this participant
+        remote_digests_.emplace(guid_prefix, new_digest);
+        return false;
+    }
+
+    Digest old_digest = remote_it->second;
+    remote_it->second = new_digest;
+    for (const auto& local : local_topics_)
+    {
+        if (!may_contain(old_digest, local.second) && may_contain(new_digest, local.second))
+        {
+            newly_relevant_endpoints.push_back(local.first);
+        }
+    }
+    return !newly_relevant_endpoints.empty();
+}
+
+void TopicDigestFilter::remove_remote_participant(
+        const GuidPrefix_t& guid_prefix)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    remote_digests_.erase(guid_prefix);
+}
+
+bool TopicDigestFilter::is_relevant(
+        const CacheChange_t& change,
+        const GUID_t& reader_guid) const
+{
+    // Disposals are always sent, as the remote participant may know the endpoint from a previous digest
+    if (ALIVE != change.kind)
+    {
+        return true;
+    }
+
+    GUID_t endpoint_guid;
+    iHandle2GUID(endpoint_guid, change.instanceHandle);
+
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    auto remote_it = remote_digests_.find(reader_guid.guidPrefix);
+    if (remote_it == remote_digests_.end())
+    {
+        return true;
+    }
+
+    auto local_it = local_topics_.find(endpoint_guid);
+    if (local_it == local_topics_.end())
+    {
+        return true;
+    }
+
+    return may_contain(remote_it->second, local_it->second);
+}
+
+void TopicDigestFilter::rebuild_local_digest_nts()
+{
+    local_digest_.fill(0);
+    for (const auto& local : local_topics_)
+    {
+        add_topic(local_digest_, local.second);
+    }
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,133 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TopicDigestFilter.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_BUILTIN_DISCOVERY_ENDPOINT_TOPICDIGESTFILTER_HPP_
+#define _FASTDDS_RTPS_BUILTIN_DISCOVERY_ENDPOINT_TOPICDIGESTFILTER_HPP_
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fastdds/dds/core/policy/ParameterTypes.hpp>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/interfaces/IReaderDataFilter.hpp>
+
+#include <utils/hash.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Filter of the SEDP writers that only sends the announcements of the local endpoints to the participants that
+ * have endpoints on the same topic.
+ *
+ * Each participant announces a Bloom filter of the names of the topics of its endpoints (its topic digest) on the
+ * properties of its DATA(p). Participants that do not announce a digest receive every announcement.
+ */
+class TopicDigestFilter final : public fastdds::rtps::IReaderDataFilter
+{
+public:
+
+    static constexpr size_t digest_bits = 256;
+    static constexpr size_t num_hashes = 3;
+
+    using Digest = std::array<uint8_t, digest_bits / 8>;
+
+    //! Add a topic name to a digest
+    static void add_topic(
+            Digest& digest,
+            const std::string& topic_name);
+
+    //! Whether a digest may contain a topic name. False positives are possible, false negatives are not.
+    static bool may_contain(
+            const Digest& digest,
+            const std::string& topic_name);
+
+    //! Hexadecimal representation of a digest, used as the value of its property
+    static std::string to_string(
+            const Digest& digest);
+
+    //! Parse the hexadecimal representation of a digest
+    static bool from_string(
+            const std::string& value,
+            Digest& digest);
+
+    /**
+     * Register a local endpoint.
+     * @param guid GUID of the endpoint.
+     * @param topic_name Name of the topic of the endpoint.
+     * @return Whether the digest of the local participant changed.
+     */
+    bool add_local_endpoint(
+            const GUID_t& guid,
+            const std::string& topic_name);
+
+    /**
+     * Unregister a local endpoint.
+     * @param guid GUID of the endpoint.
+     * @return Whether the digest of the local participant changed.
+     */
+    bool remove_local_endpoint(
+            const GUID_t& guid);
+
+    //! Hexadecimal representation of the digest of the local participant
+    std::string local_digest() const;
+
+    /**
+     * Update the digest announced by a remote participant.
+     * @param [in]  guid_prefix           GUID prefix of the remote participant.
+     * @param [in]  properties            Properties announced by the remote participant.
+     * @param [out] newly_relevant_endpoints Local endpoints whose announcement was filtered out for the remote
+     *                                       participant and is now relevant for it.
+     * @return Whether any local endpoint became relevant for the remote participant.
+     */
+    bool update_remote_participant(
+            const GuidPrefix_t& guid_prefix,
+            const fastdds::dds::ParameterPropertyList_t& properties,
+            std::vector<GUID_t>& newly_relevant_endpoints);
+
+    //! Forget the digest of a remote participant
+    void remove_remote_participant(
+            const GuidPrefix_t& guid_prefix);
+
+    bool is_relevant(
+            const CacheChange_t& change,
+            const GUID_t& reader_guid) const override;
+
+private:
+
+    void rebuild_local_digest_nts();
+
+    mutable std::mutex mutex_;
+    //! Topic of each local endpoint
+    std::unordered_map<GUID_t, std::string, GuidHash> local_topics_;
+    Digest local_digest_{};
+    //! Digest announced by each remote participant
+    std::unordered_map<GuidPrefix_t, Digest, GuidPrefixHash> remote_digests_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_BUILTIN_DISCOVERY_ENDPOINT_TOPICDIGESTFILTER_HPP_
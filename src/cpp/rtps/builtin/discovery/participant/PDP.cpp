@@ -647,6 +647,24 @@ bool PDP::has_reader_proxy_data(
     return false;
 }
 
+bool PDP::has_reader_proxy_data(
+        const GUID_t& reader,
+        const SerializedPayload_t& payload,
+        uint64_t serialized_hash)
+{
+    std::lock_guard<std::recursive_mutex> guardPDP(*mp_mutex);
+    for (ParticipantProxyData* pit : participant_proxies_)
+    {
+        if (pit->m_guid.guidPrefix == reader.guidPrefix)
+        {
+            ProxyHashTable<ReaderProxyData>& readers = *pit->m_readers;
+            auto rit = readers.find(reader.entityId);
+            return (rit != readers.end()) && rit->second->is_read_from(payload, serialized_hash);
+        }
+    }
+    return false;
+}
+
 bool PDP::lookupReaderProxyData(
         const GUID_t& reader,
         ReaderProxyData& rdata)
@@ -682,6 +700,24 @@ bool PDP::has_writer_proxy_data(
     return false;
 }
 
+bool PDP::has_writer_proxy_data(
+        const GUID_t& writer,
+        const SerializedPayload_t& payload,
+        uint64_t serialized_hash)
+{
+    std::lock_guard<std::recursive_mutex> guardPDP(*mp_mutex);
+    for (ParticipantProxyData* pit : participant_proxies_)
+    {
+        if (pit->m_guid.guidPrefix == writer.guidPrefix)
+        {
+            ProxyHashTable<WriterProxyData>& writers = *pit->m_writers;
+            auto wit = writers.find(writer.entityId);
+            return (wit != writers.end()) && wit->second->is_read_from(payload, serialized_hash);
+        }
+    }
+    return false;
+}
+
 bool PDP::lookupWriterProxyData(
         const GUID_t& writer,
         WriterProxyData& wdata)
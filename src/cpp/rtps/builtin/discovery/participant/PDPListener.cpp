@@ -88,6 +88,9 @@ void PDPListener::onNewCacheChangeAdded(
             return;
         }
 
+        // Hash the DATA(p) before taking the PDP mutex, so other threads do not wait for it
+        uint64_t serialized_hash = ParameterList::payload_hash(change->serializedPayload);
+
         // Release reader lock to avoid ABBA lock. PDP mutex should always be first.
         // Keep change information on local variables to check consistency later
         SequenceNumber_t seq_num = change->sequenceNumber;
@@ -101,6 +104,21 @@ void PDPListener::onNewCacheChangeAdded(
             return;
         }
 
+        // A DATA(p) equal to the one the known participant proxy was read from does not need to be parsed again
+        for (ParticipantProxyData* it : parent_pdp_->participant_proxies_)
+        {
+            if (guid == it->m_guid)
+            {
+                if (it->is_read_from(change->serializedPayload, serialized_hash))
+                {
+                    it->isAlive = true;
+                    parent_pdp_->builtin_endpoints_->remove_from_pdp_reader_history(change);
+                    return;
+                }
+                break;
+            }
+        }
+
         // Access to temp_participant_data_ is protected by reader lock
 
         // Load information on temp_participant_data_
@@ -111,6 +129,7 @@ void PDPListener::onNewCacheChangeAdded(
         {
             // After correctly reading it
             change->instanceHandle = temp_participant_data_.m_key;
+            temp_participant_data_.serialized_payload(change->serializedPayload, serialized_hash);
             guid = temp_participant_data_.m_guid;
 
             if (parent_pdp_->getRTPSParticipant()->is_participant_ignored(guid.guidPrefix))
@@ -242,6 +261,8 @@ void PDPListener::process_alive_data(
 
         lock.unlock();
 
+        parent_pdp_->mp_EDP->remote_participant_updated(old_data_copy);
+
         RTPSParticipantListener* listener = parent_pdp_->getRTPSParticipant()->getListener();
         if (listener != nullptr)
         {
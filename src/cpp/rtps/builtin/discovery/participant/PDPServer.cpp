@@ -17,13 +17,20 @@
  *
  */
 
+#include <cstdio>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include <mutex>
 #include <set>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif // ifdef _WIN32
 
 #include <fastrtps/utils/TimedMutex.hpp>
 
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/builtin/BuiltinProtocols.h>
 #include <fastdds/rtps/builtin/liveliness/WLP.h>
 
@@ -70,6 +77,7 @@ PDPServer::PDPServer(
     , discovery_db_(builtin->mp_participantImpl->getGuid().guidPrefix,
             servers_prefixes())
     , durability_ (durability_kind)
+    , backup_queue_compaction_threshold_(1024 * 1024)
 {
     // Add remote servers from environment variable
     RemoteServerList_t env_servers;
@@ -99,6 +107,7 @@ PDPServer::~PDPServer()
 
     // Disable database
     discovery_db_.disable();
+    discovery_db_.stop_matching_workers();
 
     // Delete timed events
     delete(routine_);
@@ -165,6 +174,41 @@ bool PDPServer::init(
     const fastdds::rtps::ThreadSettings& thr_config = part_attr.discovery_server_thread;
     resource_event_thread_.init_thread(thr_config, "dds.ds_ev.%u", id_for_thread);
 
+    // Initialize the threads matching the dirty topics in parallel, if requested
+    try
+    {
+        const std::string* matching_threads_property =
+                PropertyPolicyHelper::find_property(part_attr.properties, "fastdds.discovery.matching_threads");
+        if (matching_threads_property != nullptr)
+        {
+            uint32_t matching_threads = static_cast<uint32_t>(std::stoul(*matching_threads_property));
+            if (0 < matching_threads)
+            {
+                discovery_db_.start_matching_workers(matching_threads, thr_config, id_for_thread);
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error parsing discovery matching threads property: " << e.what());
+    }
+
+    // Size of the backup journal that triggers its compaction into a new backup of the database
+    try
+    {
+        const std::string* compaction_threshold_property =
+                PropertyPolicyHelper::find_property(part_attr.properties,
+                        "fastdds.discovery.backup_compaction_threshold");
+        if (compaction_threshold_property != nullptr)
+        {
+            backup_queue_compaction_threshold_ = static_cast<size_t>(std::stoull(*compaction_threshold_property));
+        }
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error parsing backup compaction threshold property: " << e.what());
+    }
+
     /*
         Given the fact that a participant is either a client or a server the
         discoveryServer_client_syncperiod parameter has a context defined meaning.
@@ -185,7 +229,6 @@ bool PDPServer::init(
     // Restoring the queue must be done after starting the routine
     if (durability_ == TRANSIENT)
     {
-        // This vector is empty till backup queue is implemented
         process_backup_restore_queue(backup_queue);
     }
 
@@ -784,6 +827,13 @@ std::string PDPServer::get_reader_persistence_file_name() const
 }
 
 std::string PDPServer::get_ddb_persistence_file_name() const
+{
+    std::ostringstream filename = get_persistence_file_name_();
+    filename << ".cbor";
+    return filename.str();
+}
+
+std::string PDPServer::get_ddb_legacy_persistence_file_name() const
 {
     std::ostringstream filename = get_persistence_file_name_();
     filename << ".json";
@@ -793,7 +843,7 @@ std::string PDPServer::get_ddb_persistence_file_name() const
 std::string PDPServer::get_ddb_queue_persistence_file_name() const
 {
     std::ostringstream filename = get_persistence_file_name_();
-    filename << "_queue.json";
+    filename << "_queue.cbor";
     return filename.str();
 }
 
@@ -1683,41 +1733,66 @@ void PDPServer::send_announcement(
 
 bool PDPServer::read_backup(
         nlohmann::json& ddb_json,
-        std::vector<nlohmann::json>& /* new_changes */)
+        std::vector<nlohmann::json>& new_changes)
 {
     std::ifstream myfile;
     bool ret = true;
     try
     {
-        myfile.open(get_ddb_persistence_file_name(), std::ios_base::in);
-        // read json object
-        myfile >> ddb_json;
-        myfile.close();
+        myfile.open(get_ddb_persistence_file_name(), std::ios_base::in | std::ios_base::binary);
+        if (myfile.is_open())
+        {
+            // read the whole binary snapshot at once and decode it from memory
+            std::vector<uint8_t> snapshot((std::istreambuf_iterator<char>(myfile)), std::istreambuf_iterator<char>());
+            myfile.close();
+            ddb_json = nlohmann::json::from_cbor(snapshot);
+        }
+        else
+        {
+            // read json object from a backup stored by a previous version
+            myfile.clear();
+            myfile.open(get_ddb_legacy_persistence_file_name(), std::ios_base::in);
+            myfile >> ddb_json;
+            myfile.close();
+        }
     }
     catch (const std::exception& /* e */)
     {
         ret = false;
     }
 
-    // TODO uncomment this part when recover queues is finish
-    // try{
-    //     myfile.open(get_ddb_queue_persistence_file_name(), std::ios_base::in);
+    try
+    {
+        myfile.clear();
+        myfile.open(get_ddb_queue_persistence_file_name(), std::ios_base::in | std::ios_base::binary);
 
-    //     std::string line;
-    //     while (std::getline(myfile, line))
-    //     {
-    //         nlohmann::json change_json = nlohmann::json::parse(line);
+        // Each record is the CBOR encoding of a change, preceded by its little endian 32 bits length
+        uint8_t size_bytes[4];
+        while (myfile.read(reinterpret_cast<char*>(size_bytes), sizeof(size_bytes)))
+        {
+            uint32_t record_size = static_cast<uint32_t>(size_bytes[0]) |
+                    static_cast<uint32_t>(size_bytes[1]) << 8 |
+                    static_cast<uint32_t>(size_bytes[2]) << 16 |
+                    static_cast<uint32_t>(size_bytes[3]) << 24;
+            std::vector<uint8_t> record(record_size);
+            if (!myfile.read(reinterpret_cast<char*>(record.data()), record_size))
+            {
+                // The last record was not completely written
+                break;
+            }
 
-    //         // Read every change, and store it in json format in a vector
-    //         new_changes.push_back(change_json);
-    //     }
+            // Read every change, and store it in json format in a vector
+            new_changes.push_back(nlohmann::json::from_cbor(record));
+        }
+
+        myfile.close();
+    }
+    catch (const std::exception& /* e */)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_PDP_SERVER, "Backup journal corrupted, restoring its first "
+                << new_changes.size() << " changes");
+    }
 
-    //     myfile.close();
-    // }
-    // catch(const std::exception& e)
-    // {
-    //     return ret;
-    // }
     return ret;
 }
 
@@ -1868,150 +1943,128 @@ bool PDPServer::process_backup_discovery_database_restore(
 }
 
 bool PDPServer::process_backup_restore_queue(
-        std::vector<nlohmann::json>& /* new_changes */)
+        std::vector<nlohmann::json>& new_changes)
 {
-    // fastrtps::rtps::SampleIdentity sample_identity_aux;
-    // fastrtps::rtps::InstanceHandle_t instance_handle_aux;
-    // uint32_t length;
-
-    // EDPServer* edp = static_cast<EDPServer*>(mp_EDP);
-    // EDPServerPUBListener* edp_pub_listener = static_cast<EDPServerPUBListener*>(edp->publications_listener_);
-    // EDPServerSUBListener* edp_sub_listener = static_cast<EDPServerSUBListener*>(edp->subscriptions_listener_);
-
-    // std::unique_lock<fastrtps::RecursiveTimedMutex> lock(endpoints->reader.reader_->getMutex());
-    // std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edpp(edp->publications_reader_.first->getMutex());
-    // std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edps(edp->subscriptions_reader_.first->getMutex());
-
-    // TODO uncomment this funcionality and update with pools when queue functionality is implemented
-    // try
-    // {
-    //     // Read every change and push it to the listener that it belongs
-    //     for (nlohmann::json& json_change : new_changes)
-    //     {
-    //         // std::cout << json_change << std::endl;
-    //         fastrtps::rtps::CacheChange_t* change_aux;
-    //         length = json_change["serialized_payload"]["length"].get<std::uint32_t>();
-    //         (std::istringstream) json_change["sample_identity"].get<std::string>() >> sample_identity_aux;
-    //         (std::istringstream) json_change["instance_handle"].get<std::string>() >> instance_handle_aux;
-
-    //         // Belongs to own server
-    //         if (sample_identity_aux.writer_guid() == endpoints->writer.writer_->getGuid())
-    //         {
-    //             if (discovery_db_.is_participant(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!endpoints->writer.history_->reserve_Cache(&change_aux, length))
-    //                             [this]() -> uint32_t
-    //                             {
-    //                                 return mp_PDP->builtin_attributes().readerPayloadSize;
-    //                             },
-    //                             &change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     mp_listener->onNewCacheChangeAdded(endpoints->reader.reader_, change_aux);
-    //                 }
-
-    //             }
-    //             else if (discovery_db_.is_writer(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->publications_writer_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_pub_listener->onNewCacheChangeAdded(edp->publications_reader_.first, change_aux);
-    //                 }
-    //             }
-    //             else if (discovery_db_.is_reader(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->subscriptions_writer_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_sub_listener->onNewCacheChangeAdded(edp->subscriptions_reader_.first, change_aux);
-    //                 }
-    //             }
-    //         }
-    //         // It came from outside
-    //         else
-    //         {
-    //             if (discovery_db_.is_participant(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!endpoints->reader.history_->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     mp_listener->onNewCacheChangeAdded(endpoints->reader.reader_, change_aux);
-    //                 }
-
-    //             }
-    //             else if (discovery_db_.is_writer(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->publications_reader_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_pub_listener->onNewCacheChangeAdded(edp->publications_reader_.first, change_aux);
-    //                 }
-    //             }
-    //             else if (discovery_db_.is_reader(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->subscriptions_reader_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_sub_listener->onNewCacheChangeAdded(edp->subscriptions_reader_.first, change_aux);
-    //                 }
-    //             }
-    //         }
-    //     }
-    // }
-    // catch (std::ios_base::failure&)
-    // {
-    //     // TODO clean changes in case it has been an error
-    //     EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "QUEUE BACKUP CORRUPTED");
-    //     return false;
-    // }
-    return true;
+    EPROSIMA_LOG_INFO(RTPS_PDP_SERVER, "Restoring " << new_changes.size() << " changes from the backup journal");
+
+    EDPServer* edp = static_cast<EDPServer*>(mp_EDP);
+
+    // These mutexes are necessary to send messages to the listeners
+    auto endpoints = static_cast<fastdds::rtps::DiscoveryServerPDPEndpoints*>(builtin_endpoints_.get());
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock(endpoints->reader.reader_->getMutex());
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edpp(edp->publications_reader_.first->getMutex());
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edps(edp->subscriptions_reader_.first->getMutex());
+
+    // The replayed changes are already in the journal
+    discovery_db_.restoring_backup_queue(true);
+
+    bool ret = true;
+    try
+    {
+        // Push every change to the listener of the reader it was received from, as if it had just arrived
+        for (nlohmann::json& json_change : new_changes)
+        {
+            fastrtps::rtps::InstanceHandle_t instance_handle_aux;
+            std::istringstream(json_change["instance_handle"].get<std::string>()) >> instance_handle_aux;
+            uint32_t length = json_change["serialized_payload"]["length"].get<std::uint32_t>();
+            EntityId_t entity_id = iHandle2GUID(instance_handle_aux).entityId;
+
+            fastrtps::rtps::RTPSReader* reader = nullptr;
+            fastrtps::rtps::ReaderHistory* history = nullptr;
+            fastrtps::rtps::ReaderListener* listener = nullptr;
+            if (entity_id == c_EntityId_RTPSParticipant)
+            {
+                reader = endpoints->reader.reader_;
+                history = endpoints->reader.history_.get();
+                listener = builtin_endpoints_->main_listener().get();
+            }
+            else if (entity_id.is_writer())
+            {
+                reader = edp->publications_reader_.first;
+                history = edp->publications_reader_.second;
+                listener = edp->publications_listener_;
+            }
+            else if (entity_id.is_reader())
+            {
+                reader = edp->subscriptions_reader_.first;
+                history = edp->subscriptions_reader_.second;
+                listener = edp->subscriptions_listener_;
+            }
+            else
+            {
+                EPROSIMA_LOG_WARNING(RTPS_PDP_SERVER, "Unknown entity in backup journal: " << instance_handle_aux);
+                continue;
+            }
+
+            fastrtps::rtps::CacheChange_t* change_aux = nullptr;
+            if (!reader->reserveCache(&change_aux, length))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
+                ret = false;
+                continue;
+            }
+
+            // The listeners take the change out of the reader history when the DDB takes its ownership
+            ddb::from_json(json_change, *change_aux);
+            if (!history->received_change(change_aux, 0))
+            {
+                reader->releaseCache(change_aux);
+                ret = false;
+                continue;
+            }
+            listener->onNewCacheChangeAdded(reader, change_aux);
+        }
+    }
+    catch (const std::exception&)
+    {
+        EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "QUEUE BACKUP CORRUPTED");
+        ret = false;
+    }
+
+    discovery_db_.restoring_backup_queue(false);
+    return ret;
 }
 
 void PDPServer::process_backup_store()
 {
-    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Dump DDB in json backup");
+    // Until the journal is large enough, the changes stored in it are enough to restore the DDB from the last backup
+    if (discovery_db_.backup_queue_size() < backup_queue_compaction_threshold_)
+    {
+        return;
+    }
 
-    // This will erase the last backup stored
-    std::ofstream backup_json_file;
-    backup_json_file.open(get_ddb_persistence_file_name(), std::ios_base::out);
+    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Dump DDB in binary backup");
 
     // Set j with the json from database dump
     nlohmann::json j;
     discovery_db().to_json(j);
-    // setw makes pretty print for json
-    backup_json_file << std::setw(4) << j << std::endl;
-    backup_json_file.close();
+
+    // The snapshot is stored in a temporary file that then replaces the last backup stored, so a failure while
+    // storing it never leaves a partial backup behind
+    std::string backup_file_name = get_ddb_persistence_file_name();
+    std::string tmp_file_name = backup_file_name + ".tmp";
+    {
+        std::ofstream backup_file(tmp_file_name, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        nlohmann::json::to_cbor(j, backup_file);
+        backup_file.flush();
+        if (!backup_file)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error storing DiscoveryDataBase backup in " << tmp_file_name);
+            return;
+        }
+    }
+
+#ifdef _WIN32
+    // rename does not replace existing files on Windows
+    if (!MoveFileExA(tmp_file_name.c_str(), backup_file_name.c_str(),
+            MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+#else
+    if (0 != std::rename(tmp_file_name.c_str(), backup_file_name.c_str()))
+#endif // ifdef _WIN32
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error replacing DiscoveryDataBase backup " << backup_file_name);
+        return;
+    }
 
     // Clear queue ddb backup
     discovery_db_.clean_backup();
@@ -159,10 +159,13 @@ public:
     //! Get filename for reader persistence database file
     std::string get_reader_persistence_file_name() const;
 
-    //! Get filename for discovery database file
+    //! Get filename for discovery database binary snapshot
     std::string get_ddb_persistence_file_name() const;
 
-    //! Get filename for discovery database file
+    //! Get filename for discovery database JSON backup, stored by previous versions
+    std::string get_ddb_legacy_persistence_file_name() const;
+
+    //! Get filename for discovery database journal of received changes
     std::string get_ddb_queue_persistence_file_name() const;
 
     /*
@@ -275,6 +278,7 @@ protected:
     // Reads the two backup files and stores each json objects in both arguments
     // The first argument has the json object to restore the DDB
     // The second argument has the json vector object to restore the changes that must be sent again to the queue
+    // Returns whether the DDB backup could be read. The journal is read anyway, up to its last complete change
     bool read_backup(
             nlohmann::json& ddb_json,
             std::vector<nlohmann::json>& new_changes);
@@ -286,6 +290,7 @@ protected:
 
     // Erase the last file and store the backup info of the actual state of the DDB
     // Erase the content of the file with the changes in the queues
+    // This is only done once the file with the changes in the queues reaches the compaction threshold
     // This method must be called after the whole DDB routine process has been finished and with the DDB
     // queues empty. If not, there will be some information that could be lost. For this, the lock_incoming_data()
     // from DDB must be called during this process
@@ -386,6 +391,9 @@ private:
     //! TRANSIENT or TRANSIENT_LOCAL durability;
     fastrtps::rtps::DurabilityKind_t durability_;
 
+    //! Size in bytes of the backup journal above which the DiscoveryDataBase is compacted to a new backup
+    size_t backup_queue_compaction_threshold_;
+
 };
 
 } // namespace rtps
@@ -22,6 +22,7 @@
 
 #include <fastdds/dds/builtin/typelookup/TypeLookupManager.hpp>
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/builtin/BuiltinProtocols.h>
 #include <fastdds/rtps/builtin/data/NetworkConfiguration.hpp>
 #include <fastdds/rtps/builtin/data/ParticipantProxyData.h>
@@ -154,6 +155,21 @@ bool PDPSimple::init(
         return false;
     }
 
+    // Replace periodic announcements by HEARTBEATs between two full DATA(p), if requested
+    try
+    {
+        const std::string* delta_announcements_property = PropertyPolicyHelper::find_property(
+            mp_RTPSParticipant->getAttributes().properties, "fastdds.discovery.delta_announcements");
+        if (delta_announcements_property != nullptr)
+        {
+            heartbeat_announcements_ = static_cast<uint32_t>(std::stoul(*delta_announcements_property));
+        }
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PDP, "Error parsing delta announcements property: " << e.what());
+    }
+
     //INIT EDP
     if (m_discovery.discovery_config.use_STATIC_EndpointDiscoveryProtocol)
     {
@@ -285,7 +301,20 @@ void PDPSimple::announceParticipantState(
 
         if (!(dispose || new_change))
         {
-            endpoints->writer.writer_->unsent_changes_reset();
+            // A HEARTBEAT is enough to keep the lease of the local participant alive on remote participants.
+            // Its last sequence number is the one of the current DATA(p), which acts as version of its state.
+            // Remote participants discovered later receive the full DATA(p) when they are matched.
+            bool send_heartbeat = (0 < heartbeat_announcements_) && !initial_announcements_pending() &&
+                    (consecutive_heartbeat_announcements_ < heartbeat_announcements_);
+            if (send_heartbeat && endpoints->writer.writer_->send_heartbeat())
+            {
+                ++consecutive_heartbeat_announcements_;
+            }
+            else
+            {
+                consecutive_heartbeat_announcements_ = 0;
+                endpoints->writer.writer_->unsent_changes_reset();
+            }
         }
     }
 }
@@ -95,6 +95,13 @@ public:
      * @return Maximum number of bytes of a RTPS message.
      */
     virtual uint32_t get_max_payload() = 0;
+
+    /*!
+     * Return whether new samples are sent using the thread of the writer that adds them.
+     *
+     * @return true when new samples are sent synchronously.
+     */
+    virtual bool is_synchronous() const = 0;
 };
 
 } // namespace rtps
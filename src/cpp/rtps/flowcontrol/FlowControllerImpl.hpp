@@ -1049,6 +1049,11 @@ public:
         return get_max_payload_impl();
     }
 
+    bool is_synchronous() const override
+    {
+        return std::is_base_of<FlowControllerPureSyncPublishMode, PublishMode>::value;
+    }
+
 private:
 
     /*!
@@ -1175,6 +1180,28 @@ private:
         bool ret_value = false;
         // This call should be made with writer's mutex locked.
         fastrtps::rtps::LocatorSelectorSender& locator_selector = writer->get_general_locator_selector();
+
+        // When the writer has a batch of samples open, its message group is used and the locator selector is already
+        // locked.
+        fastrtps::rtps::RTPSMessageGroup* batch_group = writer->sample_batch_group_nts();
+        if (nullptr != batch_group)
+        {
+            try
+            {
+                ret_value = true;
+                if (fastrtps::rtps::DeliveryRetCode::DELIVERED !=
+                        writer->deliver_sample_nts(change, *batch_group, locator_selector, max_blocking_time))
+                {
+                    ret_value =  enqueue_new_sample_impl(writer, change, max_blocking_time);
+                }
+            }
+            catch (fastrtps::rtps::RTPSMessageGroup::timeout&)
+            {
+            }
+
+            return ret_value;
+        }
+
 #if HAVE_STRICT_REALTIME
         std::unique_lock<fastrtps::rtps::LocatorSelectorSender> lock(locator_selector, std::defer_lock);
         if (lock.try_lock_until(max_blocking_time))
@@ -94,6 +94,8 @@ private:
             case DYNAMIC_RESERVE_MEMORY_MODE:
                 return std::make_shared<detail::Impl<DYNAMIC_RESERVE_MEMORY_MODE>>();
             case DYNAMIC_REUSABLE_MEMORY_MODE:
+            // Basic pools are only used for small internal histories, where size classes do not pay off
+            case DYNAMIC_SIZE_CLASS_MEMORY_MODE:
                 return std::make_shared<detail::Impl<DYNAMIC_REUSABLE_MEMORY_MODE>>();
         }
 
@@ -88,6 +88,10 @@ void CacheChangePool::init(
             EPROSIMA_LOG_INFO(RTPS_UTILS,
                     "Semi-Dynamic Mode is active, no preallocation but dynamically allocated CacheChanges are reused for future cachechanges");
             break;
+        case DYNAMIC_SIZE_CLASS_MEMORY_MODE:
+            EPROSIMA_LOG_INFO(RTPS_UTILS,
+                    "Size-Class Mode is active, no preallocation but dynamically allocated CacheChanges are reused for future cachechanges");
+            break;
     }
 }
 
@@ -165,9 +169,11 @@ CacheChange_t* CacheChangePool::allocateSingle()
     bool added = false;
     CacheChange_t* ch = nullptr;
 
-    // This method should only be called from within DYNAMIC_RESERVE_MEMORY_MODE or DYNAMIC_REUSABLE_MEMORY_MODE
+    // This method should only be called from within DYNAMIC_RESERVE_MEMORY_MODE, DYNAMIC_REUSABLE_MEMORY_MODE or
+    // DYNAMIC_SIZE_CLASS_MEMORY_MODE
     assert(memory_mode_ == DYNAMIC_RESERVE_MEMORY_MODE ||
-            memory_mode_ == DYNAMIC_REUSABLE_MEMORY_MODE);
+            memory_mode_ == DYNAMIC_REUSABLE_MEMORY_MODE ||
+            memory_mode_ == DYNAMIC_SIZE_CLASS_MEMORY_MODE);
 
     if (current_pool_size_ < max_pool_size_)
     {
@@ -205,6 +211,7 @@ bool CacheChangePool::reserve_cache(
 
             case DYNAMIC_RESERVE_MEMORY_MODE:
             case DYNAMIC_REUSABLE_MEMORY_MODE:
+            case DYNAMIC_SIZE_CLASS_MEMORY_MODE:
                 cache_change = allocateSingle(); //Allocates a single, empty CacheChange
                 return cache_change != nullptr;
 
@@ -226,6 +233,7 @@ bool CacheChangePool::release_cache(
         case PREALLOCATED_MEMORY_MODE:
         case PREALLOCATED_WITH_REALLOC_MEMORY_MODE:
         case DYNAMIC_REUSABLE_MEMORY_MODE:
+        case DYNAMIC_SIZE_CLASS_MEMORY_MODE:
             return_cache_to_pool(cache_change);
             break;
 
@@ -206,7 +206,7 @@ bool ReaderHistory::remove_fragmented_changes_until(
     }
 
     std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
-    std::vector<CacheChange_t*>::iterator chit = m_changes.begin();
+    iterator chit = m_changes.begin();
     while (chit != m_changes.end())
     {
         CacheChange_t* item = *chit;
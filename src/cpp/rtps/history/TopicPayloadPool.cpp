@@ -23,13 +23,28 @@
 #include "./TopicPayloadPool_impl/PreallocatedWithRealloc.hpp"
 #include "./TopicPayloadPool_impl/Dynamic.hpp"
 #include "./TopicPayloadPool_impl/DynamicReusable.hpp"
+#include "./TopicPayloadPool_impl/SizeClass.hpp"
 
+#include <algorithm>
+#include <functional>
 #include <memory>
+#include <thread>
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+constexpr size_t TopicPayloadPool::num_caches_;
+constexpr size_t TopicPayloadPool::cache_batch_size_;
+
+TopicPayloadPool::TopicPayloadPool()
+{
+    for (PayloadCache& cache : caches_)
+    {
+        cache.payloads.reserve(2 * cache_batch_size_ + 1);
+    }
+}
+
 bool TopicPayloadPool::get_payload(
         uint32_t size,
         CacheChange_t& cache_change)
@@ -42,25 +57,13 @@ bool TopicPayloadPool::do_get_payload(
         CacheChange_t& cache_change,
         bool resizeable)
 {
-    PayloadNode* payload = nullptr;
-
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (free_payloads_.empty())
-    {
-        payload = allocate(size); //Allocates a single payload
-        if (payload == nullptr)
-        {
-            lock.unlock();
-            cache_change.serializedPayload.data = nullptr;
-            cache_change.serializedPayload.max_size = 0;
-            cache_change.payload_owner(nullptr);
-            return false;
-        }
-    }
-    else
+    PayloadNode* payload = take_free_payload(size);
+    if (payload == nullptr)
     {
-        payload = free_payloads_.back();
-        free_payloads_.pop_back();
+        cache_change.serializedPayload.data = nullptr;
+        cache_change.serializedPayload.max_size = 0;
+        cache_change.payload_owner(nullptr);
+        return false;
     }
 
     // Resize if needed
@@ -69,8 +72,7 @@ bool TopicPayloadPool::do_get_payload(
         if (!payload->resize(size))
         {
             // Failed to resize, but we can still keep it for later.
-            free_payloads_.push_back(payload);
-            lock.unlock();
+            return_free_payload(payload);
             EPROSIMA_LOG_ERROR(RTPS_HISTORY, "Failed to resize the payload");
 
             cache_change.serializedPayload.data = nullptr;
@@ -80,7 +82,6 @@ bool TopicPayloadPool::do_get_payload(
         }
     }
 
-    lock.unlock();
     payload->reference();
     cache_change.serializedPayload.data = payload->data();
     cache_change.serializedPayload.max_size = payload->data_size();
@@ -138,9 +139,7 @@ bool TopicPayloadPool::release_payload(
 
     if (PayloadNode::dereference(cache_change.serializedPayload.data))
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        PayloadNode* payload = all_payloads_.at(PayloadNode::data_index(cache_change.serializedPayload.data));
-        free_payloads_.push_back(payload);
+        return_free_payload(PayloadNode::node(cache_change.serializedPayload.data));
     }
 
     cache_change.serializedPayload.length = 0;
@@ -174,6 +173,97 @@ bool TopicPayloadPool::release_history(
     return shrink(max_pool_size_);
 }
 
+TopicPayloadPool::PayloadNode* TopicPayloadPool::take_free_payload(
+        uint32_t size)
+{
+    PayloadCache& cache = cache_for_this_thread();
+
+    {
+        std::lock_guard<std::mutex> cache_lock(cache.mutex);
+        if (!cache.payloads.empty())
+        {
+            PayloadNode* payload = cache.payloads.back();
+            cache.payloads.pop_back();
+            cached_payloads_count_.fetch_sub(1, std::memory_order_relaxed);
+            return payload;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_payloads_.empty() && all_payloads_.size() >= max_pool_size_)
+    {
+        // The free payloads may be held on the caches of other threads
+        flush_caches();
+    }
+
+    if (free_payloads_.empty())
+    {
+        return allocate(size); //Allocates a single payload
+    }
+
+    PayloadNode* payload = free_payloads_.back();
+    free_payloads_.pop_back();
+
+    // Refill the cache of this thread for the next calls
+    size_t num_moved = (std::min)(cache_batch_size_, free_payloads_.size());
+    if (0 < num_moved)
+    {
+        std::lock_guard<std::mutex> cache_lock(cache.mutex);
+        cache.payloads.insert(cache.payloads.end(), free_payloads_.end() - num_moved, free_payloads_.end());
+        cached_payloads_count_.fetch_add(num_moved, std::memory_order_relaxed);
+        free_payloads_.resize(free_payloads_.size() - num_moved);
+    }
+
+    return payload;
+}
+
+void TopicPayloadPool::return_free_payload(
+        PayloadNode* payload)
+{
+    PayloadCache& cache = cache_for_this_thread();
+
+    {
+        std::lock_guard<std::mutex> cache_lock(cache.mutex);
+        cache.payloads.push_back(payload);
+        cached_payloads_count_.fetch_add(1, std::memory_order_relaxed);
+        if (cache.payloads.size() <= 2 * cache_batch_size_)
+        {
+            return;
+        }
+    }
+
+    // Give back the excess to the shared list. Both mutexes are taken, so the payloads are always visible to
+    // flush_caches().
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<std::mutex> cache_lock(cache.mutex);
+    if (cache.payloads.size() > cache_batch_size_)
+    {
+        size_t num_excess = cache.payloads.size() - cache_batch_size_;
+        free_payloads_.insert(free_payloads_.end(), cache.payloads.end() - num_excess, cache.payloads.end());
+        cache.payloads.resize(cache_batch_size_);
+        cached_payloads_count_.fetch_sub(num_excess, std::memory_order_relaxed);
+    }
+}
+
+void TopicPayloadPool::flush_caches()
+{
+    for (PayloadCache& cache : caches_)
+    {
+        std::lock_guard<std::mutex> cache_lock(cache.mutex);
+        free_payloads_.insert(free_payloads_.end(), cache.payloads.begin(), cache.payloads.end());
+        cached_payloads_count_.fetch_sub(cache.payloads.size(), std::memory_order_relaxed);
+        cache.payloads.clear();
+    }
+}
+
+TopicPayloadPool::PayloadCache& TopicPayloadPool::cache_for_this_thread()
+{
+    // Thread ids are usually addresses, so the hash is mixed before taking its upper bits
+    uint64_t hash = static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    hash *= 0x9E3779B97F4A7C15ull;
+    return caches_[static_cast<size_t>(hash >> 32) % num_caches_];
+}
+
 TopicPayloadPool::PayloadNode* TopicPayloadPool::allocate(
         uint32_t size)
 {
@@ -262,6 +352,8 @@ void TopicPayloadPool::reserve (
 bool TopicPayloadPool::shrink (
         uint32_t max_num_payloads)
 {
+    flush_caches();
+
     assert(payload_pool_allocated_size() - payload_pool_available_size() <= max_num_payloads);
 
     while (max_num_payloads < all_payloads_.size())
@@ -303,6 +395,9 @@ std::unique_ptr<ITopicPayloadPool> TopicPayloadPool::get(
         case DYNAMIC_REUSABLE_MEMORY_MODE:
             ret_val = new DynamicReusableTopicPayloadPool();
             break;
+        case DYNAMIC_SIZE_CLASS_MEMORY_MODE:
+            ret_val = new SizeClassTopicPayloadPool();
+            break;
     }
 
     return std::unique_ptr<ITopicPayloadPool>(ret_val);
@@ -26,6 +26,7 @@
 #include <rtps/history/PoolConfig.h>
 #include <rtps/history/ITopicPayloadPool.h>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <memory>
@@ -41,7 +42,7 @@ class TopicPayloadPool : public ITopicPayloadPool
 
 public:
 
-    TopicPayloadPool() = default;
+    TopicPayloadPool();
 
     virtual ~TopicPayloadPool()
     {
@@ -124,7 +125,7 @@ public:
 
     size_t payload_pool_available_size() const override
     {
-        return free_payloads_.size();
+        return free_payloads_.size() + cached_payloads_count_.load(std::memory_order_relaxed);
     }
 
     static std::unique_ptr<ITopicPayloadPool> get(
@@ -157,6 +158,7 @@ protected:
 
             // The atomic may need some initialization depending on the platform
             new (buffer) NodeInfo();
+            info().node = this;
             data_size(size);
         }
 
@@ -222,6 +224,12 @@ protected:
             return info().data;
         }
 
+        static PayloadNode* node(
+                octet* data)
+        {
+            return info(data).node;
+        }
+
         void reference()
         {
             info().ref_counter.fetch_add(1, std::memory_order_relaxed);
@@ -251,6 +259,7 @@ protected:
             std::atomic<uint32_t> ref_counter{ 0 };
             uint32_t data_size = 0;
             uint32_t data_index = 0;
+            PayloadNode* node = nullptr;
             octet data[1];
         };
 
@@ -272,6 +281,50 @@ protected:
 
     };
 
+    /**
+     * Free payloads cached for the threads mapped to it, so they can be taken and returned without contending
+     * on @c mutex_. Payloads are moved between the caches and @c free_payloads_ in batches.
+     * When the pool has reached its maximum size, all the caches are drained into @c free_payloads_ before
+     * failing to get a payload, so the payloads released by other threads are never lost for the caller.
+     */
+    struct PayloadCache
+    {
+        std::mutex mutex;
+        std::vector<PayloadNode*> payloads;
+    };
+
+    //! Number of caches. Threads are mapped to them by the hash of their id.
+    static constexpr size_t num_caches_ = 8;
+    //! Number of payloads moved at once between a cache and @c free_payloads_.
+    static constexpr size_t cache_batch_size_ = 8;
+
+    /**
+     * Takes a free payload, or allocates a new one if there are none.
+     * When there are no free payloads and the pool cannot grow, the caches of all the threads are drained first.
+     *
+     * @param [IN] size  Minimum size required for the payload data when a new one is allocated
+     * @return A free payload, or nullptr when none is available and the maximum size of the pool has been reached.
+     */
+    PayloadNode* take_free_payload(
+            uint32_t size);
+
+    /**
+     * Returns a payload to the cache of the calling thread.
+     *
+     * @param [IN] payload  The payload to return
+     */
+    void return_free_payload(
+            PayloadNode* payload);
+
+    /**
+     * Moves the payloads in all the caches to @c free_payloads_.
+     *
+     * @pre @c mutex_ is locked
+     */
+    void flush_caches();
+
+    PayloadCache& cache_for_this_thread();
+
     /**
      * Adds a new payload in the pool, but does not add it to the list of free payloads
      *
@@ -355,9 +408,13 @@ protected:
     uint32_t infinite_histories_count_  = 0;  //< Number of infinite histories reserved
     uint32_t finite_max_pool_size_      = 0;  //< Maximum size of the pool if no infinite histories were reserved
 
-    std::vector<PayloadNode*> free_payloads_; //< Payloads that are free
+    std::vector<PayloadNode*> free_payloads_; //< Payloads that are free, and not held on any cache
     std::vector<PayloadNode*> all_payloads_;  //< All payloads
 
+    std::array<PayloadCache, num_caches_> caches_;          //< Per-thread caches of free payloads
+    std::atomic<size_t> cached_payloads_count_{ 0 };        //< Number of payloads held on the caches
+
+    //! Protects all the members except the caches. Should be locked before the mutex of any cache.
     std::mutex mutex_;
 
 };
@@ -66,6 +66,8 @@ public:
                 return do_get(it->second.pool_for_dynamic, topic_name, config);
             case DYNAMIC_REUSABLE_MEMORY_MODE:
                 return do_get(it->second.pool_for_dynamic_reusable, topic_name, config);
+            case DYNAMIC_SIZE_CLASS_MEMORY_MODE:
+                return do_get(it->second.pool_for_dynamic_size_class, topic_name, config);
         }
 
         return nullptr;
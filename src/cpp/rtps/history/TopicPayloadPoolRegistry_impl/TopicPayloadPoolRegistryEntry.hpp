@@ -33,6 +33,7 @@ struct TopicPayloadPoolRegistryEntry
     std::weak_ptr<TopicPayloadPoolProxy> pool_for_preallocated_realloc;
     std::weak_ptr<TopicPayloadPoolProxy> pool_for_dynamic;
     std::weak_ptr<TopicPayloadPoolProxy> pool_for_dynamic_reusable;
+    std::weak_ptr<TopicPayloadPoolProxy> pool_for_dynamic_size_class;
 };
 
 }  // namespace detail
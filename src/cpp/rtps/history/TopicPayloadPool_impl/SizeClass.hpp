@@ -0,0 +1,560 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SizeClass.hpp
+ */
+
+#ifndef RTPS_HISTORY_TOPICPAYLOADPOOLIMPL_SIZE_CLASS_HPP
+#define RTPS_HISTORY_TOPICPAYLOADPOOLIMPL_SIZE_CLASS_HPP
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <rtps/history/ITopicPayloadPool.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Payload pool for DYNAMIC_SIZE_CLASS_MEMORY_MODE.
+ *
+ * Payloads are served from power-of-two size classes. The blocks of each class are carved from slabs allocated in a
+ * single call, so samples of very different sizes do not fragment the heap. Payloads bigger than the largest class
+ * are allocated individually.
+ *
+ * Each class keeps at most one completely free slab. The rest are freed as soon as they become free, and
+ * @ref trim frees the remaining ones.
+ */
+class SizeClassTopicPayloadPool : public ITopicPayloadPool
+{
+public:
+
+    //! Statistics of a size class.
+    struct SizeClassStatistics
+    {
+        //! Capacity of the payloads on the class. Zero for payloads bigger than the largest class.
+        uint32_t block_size = 0;
+        //! Number of slabs allocated for the class.
+        uint32_t num_slabs = 0;
+        //! Number of payloads allocated, including the ones in use.
+        uint32_t num_blocks = 0;
+        //! Number of payloads in use.
+        uint32_t blocks_in_use = 0;
+        //! Number of bytes allocated for the class.
+        uint64_t allocated_bytes = 0;
+    };
+
+    //! Capacity of the smallest class.
+    static constexpr uint32_t min_block_size = 64u;
+    //! Number of classes. The largest one is 4 MiB.
+    static constexpr size_t num_size_classes = 17u;
+    //! Approximated size of a slab.
+    static constexpr size_t slab_size = 256u * 1024u;
+    //! Maximum number of payloads on a slab.
+    static constexpr uint32_t max_blocks_per_slab = 64u;
+
+    SizeClassTopicPayloadPool()
+    {
+        for (size_t i = 0; i < num_size_classes; ++i)
+        {
+            SizeClass& size_class = size_classes_[i];
+            size_class.block_size = min_block_size << i;
+            size_class.block_stride = stride(size_class.block_size);
+            size_t blocks = slab_size / size_class.block_stride;
+            size_class.blocks_per_slab = static_cast<uint32_t>(
+                blocks == 0 ? 1u : (blocks > max_blocks_per_slab ? max_blocks_per_slab : blocks));
+        }
+    }
+
+    ~SizeClassTopicPayloadPool()
+    {
+        EPROSIMA_LOG_INFO(RTPS_UTILS, "PayloadPool destructor");
+
+        for (SizeClass& size_class : size_classes_)
+        {
+            for (Slab* slab : size_class.slabs)
+            {
+                free(slab->memory);
+                delete slab;
+            }
+        }
+
+        for (Slab* slab : huge_slabs_)
+        {
+            free(slab->memory);
+            delete slab;
+        }
+    }
+
+    bool get_payload(
+            uint32_t size,
+            CacheChange_t& cache_change) override
+    {
+        BlockInfo* block = take_block(size);
+        if (block == nullptr)
+        {
+            cache_change.serializedPayload.data = nullptr;
+            cache_change.serializedPayload.max_size = 0;
+            cache_change.payload_owner(nullptr);
+            return false;
+        }
+
+        block->ref_counter.fetch_add(1, std::memory_order_relaxed);
+        cache_change.serializedPayload.data = block->data;
+        cache_change.serializedPayload.max_size = block->capacity;
+        cache_change.payload_owner(this);
+        return true;
+    }
+
+    bool get_payload(
+            SerializedPayload_t& data,
+            IPayloadPool*& data_owner,
+            CacheChange_t& cache_change) override
+    {
+        assert(cache_change.writerGUID != GUID_t::unknown());
+        assert(cache_change.sequenceNumber != SequenceNumber_t::unknown());
+
+        if (data_owner == this)
+        {
+            BlockInfo& block = info(data.data);
+            block.ref_counter.fetch_add(1, std::memory_order_relaxed);
+
+            cache_change.serializedPayload.data = data.data;
+            cache_change.serializedPayload.length = data.length;
+            cache_change.serializedPayload.max_size = block.capacity;
+            cache_change.payload_owner(this);
+            return true;
+        }
+
+        if (get_payload(data.length, cache_change))
+        {
+            if (!cache_change.serializedPayload.copy(&data, true))
+            {
+                release_payload(cache_change);
+                return false;
+            }
+
+            if (data_owner == nullptr)
+            {
+                data_owner = this;
+                data.data = cache_change.serializedPayload.data;
+                info(data.data).ref_counter.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
+    bool release_payload(
+            CacheChange_t& cache_change) override
+    {
+        assert(cache_change.payload_owner() == this);
+
+        BlockInfo& block = info(cache_change.serializedPayload.data);
+        if (block.ref_counter.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            return_block(&block);
+        }
+
+        cache_change.serializedPayload.length = 0;
+        cache_change.serializedPayload.pos = 0;
+        cache_change.serializedPayload.max_size = 0;
+        cache_change.serializedPayload.data = nullptr;
+        cache_change.payload_owner(nullptr);
+        return true;
+    }
+
+    bool reserve_history(
+            const PoolConfig& config,
+            bool /*is_reader*/) override
+    {
+        assert(config.memory_policy == DYNAMIC_SIZE_CLASS_MEMORY_MODE);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (config.maximum_size == 0)
+        {
+            ++infinite_histories_count_;
+        }
+        else
+        {
+            finite_max_pool_size_ += (std::max)(config.initial_size, config.maximum_size);
+        }
+        return true;
+    }
+
+    bool release_history(
+            const PoolConfig& config,
+            bool /*is_reader*/) override
+    {
+        assert(config.memory_policy == DYNAMIC_SIZE_CLASS_MEMORY_MODE);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (config.maximum_size == 0)
+        {
+            --infinite_histories_count_;
+        }
+        else
+        {
+            finite_max_pool_size_ -= (std::max)(config.initial_size, config.maximum_size);
+        }
+        trim_nts();
+        return true;
+    }
+
+    size_t payload_pool_allocated_size() const override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return allocated_blocks_;
+    }
+
+    size_t payload_pool_available_size() const override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return allocated_blocks_ - blocks_in_use_;
+    }
+
+    /**
+     * Free all the slabs without payloads in use.
+     *
+     * @return Number of slabs freed.
+     */
+    size_t trim()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return trim_nts();
+    }
+
+    /**
+     * Get the statistics of every size class.
+     *
+     * @return One entry per size class, ordered by block size, plus a last entry for the payloads bigger than the
+     * largest class.
+     */
+    std::vector<SizeClassStatistics> get_statistics() const
+    {
+        std::vector<SizeClassStatistics> ret;
+        ret.reserve(num_size_classes + 1);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const SizeClass& size_class : size_classes_)
+        {
+            SizeClassStatistics stats;
+            stats.block_size = size_class.block_size;
+            stats.num_slabs = static_cast<uint32_t>(size_class.slabs.size());
+            stats.num_blocks = stats.num_slabs * size_class.blocks_per_slab;
+            stats.blocks_in_use = size_class.blocks_in_use;
+            stats.allocated_bytes = static_cast<uint64_t>(stats.num_blocks) * size_class.block_stride;
+            ret.push_back(stats);
+        }
+
+        SizeClassStatistics huge_stats;
+        huge_stats.num_slabs = static_cast<uint32_t>(huge_slabs_.size());
+        huge_stats.num_blocks = huge_stats.num_slabs;
+        huge_stats.blocks_in_use = huge_stats.num_slabs;
+        for (const Slab* slab : huge_slabs_)
+        {
+            huge_stats.allocated_bytes += stride(reinterpret_cast<const BlockInfo*>(slab->memory)->capacity);
+        }
+        ret.push_back(huge_stats);
+
+        return ret;
+    }
+
+private:
+
+    struct Slab;
+
+    struct BlockInfo
+    {
+        std::atomic<uint32_t> ref_counter{ 0 };
+        uint32_t capacity = 0;
+        Slab* slab = nullptr;
+        octet data[1];
+    };
+
+    struct SizeClass;
+
+    struct Slab
+    {
+        //! Memory where the blocks are placed.
+        octet* memory = nullptr;
+        //! Class of the slab. nullptr for individually allocated payloads.
+        SizeClass* size_class = nullptr;
+        //! Free blocks on the slab.
+        std::vector<BlockInfo*> free_blocks;
+        //! Position on the list of slabs of its class (or the list of individually allocated payloads).
+        size_t index = 0;
+        //! Position on the list of slabs with free blocks of its class.
+        size_t partial_index = 0;
+    };
+
+    struct SizeClass
+    {
+        uint32_t block_size = 0;
+        size_t block_stride = 0;
+        uint32_t blocks_per_slab = 0;
+        uint32_t blocks_in_use = 0;
+        //! Number of slabs without any block in use.
+        uint32_t empty_slabs = 0;
+        std::vector<Slab*> slabs;
+        std::vector<Slab*> partial_slabs;
+    };
+
+    static constexpr size_t data_offset = offsetof(BlockInfo, data);
+
+    static size_t stride(
+            uint32_t capacity)
+    {
+        return (data_offset + capacity + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+    }
+
+    static BlockInfo& info(
+            octet* data)
+    {
+        return *reinterpret_cast<BlockInfo*>(data - data_offset);
+    }
+
+    static size_t class_index(
+            uint32_t size)
+    {
+        size_t index = 0;
+        while ((min_block_size << index) < size)
+        {
+            ++index;
+        }
+        return index;
+    }
+
+    uint32_t max_pool_size() const
+    {
+        return infinite_histories_count_ == 0 ? finite_max_pool_size_ : (std::numeric_limits<uint32_t>::max)();
+    }
+
+    BlockInfo* take_block(
+            uint32_t size)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (blocks_in_use_ >= max_pool_size())
+        {
+            EPROSIMA_LOG_WARNING(RTPS_HISTORY, "Maximum number of allowed reserved payloads reached");
+            return nullptr;
+        }
+
+        BlockInfo* block = nullptr;
+        if (size > (min_block_size << (num_size_classes - 1)))
+        {
+            block = allocate_huge_block(size);
+        }
+        else
+        {
+            SizeClass& size_class = size_classes_[class_index(size)];
+            if (size_class.partial_slabs.empty() && !allocate_slab(size_class))
+            {
+                return nullptr;
+            }
+
+            Slab* slab = size_class.partial_slabs.back();
+            if (slab->free_blocks.size() == size_class.blocks_per_slab)
+            {
+                --size_class.empty_slabs;
+            }
+            block = slab->free_blocks.back();
+            slab->free_blocks.pop_back();
+            if (slab->free_blocks.empty())
+            {
+                remove_from_partial(size_class, slab);
+            }
+            ++size_class.blocks_in_use;
+        }
+
+        if (block != nullptr)
+        {
+            ++blocks_in_use_;
+        }
+        return block;
+    }
+
+    void return_block(
+            BlockInfo* block)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --blocks_in_use_;
+
+        Slab* slab = block->slab;
+        if (slab->size_class == nullptr)
+        {
+            huge_slabs_.back()->index = slab->index;
+            huge_slabs_[slab->index] = huge_slabs_.back();
+            huge_slabs_.pop_back();
+            --allocated_blocks_;
+            free(slab->memory);
+            delete slab;
+            return;
+        }
+
+        SizeClass& size_class = *slab->size_class;
+        --size_class.blocks_in_use;
+        slab->free_blocks.push_back(block);
+        if (slab->free_blocks.size() == 1u)
+        {
+            slab->partial_index = size_class.partial_slabs.size();
+            size_class.partial_slabs.push_back(slab);
+        }
+
+        if (slab->free_blocks.size() == size_class.blocks_per_slab)
+        {
+            // Keep one free slab per class, so a class used at its limit does not allocate and free continuously
+            if (size_class.empty_slabs > 0)
+            {
+                free_slab(size_class, slab);
+            }
+            else
+            {
+                ++size_class.empty_slabs;
+            }
+        }
+    }
+
+    bool allocate_slab(
+            SizeClass& size_class)
+    {
+        Slab* slab = new (std::nothrow) Slab();
+        octet* memory = static_cast<octet*>(calloc(size_class.blocks_per_slab, size_class.block_stride));
+        if (slab == nullptr || memory == nullptr)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_HISTORY, "Failure to create a new payload slab");
+            delete slab;
+            free(memory);
+            return false;
+        }
+
+        slab->memory = memory;
+        slab->size_class = &size_class;
+        slab->free_blocks.reserve(size_class.blocks_per_slab);
+        // Blocks are pushed in reverse order, so they are taken in memory order
+        for (uint32_t i = size_class.blocks_per_slab; i > 0; --i)
+        {
+            BlockInfo* block = new (memory + (i - 1) * size_class.block_stride) BlockInfo();
+            block->capacity = size_class.block_size;
+            block->slab = slab;
+            slab->free_blocks.push_back(block);
+        }
+
+        slab->index = size_class.slabs.size();
+        size_class.slabs.push_back(slab);
+        slab->partial_index = size_class.partial_slabs.size();
+        size_class.partial_slabs.push_back(slab);
+        ++size_class.empty_slabs;
+        allocated_blocks_ += size_class.blocks_per_slab;
+        return true;
+    }
+
+    BlockInfo* allocate_huge_block(
+            uint32_t size)
+    {
+        Slab* slab = new (std::nothrow) Slab();
+        octet* memory = static_cast<octet*>(calloc(1, stride(size)));
+        if (slab == nullptr || memory == nullptr)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_HISTORY, "Failure to create a new payload");
+            delete slab;
+            free(memory);
+            return nullptr;
+        }
+
+        BlockInfo* block = new (memory) BlockInfo();
+        block->capacity = size;
+        block->slab = slab;
+
+        slab->memory = memory;
+        slab->index = huge_slabs_.size();
+        huge_slabs_.push_back(slab);
+        ++allocated_blocks_;
+        return block;
+    }
+
+    void remove_from_partial(
+            SizeClass& size_class,
+            Slab* slab)
+    {
+        size_class.partial_slabs.back()->partial_index = slab->partial_index;
+        size_class.partial_slabs[slab->partial_index] = size_class.partial_slabs.back();
+        size_class.partial_slabs.pop_back();
+    }
+
+    void free_slab(
+            SizeClass& size_class,
+            Slab* slab)
+    {
+        assert(slab->free_blocks.size() == size_class.blocks_per_slab);
+
+        remove_from_partial(size_class, slab);
+        size_class.slabs.back()->index = slab->index;
+        size_class.slabs[slab->index] = size_class.slabs.back();
+        size_class.slabs.pop_back();
+        allocated_blocks_ -= size_class.blocks_per_slab;
+        free(slab->memory);
+        delete slab;
+    }
+
+    size_t trim_nts()
+    {
+        size_t freed = 0;
+        for (SizeClass& size_class : size_classes_)
+        {
+            for (size_t i = size_class.slabs.size(); i > 0 && size_class.empty_slabs > 0; --i)
+            {
+                Slab* slab = size_class.slabs[i - 1];
+                if (slab->free_blocks.size() == size_class.blocks_per_slab)
+                {
+                    free_slab(size_class, slab);
+                    --size_class.empty_slabs;
+                    ++freed;
+                }
+            }
+        }
+        return freed;
+    }
+
+    std::array<SizeClass, num_size_classes> size_classes_;
+    std::vector<Slab*> huge_slabs_;     //< Individually allocated payloads, all of them in use
+
+    size_t allocated_blocks_ = 0;       //< Payloads allocated, including the ones in use
+    size_t blocks_in_use_ = 0;          //< Payloads in use
+
+    uint32_t infinite_histories_count_ = 0;  //< Number of infinite histories reserved
+    uint32_t finite_max_pool_size_ = 0;      //< Maximum size of the pool if no infinite histories were reserved
+
+    mutable std::mutex mutex_;
+};
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif  // RTPS_HISTORY_TOPICPAYLOADPOOLIMPL_SIZE_CLASS_HPP
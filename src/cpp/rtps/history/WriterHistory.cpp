@@ -23,6 +23,7 @@
 #include <fastdds/rtps/common/WriteParams.h>
 #include <fastdds/core/policy//ParameterSerializer.hpp>
 
+#include <algorithm>
 #include <mutex>
 
 namespace eprosima {
@@ -254,14 +255,16 @@ CacheChange_t* WriterHistory::remove_change_and_reuse(
         return nullptr;
     }
 
-    // Create a temporary reference change associated to the sequence number
-    CacheChange_t ch;
-    ch.sequenceNumber = sequence_number;
-    ch.writerGUID = mp_writer->getGuid();
+    std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
 
-    auto it = find_change(&ch);
+    // Changes are kept ordered by sequence number, so a binary search can be used
+    auto it = std::lower_bound(changesBegin(), changesEnd(), sequence_number,
+                    [](const CacheChange_t* change, const SequenceNumber_t& seq)
+                    {
+                        return change->sequenceNumber < seq;
+                    });
 
-    if ( it == changesEnd())
+    if (it == changesEnd() || (*it)->sequenceNumber != sequence_number)
     {
         EPROSIMA_LOG_ERROR(RTPS_WRITER_HISTORY, "Sequence number provided doesn't match any change in history");
         return nullptr;
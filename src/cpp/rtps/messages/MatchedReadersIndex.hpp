@@ -0,0 +1,175 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MatchedReadersIndex.hpp
+ */
+
+#ifndef RTPS_MESSAGES_MATCHEDREADERSINDEX_HPP
+#define RTPS_MESSAGES_MATCHEDREADERSINDEX_HPP
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <fastdds/rtps/common/Guid.h>
+
+#include <utils/hash.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class RTPSReader;
+
+/**
+ * Index of the local user readers matched with each remote writer, maintained at match time.
+ *
+ * Used by the MessageReceiver to route submessages not directed to a specific reader without iterating all the
+ * readers of the participant. Lists are never modified in place, so a list returned by @ref find can be iterated
+ * without holding the index lock.
+ * @ingroup READER_MODULE
+ */
+class MatchedReadersIndex
+{
+public:
+
+    //! Entry of the index. The entity id allows checking the association with a receiver without using the pointer.
+    struct Entry
+    {
+        EntityId_t entity_id;
+        RTPSReader* reader;
+    };
+
+    using ReaderList = std::vector<Entry>;
+
+    /**
+     * Register a match between a local reader and a remote writer.
+     * @param writer_guid GUID of the remote writer.
+     * @param reader_id Entity id of the local reader.
+     * @param reader Local reader.
+     */
+    void add(
+            const GUID_t& writer_guid,
+            const EntityId_t& reader_id,
+            RTPSReader* reader)
+    {
+        std::lock_guard<std::mutex> guard(mtx_);
+        std::shared_ptr<const ReaderList>& readers = readers_by_writer_[writer_guid];
+        std::shared_ptr<ReaderList> new_readers = readers ?
+                std::make_shared<ReaderList>(*readers) : std::make_shared<ReaderList>();
+        auto it = std::find_if(new_readers->begin(), new_readers->end(), [reader](const Entry& entry)
+                        {
+                            return entry.reader == reader;
+                        });
+        if (it == new_readers->end())
+        {
+            new_readers->push_back({reader_id, reader});
+            readers = new_readers;
+        }
+    }
+
+    /**
+     * Unregister a match between a local reader and a remote writer.
+     * @param writer_guid GUID of the remote writer.
+     * @param reader Local reader.
+     */
+    void remove(
+            const GUID_t& writer_guid,
+            const RTPSReader* reader)
+    {
+        std::lock_guard<std::mutex> guard(mtx_);
+        auto it = readers_by_writer_.find(writer_guid);
+        if (it != readers_by_writer_.end())
+        {
+            remove_nts(it, reader);
+        }
+    }
+
+    /**
+     * Unregister all the matches of a local reader.
+     * @param reader Local reader being deleted.
+     */
+    void remove_reader(
+            const RTPSReader* reader)
+    {
+        std::lock_guard<std::mutex> guard(mtx_);
+        for (auto it = readers_by_writer_.begin(); it != readers_by_writer_.end();)
+        {
+            it = remove_nts(it, reader);
+        }
+    }
+
+    /**
+     * Get the local readers matched with a remote writer.
+     * @param writer_guid GUID of the remote writer.
+     * @return Snapshot of the list of matched readers, or nullptr when there are none.
+     */
+    std::shared_ptr<const ReaderList> find(
+            const GUID_t& writer_guid) const
+    {
+        std::lock_guard<std::mutex> guard(mtx_);
+        auto it = readers_by_writer_.find(writer_guid);
+        return it != readers_by_writer_.end() ? it->second : nullptr;
+    }
+
+private:
+
+    using ReadersByWriter = std::unordered_map<GUID_t, std::shared_ptr<const ReaderList>, GuidHash>;
+
+    //! Removes a reader from an entry, returning the iterator to the next entry.
+    ReadersByWriter::iterator remove_nts(
+            ReadersByWriter::iterator it,
+            const RTPSReader* reader)
+    {
+        const ReaderList& readers = *it->second;
+        auto found = std::find_if(readers.begin(), readers.end(), [reader](const Entry& entry)
+                        {
+                            return entry.reader == reader;
+                        });
+        if (found == readers.end())
+        {
+            return std::next(it);
+        }
+
+        if (1 == readers.size())
+        {
+            return readers_by_writer_.erase(it);
+        }
+
+        std::shared_ptr<ReaderList> new_readers = std::make_shared<ReaderList>();
+        new_readers->reserve(readers.size() - 1);
+        std::copy_if(readers.begin(), readers.end(), std::back_inserter(*new_readers), [reader](const Entry& entry)
+                {
+                    return entry.reader != reader;
+                });
+        it->second = new_readers;
+        return std::next(it);
+    }
+
+    mutable std::mutex mtx_;
+    ReadersByWriter readers_by_writer_;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#endif // RTPS_MESSAGES_MATCHEDREADERSINDEX_HPP
@@ -17,6 +17,7 @@
  *
  */
 
+#include <algorithm>
 #include <cassert>
 #include <limits>
 #include <thread>
@@ -31,6 +32,8 @@
 #include <fastdds/rtps/writer/RTPSWriter.h>
 #include <fastrtps/utils/shared_mutex.hpp>
 
+#include <rtps/messages/MatchedReadersIndex.hpp>
+#include <rtps/messages/ReceiveDispatcher.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <statistics/rtps/StatisticsBase.hpp>
 #include <statistics/rtps/messages/RTPSStatisticsMessages.hpp>
@@ -45,16 +48,61 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+/**
+ * Copy a received change so its buffers outlive the reception of the message, to be processed on the
+ * receive dispatcher.
+ */
+static std::shared_ptr<CacheChange_t> copy_received_change(
+        const CacheChange_t& received)
+{
+    std::shared_ptr<CacheChange_t> copy = std::make_shared<CacheChange_t>();
+    copy->serializedPayload.copy(&received.serializedPayload, false);
+    copy->inline_qos.copy(&received.inline_qos, false);
+    // Should be called after copying the payload, as the fragment count depends on its length
+    copy->copy_not_memcpy(&received);
+    return copy;
+}
+
+/**
+ * Call a functor with a change pointing to the buffers of a copied change. Each reader gets its own change, as the
+ * payload pools take ownership of the change they are given.
+ */
+template<typename Functor>
+static void process_copied_change(
+        const CacheChange_t& copy,
+        const Functor& process)
+{
+    CacheChange_t change;
+    change.serializedPayload.data = copy.serializedPayload.data;
+    change.serializedPayload.length = copy.serializedPayload.length;
+    change.serializedPayload.max_size = copy.serializedPayload.length;
+    if (0 < copy.inline_qos.length)
+    {
+        change.inline_qos.data = copy.inline_qos.data;
+        change.inline_qos.length = copy.inline_qos.length;
+        change.inline_qos.max_size = copy.inline_qos.length;
+        change.inline_qos.encapsulation = copy.inline_qos.encapsulation;
+        change.inline_qos.pos = 0;
+    }
+    change.copy_not_memcpy(&copy);
+
+    process(change);
+
+    IPayloadPool* payload_pool = change.payload_owner();
+    if (payload_pool)
+    {
+        payload_pool->release_payload(change);
+    }
+
+    change.serializedPayload.data = nullptr;
+    change.inline_qos.data = nullptr;
+}
+
 MessageReceiver::MessageReceiver(
         RTPSParticipantImpl* participant,
         uint32_t rec_buffer_size)
     : participant_(participant)
-    , source_version_(c_ProtocolVersion)
-    , source_vendor_id_(c_VendorId_Unknown)
-    , source_guid_prefix_(c_GuidPrefix_Unknown)
-    , dest_guid_prefix_(c_GuidPrefix_Unknown)
-    , have_timestamp_(false)
-    , timestamp_(c_TimeInvalid)
+    , dispatcher_(nullptr)
 #if HAVE_SECURITY
     , crypto_msg_(participant->is_secure() ? rec_buffer_size : 0)
     , crypto_submsg_(participant->is_secure() ? rec_buffer_size : 0)
@@ -107,6 +155,30 @@ MessageReceiver::MessageReceiver(
 }
 
 #endif // if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
+
+#if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
+    // The participant only creates the dispatcher when security is not active
+    dispatcher_ = participant->receive_dispatcher();
+    if (nullptr != dispatcher_)
+    {
+        process_data_message_function_ = std::bind(
+            &MessageReceiver::process_data_message_with_dispatcher,
+            this,
+            std::placeholders::_1,
+            std::placeholders::_2,
+            std::placeholders::_3);
+
+        process_data_fragment_message_function_ = std::bind(
+            &MessageReceiver::process_data_fragment_message_with_dispatcher,
+            this,
+            std::placeholders::_1,
+            std::placeholders::_2,
+            std::placeholders::_3,
+            std::placeholders::_4,
+            std::placeholders::_5,
+            std::placeholders::_6);
+    }
+#endif // if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 }
 
 MessageReceiver::~MessageReceiver()
@@ -162,7 +234,7 @@ void MessageReceiver::process_data_message_with_security(
                 std::swap(change.serializedPayload.length, crypto_payload_.length);
             };
 
-    findAllReaders(reader_id, process_message);
+    findAllReaders(reader_id, change.writerGUID, process_message);
 }
 
 void MessageReceiver::process_data_fragment_message_with_security(
@@ -205,7 +277,7 @@ void MessageReceiver::process_data_fragment_message_with_security(
                 std::swap(change.serializedPayload.length, crypto_payload_.length);
             };
 
-    findAllReaders(reader_id, process_message);
+    findAllReaders(reader_id, change.writerGUID, process_message);
 }
 
 #endif // if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
@@ -220,7 +292,7 @@ void MessageReceiver::process_data_message_without_security(
                 reader->processDataMsg(&change);
             };
 
-    findAllReaders(reader_id, process_message);
+    findAllReaders(reader_id, change.writerGUID, process_message);
 }
 
 void MessageReceiver::process_data_fragment_message_without_security(
@@ -236,7 +308,87 @@ void MessageReceiver::process_data_fragment_message_without_security(
                 reader->processDataFragMsg(&change, sample_size, fragment_starting_num, fragments_in_submessage);
             };
 
-    findAllReaders(reader_id, process_message);
+    findAllReaders(reader_id, change.writerGUID, process_message);
+}
+
+void MessageReceiver::process_data_message_with_dispatcher(
+        const EntityId_t& reader_id,
+        CacheChange_t& change,
+        bool /*was_decoded*/)
+{
+    // Copied only once, and shared by all the dispatched readers
+    std::shared_ptr<CacheChange_t> copy;
+
+    auto process_message = [&change, &copy, this](RTPSReader* reader)
+            {
+                if (!is_dispatched(reader))
+                {
+                    reader->processDataMsg(&change);
+                    return;
+                }
+
+                if (!copy)
+                {
+                    copy = copy_received_change(change);
+                }
+
+                dispatcher_->push(reader, [reader, copy]()
+                        {
+                            process_copied_change(*copy, [reader](CacheChange_t& reader_change)
+                            {
+                                reader->processDataMsg(&reader_change);
+                            });
+                        });
+            };
+
+    findAllReaders(reader_id, change.writerGUID, process_message);
+}
+
+void MessageReceiver::process_data_fragment_message_with_dispatcher(
+        const EntityId_t& reader_id,
+        CacheChange_t& change,
+        uint32_t sample_size,
+        uint32_t fragment_starting_num,
+        uint16_t fragments_in_submessage,
+        bool /*was_decoded*/)
+{
+    // Copied only once, and shared by all the dispatched readers
+    std::shared_ptr<CacheChange_t> copy;
+
+    auto process_message =
+            [&change, &copy, sample_size, fragment_starting_num, fragments_in_submessage, this](RTPSReader* reader)
+            {
+                if (!is_dispatched(reader))
+                {
+                    reader->processDataFragMsg(&change, sample_size, fragment_starting_num, fragments_in_submessage);
+                    return;
+                }
+
+                if (!copy)
+                {
+                    copy = copy_received_change(change);
+                }
+
+                dispatcher_->push(reader,
+                        [reader, copy, sample_size, fragment_starting_num, fragments_in_submessage]()
+                        {
+                            process_copied_change(*copy,
+                            [reader, sample_size, fragment_starting_num,
+                            fragments_in_submessage](CacheChange_t& reader_change)
+                            {
+                                reader->processDataFragMsg(&reader_change, sample_size, fragment_starting_num,
+                                fragments_in_submessage);
+                            });
+                        });
+            };
+
+    findAllReaders(reader_id, change.writerGUID, process_message);
+}
+
+bool MessageReceiver::is_dispatched(
+        const RTPSReader* reader) const
+{
+    return nullptr != dispatcher_ && !reader->getGuid().is_builtin();
 }
 
 void MessageReceiver::associateEndpoint(
@@ -281,57 +433,71 @@ void MessageReceiver::associateEndpoint(
 
             readers->second.push_back(reader);
         }
+
+        if (reader->getGuid().is_builtin())
+        {
+            associated_builtin_readers_.push_back(reader);
+        }
     }
 }
 
 void MessageReceiver::removeEndpoint(
         Endpoint* to_remove)
 {
-    std::lock_guard<eprosima::shared_mutex> guard(mtx_);
+    RTPSReader* dispatched_reader = nullptr;
 
-    if (to_remove->getAttributes().endpointKind == WRITER)
     {
-        auto* var = dynamic_cast<RTPSWriter*>(to_remove);
-        for (auto it = associated_writers_.begin(); it != associated_writers_.end(); ++it)
+        std::lock_guard<eprosima::shared_mutex> guard(mtx_);
+
+        if (to_remove->getAttributes().endpointKind == WRITER)
         {
-            if (*it == var)
+            auto* var = dynamic_cast<RTPSWriter*>(to_remove);
+            for (auto it = associated_writers_.begin(); it != associated_writers_.end(); ++it)
             {
-                associated_writers_.erase(it);
-                break;
+                if (*it == var)
+                {
+                    associated_writers_.erase(it);
+                    break;
+                }
             }
         }
-    }
-    else
-    {
-        auto readers = associated_readers_.find(to_remove->getGuid().entityId);
-        if (readers != associated_readers_.end())
+        else
         {
-            auto* var = dynamic_cast<RTPSReader*>(to_remove);
-            for (auto it = readers->second.begin(); it != readers->second.end(); ++it)
+            auto readers = associated_readers_.find(to_remove->getGuid().entityId);
+            if (readers != associated_readers_.end())
             {
-                if (*it == var)
+                auto* var = dynamic_cast<RTPSReader*>(to_remove);
+                if (is_dispatched(var))
+                {
+                    dispatched_reader = var;
+                }
+                for (auto it = readers->second.begin(); it != readers->second.end(); ++it)
                 {
-                    readers->second.erase(it);
-                    if (readers->second.empty())
+                    if (*it == var)
                     {
-                        std::cout << "Associated reader erased?" << std::endl;
-                        associated_readers_.erase(readers);
+                        associated_builtin_readers_.erase(
+                            std::remove(associated_builtin_readers_.begin(), associated_builtin_readers_.end(), var),
+                            associated_builtin_readers_.end());
+                        readers->second.erase(it);
+                        if (readers->second.empty())
+                        {
+                            std::cout << "Associated reader erased?" << std::endl;
+                            associated_readers_.erase(readers);
+                        }
+                        break;
                     }
-                    break;
                 }
             }
         }
     }
-}
 
-void MessageReceiver::reset()
-{
-    source_version_ = c_ProtocolVersion;
-    source_vendor_id_ = c_VendorId_Unknown;
-    source_guid_prefix_ = c_GuidPrefix_Unknown;
-    dest_guid_prefix_ = c_GuidPrefix_Unknown;
-    have_timestamp_ = false;
-    timestamp_ = c_TimeInvalid;
+    // Drop the submessages still pending for the reader. This is done without holding mtx_, as the task running on
+    // the reader may need it (e.g. a listener creating or deleting endpoints). No new tasks can be pushed for the
+    // reader, as it is no longer associated.
+    if (nullptr != dispatched_reader)
+    {
+        dispatcher_->remove_reader(dispatched_reader);
+    }
 }
 
 void MessageReceiver::processCDRMsg(
@@ -359,48 +525,53 @@ void MessageReceiver::processCDRMsg(
 
     bool ignore_submessages = false;
 
-    {
-        std::lock_guard<eprosima::shared_mutex> guard(mtx_);
+    // Kept on the stack, so this method can be called from several threads at the same time
+    ReceptionState state;
 
-        reset();
+#if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
+    std::unique_lock<std::mutex> crypto_lock(crypto_mtx_, std::defer_lock);
+    if (participant_->is_secure())
+    {
+        crypto_lock.lock();
+    }
+#endif // if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 
-        dest_guid_prefix_ = participantGuidPrefix;
+    state.dest_guid_prefix = participantGuidPrefix;
 
-        msg->pos = 0; //Start reading at 0
+    msg->pos = 0; //Start reading at 0
 
-        //Once everything is set, the reading begins:
-        if (!checkRTPSHeader(msg))
-        {
-            return;
-        }
+    //Once everything is set, the reading begins:
+    if (!checkRTPSHeader(msg, state))
+    {
+        return;
+    }
 
 #if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
-        ignore_submessages = participant_->is_participant_ignored(source_guid_prefix_);
+    ignore_submessages = participant_->is_participant_ignored(state.source_guid_prefix);
 #endif  // if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 
-        if (!ignore_submessages)
-        {
-            notify_network_statistics(source_locator, reception_locator, msg);
-        }
+    if (!ignore_submessages)
+    {
+        notify_network_statistics(source_locator, reception_locator, msg, state);
+    }
 
 #if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
-        decode_ret = security.decode_rtps_message(*msg, *auxiliary_buffer, source_guid_prefix_);
+    decode_ret = security.decode_rtps_message(*msg, *auxiliary_buffer, state.source_guid_prefix);
 
-        if (decode_ret < 0)
-        {
-            return;
-        }
+    if (decode_ret < 0)
+    {
+        return;
+    }
 
-        if (decode_ret == 0)
-        {
-            // The original CDRMessage buffer (msg) now points to the proprietary temporary buffer crypto_msg_.
-            // The auxiliary buffer now points to the propietary temporary buffer crypto_submsg_.
-            // This way each decoded sub-message will be processed using the crypto_submsg_ buffer.
-            msg = auxiliary_buffer;
-            auxiliary_buffer = &crypto_submsg_;
-        }
-#endif // if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
+    if (decode_ret == 0)
+    {
+        // The original CDRMessage buffer (msg) now points to the proprietary temporary buffer crypto_msg_.
+        // The auxiliary buffer now points to the propietary temporary buffer crypto_submsg_.
+        // This way each decoded sub-message will be processed using the crypto_submsg_ buffer.
+        msg = auxiliary_buffer;
+        auxiliary_buffer = &crypto_submsg_;
     }
+#endif // if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 
     // Loop until there are no more submessages
     // Each submessage processing method choses the lock kind required
@@ -414,7 +585,7 @@ void MessageReceiver::processCDRMsg(
         bool current_message_was_decoded = false;
 
 #if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
-        decode_ret = security.decode_rtps_submessage(*msg, *auxiliary_buffer, source_guid_prefix_);
+        decode_ret = security.decode_rtps_submessage(*msg, *auxiliary_buffer, state.source_guid_prefix);
 
         if (decode_ret < 0)
         {
@@ -448,7 +619,7 @@ void MessageReceiver::processCDRMsg(
             {
                 case DATA:
                 {
-                    if (dest_guid_prefix_ != participantGuidPrefix)
+                    if (state.dest_guid_prefix != participantGuidPrefix)
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Data Submsg ignored, DST is another RTPSParticipant");
                     }
@@ -456,11 +627,11 @@ void MessageReceiver::processCDRMsg(
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Data Submsg received, processing.");
                         EntityId_t writerId = c_EntityId_Unknown;
-                        valid = proc_Submsg_Data(submessage, &submsgh, writerId, current_message_was_decoded);
+                        valid = proc_Submsg_Data(submessage, &submsgh, writerId, current_message_was_decoded, state);
 #if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
                         if (valid && writerId == c_EntityId_SPDPWriter)
                         {
-                            ignore_submessages = participant_->is_participant_ignored(source_guid_prefix_);
+                            ignore_submessages = participant_->is_participant_ignored(state.source_guid_prefix);
                         }
 #endif  // if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 
@@ -468,7 +639,7 @@ void MessageReceiver::processCDRMsg(
                     break;
                 }
                 case DATA_FRAG:
-                    if (dest_guid_prefix_ != participantGuidPrefix)
+                    if (state.dest_guid_prefix != participantGuidPrefix)
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN,
                                 IDSTRING "DataFrag Submsg ignored, DST is another RTPSParticipant");
@@ -476,12 +647,12 @@ void MessageReceiver::processCDRMsg(
                     else
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "DataFrag Submsg received, processing.");
-                        valid = proc_Submsg_DataFrag(submessage, &submsgh, current_message_was_decoded);
+                        valid = proc_Submsg_DataFrag(submessage, &submsgh, current_message_was_decoded, state);
                     }
                     break;
                 case GAP:
                 {
-                    if (dest_guid_prefix_ != participantGuidPrefix)
+                    if (state.dest_guid_prefix != participantGuidPrefix)
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN,
                                 IDSTRING "Gap Submsg ignored, DST is another RTPSParticipant...");
@@ -489,13 +660,13 @@ void MessageReceiver::processCDRMsg(
                     else
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Gap Submsg received, processing...");
-                        valid = proc_Submsg_Gap(submessage, &submsgh, current_message_was_decoded);
+                        valid = proc_Submsg_Gap(submessage, &submsgh, current_message_was_decoded, state);
                     }
                     break;
                 }
                 case ACKNACK:
                 {
-                    if (dest_guid_prefix_ != participantGuidPrefix)
+                    if (state.dest_guid_prefix != participantGuidPrefix)
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN,
                                 IDSTRING "Acknack Submsg ignored, DST is another RTPSParticipant...");
@@ -503,13 +674,13 @@ void MessageReceiver::processCDRMsg(
                     else
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Acknack Submsg received, processing...");
-                        valid = proc_Submsg_Acknack(submessage, &submsgh, current_message_was_decoded);
+                        valid = proc_Submsg_Acknack(submessage, &submsgh, current_message_was_decoded, state);
                     }
                     break;
                 }
                 case NACK_FRAG:
                 {
-                    if (dest_guid_prefix_ != participantGuidPrefix)
+                    if (state.dest_guid_prefix != participantGuidPrefix)
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN,
                                 IDSTRING "NackFrag Submsg ignored, DST is another RTPSParticipant...");
@@ -517,26 +688,26 @@ void MessageReceiver::processCDRMsg(
                     else
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "NackFrag Submsg received, processing...");
-                        valid = proc_Submsg_NackFrag(submessage, &submsgh, current_message_was_decoded);
+                        valid = proc_Submsg_NackFrag(submessage, &submsgh, current_message_was_decoded, state);
                     }
                     break;
                 }
                 case HEARTBEAT:
                 {
-                    if (dest_guid_prefix_ != participantGuidPrefix)
+                    if (state.dest_guid_prefix != participantGuidPrefix)
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "HB Submsg ignored, DST is another RTPSParticipant...");
                     }
                     else
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Heartbeat Submsg received, processing...");
-                        valid = proc_Submsg_Heartbeat(submessage, &submsgh, current_message_was_decoded);
+                        valid = proc_Submsg_Heartbeat(submessage, &submsgh, current_message_was_decoded, state);
                     }
                     break;
                 }
                 case HEARTBEAT_FRAG:
                 {
-                    if (dest_guid_prefix_ != participantGuidPrefix)
+                    if (state.dest_guid_prefix != participantGuidPrefix)
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN,
                                 IDSTRING "HBFrag Submsg ignored, DST is another RTPSParticipant...");
@@ -544,7 +715,7 @@ void MessageReceiver::processCDRMsg(
                     else
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "HeartbeatFrag Submsg received, processing...");
-                        valid = proc_Submsg_HeartbeatFrag(submessage, &submsgh, current_message_was_decoded);
+                        valid = proc_Submsg_HeartbeatFrag(submessage, &submsgh, current_message_was_decoded, state);
                     }
                     break;
                 }
@@ -553,19 +724,19 @@ void MessageReceiver::processCDRMsg(
                     break;
                 case INFO_DST:
                     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "InfoDST message received, processing...");
-                    valid = proc_Submsg_InfoDST(submessage, &submsgh);
+                    valid = proc_Submsg_InfoDST(submessage, &submsgh, state);
                     break;
                 case INFO_SRC:
                     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "InfoSRC message received, processing...");
-                    valid = proc_Submsg_InfoSRC(submessage, &submsgh);
+                    valid = proc_Submsg_InfoSRC(submessage, &submsgh, state);
 #if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
-                    ignore_submessages = participant_->is_participant_ignored(source_guid_prefix_);
+                    ignore_submessages = participant_->is_participant_ignored(state.source_guid_prefix);
 #endif  // if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
                     break;
                 case INFO_TS:
                 {
                     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "InfoTS Submsg received, processing...");
-                    valid = proc_Submsg_InfoTS(submessage, &submsgh);
+                    valid = proc_Submsg_InfoTS(submessage, &submsgh, state);
                     break;
                 }
                 case INFO_REPLY:
@@ -585,12 +756,13 @@ void MessageReceiver::processCDRMsg(
     }
 
 #if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
-    participant_->assert_remote_participant_liveliness(source_guid_prefix_);
+    participant_->assert_remote_participant_liveliness(state.source_guid_prefix);
 #endif // if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 }
 
 bool MessageReceiver::checkRTPSHeader(
-        CDRMessage_t* msg)
+        CDRMessage_t* msg,
+        ReceptionState& state)
 {
     //check and proccess the RTPS Header
     if (msg->buffer[0] != 'R' ||  msg->buffer[1] != 'T' ||
@@ -605,9 +777,9 @@ bool MessageReceiver::checkRTPSHeader(
     //CHECK AND SET protocol version
     if (msg->buffer[msg->pos] == c_ProtocolVersion.m_major)
     {
-        source_version_.m_major = msg->buffer[msg->pos];
+        state.source_version.m_major = msg->buffer[msg->pos];
         msg->pos++;
-        source_version_.m_minor = msg->buffer[msg->pos];
+        state.source_version.m_minor = msg->buffer[msg->pos];
         msg->pos++;
     }
     else
@@ -617,13 +789,13 @@ bool MessageReceiver::checkRTPSHeader(
     }
 
     //Set source vendor id
-    source_vendor_id_[0] = msg->buffer[msg->pos];
+    state.source_vendor_id[0] = msg->buffer[msg->pos];
     msg->pos++;
-    source_vendor_id_[1] = msg->buffer[msg->pos];
+    state.source_vendor_id[1] = msg->buffer[msg->pos];
     msg->pos++;
     //set source guid prefix
-    CDRMessage::readData(msg, source_guid_prefix_.value, GuidPrefix_t::size);
-    have_timestamp_ = false;
+    CDRMessage::readData(msg, state.source_guid_prefix.value, GuidPrefix_t::size);
+    state.have_timestamp = false;
     return true;
 }
 
@@ -710,6 +882,7 @@ bool MessageReceiver::willAReaderAcceptMsgDirectedTo(
 template<typename Functor>
 void MessageReceiver::findAllReaders(
         const EntityId_t& readerID,
+        const GUID_t& writerGUID,
         const Functor& callback) const
 {
     if (readerID != c_EntityId_Unknown)
@@ -727,24 +900,44 @@ void MessageReceiver::findAllReaders(
     }
     else
     {
-        for (const auto& readers : associated_readers_)
+        for (const auto& it : associated_builtin_readers_)
         {
-            for (const auto& it : readers.second)
+            if (it->m_acceptMessagesToUnknownReaders)
             {
-                if (it->m_acceptMessagesToUnknownReaders)
+                callback(it);
+            }
+        }
+
+        // User readers only accept messages from matched writers
+        auto matched_readers = participant_->matched_readers_index().find(writerGUID);
+        if (matched_readers)
+        {
+            for (const auto& entry : *matched_readers)
+            {
+                if (isAssociated(entry.entity_id, entry.reader) && entry.reader->m_acceptMessagesToUnknownReaders)
                 {
-                    callback(it);
+                    callback(entry.reader);
                 }
             }
         }
     }
 }
 
+bool MessageReceiver::isAssociated(
+        const EntityId_t& readerID,
+        const RTPSReader* reader) const
+{
+    const auto readers = associated_readers_.find(readerID);
+    return readers != associated_readers_.end() &&
+           std::find(readers->second.begin(), readers->second.end(), reader) != readers->second.end();
+}
+
 bool MessageReceiver::proc_Submsg_Data(
         CDRMessage_t* msg,
         SubmessageHeader_t* smh,
         EntityId_t& writerID,
-        bool was_decoded) const
+        bool was_decoded,
+        const ReceptionState& state) const
 {
     eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
 
@@ -797,7 +990,7 @@ bool MessageReceiver::proc_Submsg_Data(
     //We ask the reader for a cachechange to store the information.
     CacheChange_t ch;
     ch.kind = ALIVE;
-    ch.writerGUID.guidPrefix = source_guid_prefix_;
+    ch.writerGUID.guidPrefix = state.source_guid_prefix;
     valid &= CDRMessage::readEntityId(msg, &ch.writerGUID.entityId);
 
     writerID = ch.writerGUID.entityId;
@@ -905,9 +1098,9 @@ bool MessageReceiver::proc_Submsg_Data(
     }
 
     // Set sourcetimestamp
-    if (have_timestamp_)
+    if (state.have_timestamp)
     {
-        ch.sourceTimestamp = timestamp_;
+        ch.sourceTimestamp = state.timestamp;
     }
 
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "from Writer " << ch.writerGUID << "; possible RTPSReader entities: " <<
@@ -933,7 +1126,8 @@ bool MessageReceiver::proc_Submsg_Data(
 bool MessageReceiver::proc_Submsg_DataFrag(
         CDRMessage_t* msg,
         SubmessageHeader_t* smh,
-        bool was_decoded) const
+        bool was_decoded,
+        const ReceptionState& state) const
 {
     eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
 
@@ -980,7 +1174,7 @@ bool MessageReceiver::proc_Submsg_DataFrag(
     //FOUND THE READER.
     //We ask the reader for a cachechange to store the information.
     CacheChange_t ch;
-    ch.writerGUID.guidPrefix = source_guid_prefix_;
+    ch.writerGUID.guidPrefix = state.source_guid_prefix;
     valid &= CDRMessage::readEntityId(msg, &ch.writerGUID.entityId);
 
     //Get sequence number
@@ -1092,9 +1286,9 @@ bool MessageReceiver::proc_Submsg_DataFrag(
     }
 
     // Set sourcetimestamp
-    if (have_timestamp_)
+    if (state.have_timestamp)
     {
-        ch.sourceTimestamp = timestamp_;
+        ch.sourceTimestamp = state.timestamp;
     }
 
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "from Writer " << ch.writerGUID << "; possible RTPSReader entities: " <<
@@ -1112,7 +1306,8 @@ bool MessageReceiver::proc_Submsg_DataFrag(
 bool MessageReceiver::proc_Submsg_Heartbeat(
         CDRMessage_t* msg,
         SubmessageHeader_t* smh,
-        bool was_decoded) const
+        bool was_decoded,
+        const ReceptionState& state) const
 {
     eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
 
@@ -1131,9 +1326,9 @@ bool MessageReceiver::proc_Submsg_Heartbeat(
 
     GUID_t readerGUID;
     GUID_t writerGUID;
-    readerGUID.guidPrefix = dest_guid_prefix_;
+    readerGUID.guidPrefix = state.dest_guid_prefix;
     CDRMessage::readEntityId(msg, &readerGUID.entityId);
-    writerGUID.guidPrefix = source_guid_prefix_;
+    writerGUID.guidPrefix = state.source_guid_prefix;
     CDRMessage::readEntityId(msg, &writerGUID.entityId);
     SequenceNumber_t firstSN;
     SequenceNumber_t lastSN;
@@ -1160,8 +1355,9 @@ bool MessageReceiver::proc_Submsg_Heartbeat(
     }
 
     //Look for the correct reader and writers:
-    findAllReaders(readerGUID.entityId,
-            [was_decoded, &writerGUID, &HBCount, &firstSN, &lastSN, finalFlag, livelinessFlag, this](RTPSReader* reader)
+    findAllReaders(readerGUID.entityId, writerGUID,
+            [was_decoded, &writerGUID, &HBCount, &firstSN, &lastSN, finalFlag, livelinessFlag, &state, this](
+                RTPSReader* reader)
             {
                 // Only used when HAVE_SECURITY is defined
                 static_cast<void>(was_decoded);
@@ -1169,8 +1365,25 @@ bool MessageReceiver::proc_Submsg_Heartbeat(
                 if (was_decoded || !reader->getAttributes().security_attributes().is_submessage_protected)
 #endif  // HAVE_SECURITY
                 {
+                    if (is_dispatched(reader))
+                    {
+                        // Keep the heartbeat ordered with the data already dispatched to the reader
+                        GUID_t writer_guid = writerGUID;
+                        uint32_t count = HBCount;
+                        SequenceNumber_t first_sn = firstSN;
+                        SequenceNumber_t last_sn = lastSN;
+                        fastdds::rtps::VendorId_t vendor_id = state.source_vendor_id;
+                        dispatcher_->push(reader,
+                        [reader, writer_guid, count, first_sn, last_sn, finalFlag, livelinessFlag, vendor_id]()
+                        {
+                            reader->processHeartbeatMsg(writer_guid, count, first_sn, last_sn, finalFlag,
+                            livelinessFlag, vendor_id);
+                        });
+                        return;
+                    }
+
                     reader->processHeartbeatMsg(writerGUID, HBCount, firstSN, lastSN, finalFlag, livelinessFlag,
-                    source_vendor_id_);
+                    state.source_vendor_id);
                 }
             });
 
@@ -1180,7 +1393,8 @@ bool MessageReceiver::proc_Submsg_Heartbeat(
 bool MessageReceiver::proc_Submsg_Acknack(
         CDRMessage_t* msg,
         SubmessageHeader_t* smh,
-        bool was_decoded) const
+        bool was_decoded,
+        const ReceptionState& state) const
 {
     // Only used when HAVE_SECURITY is defined
     static_cast<void>(was_decoded);
@@ -1200,9 +1414,9 @@ bool MessageReceiver::proc_Submsg_Acknack(
     }
     GUID_t readerGUID;
     GUID_t writerGUID;
-    readerGUID.guidPrefix = source_guid_prefix_;
+    readerGUID.guidPrefix = state.source_guid_prefix;
     CDRMessage::readEntityId(msg, &readerGUID.entityId);
-    writerGUID.guidPrefix = dest_guid_prefix_;
+    writerGUID.guidPrefix = state.dest_guid_prefix;
     CDRMessage::readEntityId(msg, &writerGUID.entityId);
 
     SequenceNumberSet_t SNSet = CDRMessage::readSequenceNumberSet(msg);
@@ -1221,7 +1435,7 @@ bool MessageReceiver::proc_Submsg_Acknack(
 #endif  // HAVE_SECURITY
         {
             bool result;
-            if (it->process_acknack(writerGUID, readerGUID, Ackcount, SNSet, finalFlag, result, source_vendor_id_))
+            if (it->process_acknack(writerGUID, readerGUID, Ackcount, SNSet, finalFlag, result, state.source_vendor_id))
             {
                 if (!result)
                 {
@@ -1239,7 +1453,8 @@ bool MessageReceiver::proc_Submsg_Acknack(
 bool MessageReceiver::proc_Submsg_Gap(
         CDRMessage_t* msg,
         SubmessageHeader_t* smh,
-        bool was_decoded) const
+        bool was_decoded,
+        const ReceptionState& state) const
 {
     eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
 
@@ -1256,9 +1471,9 @@ bool MessageReceiver::proc_Submsg_Gap(
 
     GUID_t writerGUID;
     GUID_t readerGUID;
-    readerGUID.guidPrefix = dest_guid_prefix_;
+    readerGUID.guidPrefix = state.dest_guid_prefix;
     CDRMessage::readEntityId(msg, &readerGUID.entityId);
-    writerGUID.guidPrefix = source_guid_prefix_;
+    writerGUID.guidPrefix = state.source_guid_prefix;
     CDRMessage::readEntityId(msg, &writerGUID.entityId);
     SequenceNumber_t gapStart;
     CDRMessage::readSequenceNumber(msg, &gapStart);
@@ -1268,8 +1483,8 @@ bool MessageReceiver::proc_Submsg_Gap(
         return false;
     }
 
-    findAllReaders(readerGUID.entityId,
-            [was_decoded, &writerGUID, &gapStart, &gapList, this](RTPSReader* reader)
+    findAllReaders(readerGUID.entityId, writerGUID,
+            [was_decoded, &writerGUID, &gapStart, &gapList, &state, this](RTPSReader* reader)
             {
                 // Only used when HAVE_SECURITY is defined
                 static_cast<void>(was_decoded);
@@ -1277,7 +1492,21 @@ bool MessageReceiver::proc_Submsg_Gap(
                 if (was_decoded || !reader->getAttributes().security_attributes().is_submessage_protected)
 #endif  // HAVE_SECURITY
                 {
-                    reader->processGapMsg(writerGUID, gapStart, gapList, source_vendor_id_);
+                    if (is_dispatched(reader))
+                    {
+                        // Keep the gap ordered with the data already dispatched to the reader
+                        GUID_t writer_guid = writerGUID;
+                        SequenceNumber_t gap_start = gapStart;
+                        SequenceNumberSet_t gap_list = gapList;
+                        fastdds::rtps::VendorId_t vendor_id = state.source_vendor_id;
+                        dispatcher_->push(reader, [reader, writer_guid, gap_start, gap_list, vendor_id]()
+                        {
+                            reader->processGapMsg(writer_guid, gap_start, gap_list, vendor_id);
+                        });
+                        return;
+                    }
+
+                    reader->processGapMsg(writerGUID, gapStart, gapList, state.source_vendor_id);
                 }
             });
 
@@ -1286,7 +1515,8 @@ bool MessageReceiver::proc_Submsg_Gap(
 
 bool MessageReceiver::proc_Submsg_InfoTS(
         CDRMessage_t* msg,
-        SubmessageHeader_t* smh)
+        SubmessageHeader_t* smh,
+        ReceptionState& state)
 {
     std::lock_guard<eprosima::shared_mutex> guard(mtx_);
 
@@ -1303,12 +1533,12 @@ bool MessageReceiver::proc_Submsg_InfoTS(
     }
     if (!timeFlag)
     {
-        have_timestamp_ = true;
-        CDRMessage::readTimestamp(msg, &timestamp_);
+        state.have_timestamp = true;
+        CDRMessage::readTimestamp(msg, &state.timestamp);
     }
     else
     {
-        have_timestamp_ = false;
+        state.have_timestamp = false;
     }
 
     return true;
@@ -1316,7 +1546,8 @@ bool MessageReceiver::proc_Submsg_InfoTS(
 
 bool MessageReceiver::proc_Submsg_InfoDST(
         CDRMessage_t* msg,
-        SubmessageHeader_t* smh)
+        SubmessageHeader_t* smh,
+        ReceptionState& state)
 {
     std::lock_guard<eprosima::shared_mutex> guard(mtx_);
 
@@ -1335,15 +1566,16 @@ bool MessageReceiver::proc_Submsg_InfoDST(
     CDRMessage::readData(msg, guidP.value, GuidPrefix_t::size);
     if (guidP != c_GuidPrefix_Unknown)
     {
-        dest_guid_prefix_ = guidP;
-        EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "DST RTPSParticipant is now: " << dest_guid_prefix_);
+        state.dest_guid_prefix = guidP;
+        EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "DST RTPSParticipant is now: " << state.dest_guid_prefix);
     }
     return true;
 }
 
 bool MessageReceiver::proc_Submsg_InfoSRC(
         CDRMessage_t* msg,
-        SubmessageHeader_t* smh)
+        SubmessageHeader_t* smh,
+        ReceptionState& state)
 {
     std::lock_guard<eprosima::shared_mutex> guard(mtx_);
 
@@ -1362,11 +1594,11 @@ bool MessageReceiver::proc_Submsg_InfoSRC(
     {
         //AVOID FIRST 4 BYTES:
         msg->pos += 4;
-        CDRMessage::readOctet(msg, &source_version_.m_major);
-        CDRMessage::readOctet(msg, &source_version_.m_minor);
-        CDRMessage::readData(msg, &source_vendor_id_[0], 2);
-        CDRMessage::readData(msg, source_guid_prefix_.value, GuidPrefix_t::size);
-        EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "SRC RTPSParticipant is now: " << source_guid_prefix_);
+        CDRMessage::readOctet(msg, &state.source_version.m_major);
+        CDRMessage::readOctet(msg, &state.source_version.m_minor);
+        CDRMessage::readData(msg, &state.source_vendor_id[0], 2);
+        CDRMessage::readData(msg, state.source_guid_prefix.value, GuidPrefix_t::size);
+        EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "SRC RTPSParticipant is now: " << state.source_guid_prefix);
         return true;
     }
     return false;
@@ -1375,7 +1607,8 @@ bool MessageReceiver::proc_Submsg_InfoSRC(
 bool MessageReceiver::proc_Submsg_NackFrag(
         CDRMessage_t* msg,
         SubmessageHeader_t* smh,
-        bool was_decoded) const
+        bool was_decoded,
+        const ReceptionState& state) const
 {
     // Only used when HAVE_SECURITY is defined
     static_cast<void>(was_decoded);
@@ -1395,9 +1628,9 @@ bool MessageReceiver::proc_Submsg_NackFrag(
 
     GUID_t readerGUID;
     GUID_t writerGUID;
-    readerGUID.guidPrefix = source_guid_prefix_;
+    readerGUID.guidPrefix = state.source_guid_prefix;
     CDRMessage::readEntityId(msg, &readerGUID.entityId);
-    writerGUID.guidPrefix = dest_guid_prefix_;
+    writerGUID.guidPrefix = state.dest_guid_prefix;
     CDRMessage::readEntityId(msg, &writerGUID.entityId);
 
     SequenceNumber_t writerSN;
@@ -1421,7 +1654,8 @@ bool MessageReceiver::proc_Submsg_NackFrag(
 #endif  // HAVE_SECURITY
         {
             bool result;
-            if (it->process_nack_frag(writerGUID, readerGUID, Ackcount, writerSN, fnState, result, source_vendor_id_))
+            if (it->process_nack_frag(writerGUID, readerGUID, Ackcount, writerSN, fnState, result,
+                    state.source_vendor_id))
             {
                 if (!result)
                 {
@@ -1439,7 +1673,8 @@ bool MessageReceiver::proc_Submsg_NackFrag(
 bool MessageReceiver::proc_Submsg_HeartbeatFrag(
         CDRMessage_t* msg,
         SubmessageHeader_t* smh,
-        bool /*was_decoded*/) const
+        bool /*was_decoded*/,
+        const ReceptionState& state) const
 {
     eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
 
@@ -1456,9 +1691,9 @@ bool MessageReceiver::proc_Submsg_HeartbeatFrag(
 
     GUID_t readerGUID;
     GUID_t writerGUID;
-    readerGUID.guidPrefix = dest_guid_prefix_;
+    readerGUID.guidPrefix = state.dest_guid_prefix;
     CDRMessage::readEntityId(msg, &readerGUID.entityId);
-    writerGUID.guidPrefix = source_guid_prefix_;
+    writerGUID.guidPrefix = state.source_guid_prefix;
     CDRMessage::readEntityId(msg, &writerGUID.entityId);
 
     SequenceNumber_t writerSN;
@@ -1490,7 +1725,8 @@ bool MessageReceiver::proc_Submsg_HeartbeatFrag(
 void MessageReceiver::notify_network_statistics(
         const Locator_t& source_locator,
         const Locator_t& reception_locator,
-        CDRMessage_t* msg) const
+        CDRMessage_t* msg,
+        const ReceptionState& state) const
 {
     static_cast<void>(source_locator);
     static_cast<void>(reception_locator);
@@ -1500,7 +1736,7 @@ void MessageReceiver::notify_network_statistics(
     using namespace eprosima::fastdds::statistics;
     using namespace eprosima::fastdds::statistics::rtps;
 
-    if ((c_VendorId_eProsima != source_vendor_id_) ||
+    if ((c_VendorId_eProsima != state.source_vendor_id) ||
             (LOCATOR_KIND_SHM == source_locator.kind))
     {
         return;
@@ -1530,7 +1766,7 @@ void MessageReceiver::notify_network_statistics(
             read_statistics_submessage(msg, data);
 #if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
             participant_->on_network_statistics(
-                source_guid_prefix_, source_locator, reception_locator, data, msg_length);
+                state.source_guid_prefix, source_locator, reception_locator, data, msg_length);
 #endif // if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
             break;
         }
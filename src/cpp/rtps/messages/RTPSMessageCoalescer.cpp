@@ -0,0 +1,248 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RTPSMessageCoalescer.cpp
+ */
+
+#include <rtps/messages/RTPSMessageCoalescer.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include <fastdds/rtps/common/LocatorList.hpp>
+#include <fastdds/rtps/messages/CDRMessage.h>
+#include <fastdds/rtps/messages/RTPS_messages.h>
+#include <fastdds/rtps/network/SenderResource.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+RTPSMessageCoalescer::RTPSMessageCoalescer(
+        ResourceEvent& event_resource,
+        std::function<void()> on_linger_expired,
+        const std::chrono::microseconds& linger,
+        uint32_t max_datagram_size,
+        uint32_t max_message_size)
+    : max_datagram_size_(max_datagram_size)
+    , max_message_size_((std::min)(max_message_size, max_datagram_size))
+{
+    auto callback = std::move(on_linger_expired);
+    linger_timer_.reset(new TimedEvent(event_resource,
+            [callback]() -> bool
+            {
+                callback();
+                return false;
+            },
+            static_cast<double>(linger.count()) / 1000.0));
+}
+
+RTPSMessageCoalescer::~RTPSMessageCoalescer()
+{
+    linger_timer_.reset();
+}
+
+bool RTPSMessageCoalescer::analyze_message(
+        const CDRMessage_t* msg,
+        MessageInfo& info) const
+{
+    if (msg->length <= RTPSMESSAGE_HEADER_SIZE || msg->length > max_message_size_)
+    {
+        return false;
+    }
+
+    // Walk the submessage headers looking for INFO_DST submessages
+    uint32_t pos = RTPSMESSAGE_HEADER_SIZE;
+    bool first = true;
+    while (pos + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE <= msg->length)
+    {
+        octet id = msg->buffer[pos];
+        octet flags = msg->buffer[pos + 1];
+        uint16_t octets_to_next;
+        if ((flags & BIT(0)) != 0)
+        {
+            octets_to_next = static_cast<uint16_t>(msg->buffer[pos + 2] | (msg->buffer[pos + 3] << 8));
+        }
+        else
+        {
+            octets_to_next = static_cast<uint16_t>((msg->buffer[pos + 2] << 8) | msg->buffer[pos + 3]);
+        }
+
+        uint32_t body_pos = pos + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE;
+        uint32_t next_pos = (0 == octets_to_next) ? msg->length : body_pos + octets_to_next;
+        if (next_pos > msg->length)
+        {
+            // Malformed message. Let it be sent as is.
+            return false;
+        }
+
+        if (INFO_DST == id && (body_pos + GuidPrefix_t::size) <= next_pos)
+        {
+            GuidPrefix_t prefix;
+            memcpy(prefix.value, &msg->buffer[body_pos], GuidPrefix_t::size);
+            if (c_GuidPrefix_Unknown != prefix)
+            {
+                info.starts_with_destination |= first;
+                info.last_destination = prefix;
+            }
+        }
+
+        first = false;
+        pos = next_pos;
+    }
+
+    return true;
+}
+
+void RTPSMessageCoalescer::append_nts(
+        const Locator_t& locator,
+        const CDRMessage_t* msg,
+        const MessageInfo& info,
+        fastdds::rtps::SendResourceList& send_resources,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    PendingDatagram* datagram = find_datagram_nts(locator);
+    if (nullptr == datagram)
+    {
+        datagram = new PendingDatagram(locator, max_datagram_size_);
+        datagrams_[locator].reset(datagram);
+    }
+    datagram->idle_flushes = 0;
+
+    CDRMessage_t& pending = datagram->message;
+    uint32_t body_length = msg->length - RTPSMESSAGE_HEADER_SIZE;
+
+    if (RTPSMESSAGE_HEADER_SIZE < pending.length)
+    {
+        // Submessages before the first INFO_DST were built for a receiver without destination prefix. The receiver
+        // ignores INFO_DST submessages with an unknown prefix, so the state cannot be reset inside a datagram.
+        bool compatible_state = info.starts_with_destination ||
+                c_GuidPrefix_Unknown == datagram->current_destination;
+        bool same_header = 0 == memcmp(pending.buffer, msg->buffer, RTPSMESSAGE_HEADER_SIZE);
+        bool fits = pending.length + body_length <= pending.max_size;
+
+        if (!compatible_state || !same_header || !fits)
+        {
+            send_nts(*datagram, send_resources);
+        }
+    }
+
+    if (RTPSMESSAGE_HEADER_SIZE >= pending.length)
+    {
+        CDRMessage::initCDRMsg(&pending);
+        memcpy(pending.buffer, msg->buffer, RTPSMESSAGE_HEADER_SIZE);
+        pending.pos = RTPSMESSAGE_HEADER_SIZE;
+        pending.length = RTPSMESSAGE_HEADER_SIZE;
+        datagram->current_destination = c_GuidPrefix_Unknown;
+        datagram->max_blocking_time_point = max_blocking_time_point;
+    }
+    else if (max_blocking_time_point < datagram->max_blocking_time_point)
+    {
+        datagram->max_blocking_time_point = max_blocking_time_point;
+    }
+
+    memcpy(&pending.buffer[pending.pos], &msg->buffer[RTPSMESSAGE_HEADER_SIZE], body_length);
+    pending.pos += body_length;
+    pending.length = pending.pos;
+
+    if (c_GuidPrefix_Unknown != info.last_destination)
+    {
+        datagram->current_destination = info.last_destination;
+    }
+}
+
+void RTPSMessageCoalescer::flush_nts(
+        const Locator_t& locator,
+        fastdds::rtps::SendResourceList& send_resources)
+{
+    PendingDatagram* datagram = find_datagram_nts(locator);
+    if (nullptr != datagram)
+    {
+        send_nts(*datagram, send_resources);
+    }
+}
+
+void RTPSMessageCoalescer::flush_all_nts(
+        fastdds::rtps::SendResourceList& send_resources)
+{
+    timer_armed_ = false;
+
+    auto it = datagrams_.begin();
+    while (it != datagrams_.end())
+    {
+        PendingDatagram& datagram = *it->second;
+        if (RTPSMESSAGE_HEADER_SIZE < datagram.message.length)
+        {
+            send_nts(datagram, send_resources);
+            ++it;
+        }
+        else if (++datagram.idle_flushes >= max_idle_flushes)
+        {
+            it = datagrams_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    // Keep the timer running until the buffers of idle destinations are released
+    if (enabled_ && !datagrams_.empty())
+    {
+        timer_armed_ = true;
+        linger_timer_->restart_timer();
+    }
+}
+
+void RTPSMessageCoalescer::disable_nts(
+        fastdds::rtps::SendResourceList& send_resources)
+{
+    enabled_ = false;
+    flush_all_nts(send_resources);
+    datagrams_.clear();
+    linger_timer_->cancel_timer();
+}
+
+void RTPSMessageCoalescer::send_nts(
+        PendingDatagram& datagram,
+        fastdds::rtps::SendResourceList& send_resources)
+{
+    CDRMessage_t& pending = datagram.message;
+    if (RTPSMESSAGE_HEADER_SIZE < pending.length)
+    {
+        for (auto& send_resource : send_resources)
+        {
+            fastdds::rtps::Locators locators_begin(datagram.locator.begin());
+            fastdds::rtps::Locators locators_end(datagram.locator.end());
+            send_resource->send(pending.buffer, pending.length, &locators_begin, &locators_end,
+                    datagram.max_blocking_time_point);
+        }
+    }
+
+    pending.pos = 0;
+    pending.length = 0;
+    datagram.current_destination = c_GuidPrefix_Unknown;
+}
+
+RTPSMessageCoalescer::PendingDatagram* RTPSMessageCoalescer::find_datagram_nts(
+        const Locator_t& locator)
+{
+    auto it = datagrams_.find(locator);
+    return (datagrams_.end() == it) ? nullptr : it->second.get();
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
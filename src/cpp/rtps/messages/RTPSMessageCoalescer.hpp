@@ -0,0 +1,249 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RTPSMessageCoalescer.hpp
+ */
+
+#ifndef RTPS_MESSAGES_RTPSMESSAGECOALESCER_HPP
+#define RTPS_MESSAGES_RTPSMESSAGECOALESCER_HPP
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <fastdds/rtps/common/CDRMessage_t.h>
+#include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
+#include <fastdds/rtps/transport/TransportInterface.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class ResourceEvent;
+
+/**
+ * Packs small RTPS messages generated by different endpoints of the same participant into a single datagram per
+ * destination locator.
+ *
+ * Messages are kept for, at most, a configurable linger period before being sent. A pending datagram is sent earlier
+ * when the next message does not fit in it, or when a message that cannot be coalesced is sent to the same locator
+ * (so the per-locator ordering is kept).
+ *
+ * The buffer of a destination is released after it has stayed empty during several linger periods, so destinations
+ * that are no longer used do not keep memory.
+ *
+ * The RTPS receiver state (destination prefix) is carried from one submessage to the next inside a datagram, so a
+ * message is only appended when the state left by the pending datagram is compatible with the one the message was
+ * built for.
+ *
+ * Methods with the \c _nts suffix must be called with the participant's send resources mutex taken.
+ * @ingroup WRITER_MODULE
+ */
+class RTPSMessageCoalescer
+{
+public:
+
+    /**
+     * Construct a RTPSMessageCoalescer.
+     * @param event_resource Event thread where the linger timer will be run.
+     * @param on_linger_expired Callback called from the event thread when the linger period expires.
+     * It is expected to take the send resources mutex and call @ref flush_all_nts.
+     * @param linger Maximum time a message can be kept before being sent.
+     * @param max_datagram_size Maximum size of a coalesced datagram.
+     * @param max_message_size Messages bigger than this are never delayed.
+     */
+    RTPSMessageCoalescer(
+            ResourceEvent& event_resource,
+            std::function<void()> on_linger_expired,
+            const std::chrono::microseconds& linger,
+            uint32_t max_datagram_size,
+            uint32_t max_message_size);
+
+    ~RTPSMessageCoalescer();
+
+    /**
+     * Try to delay a message until it can be sent together with others to the same destinations.
+     * When the message cannot be delayed, the pending datagrams for its destinations are sent so the caller can send
+     * it directly afterwards.
+     *
+     * @param msg Message to send. Its buffer is copied.
+     * @param destination_locators_begin Iterator to the first destination locator.
+     * @param destination_locators_end Iterator to the end of destination locators.
+     * @param send_resources Send resources used to send the datagrams that have to be flushed.
+     * @param max_blocking_time_point Future time point where blocking send should end.
+     *
+     * @return true when the message has been queued, false when the caller should send it.
+     */
+    template<class LocatorIteratorT>
+    bool add_message_nts(
+            const CDRMessage_t* msg,
+            const LocatorIteratorT& destination_locators_begin,
+            const LocatorIteratorT& destination_locators_end,
+            fastdds::rtps::SendResourceList& send_resources,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point)
+    {
+        MessageInfo info;
+        bool can_coalesce = enabled_ && analyze_message(msg, info);
+        bool queued = false;
+
+        for (LocatorIteratorT it = destination_locators_begin; it != destination_locators_end; ++it)
+        {
+            if (can_coalesce)
+            {
+                append_nts(*it, msg, info, send_resources, max_blocking_time_point);
+                queued = true;
+            }
+            else
+            {
+                flush_nts(*it, send_resources);
+            }
+        }
+
+        if (queued && !timer_armed_)
+        {
+            timer_armed_ = true;
+            linger_timer_->restart_timer();
+        }
+
+        return can_coalesce;
+    }
+
+    /**
+     * Send all the pending datagrams.
+     * Each datagram is sent with the earliest blocking deadline of the messages it contains, so flushing from the
+     * event thread never blocks longer than the original senders allowed.
+     * @param send_resources Send resources used to send the datagrams.
+     */
+    void flush_all_nts(
+            fastdds::rtps::SendResourceList& send_resources);
+
+    /**
+     * Send all the pending datagrams and stop queueing new messages.
+     * @param send_resources Send resources used to send the datagrams.
+     */
+    void disable_nts(
+            fastdds::rtps::SendResourceList& send_resources);
+
+    /**
+     * Get the number of destination locators currently holding a datagram buffer.
+     * @return Number of allocated datagrams.
+     */
+    size_t num_datagrams_nts() const
+    {
+        return datagrams_.size();
+    }
+
+    //! Number of consecutive linger periods a datagram can stay empty before its buffer is released.
+    static constexpr uint32_t max_idle_flushes = 4;
+
+private:
+
+    //! Information extracted from a message prior to appending it to a pending datagram.
+    struct MessageInfo
+    {
+        //! Whether the first submessage sets the destination prefix.
+        bool starts_with_destination = false;
+        //! Last destination prefix set by the message.
+        GuidPrefix_t last_destination;
+    };
+
+    //! Datagram being built for a destination locator.
+    struct PendingDatagram
+    {
+        explicit PendingDatagram(
+                const Locator_t& loc,
+                uint32_t size)
+            : message(size)
+        {
+            locator.push_back(loc);
+        }
+
+        //! Destination of the datagram (single element, kept in a vector to be able to build LocatorsIterator).
+        std::vector<Locator_t> locator;
+        //! Datagram contents.
+        CDRMessage_t message;
+        //! Destination prefix the receiver will have after processing the current contents.
+        GuidPrefix_t current_destination;
+        //! Earliest blocking deadline of the messages in the datagram.
+        std::chrono::steady_clock::time_point max_blocking_time_point;
+        //! Number of consecutive linger periods the datagram has been empty.
+        uint32_t idle_flushes = 0;
+    };
+
+    //! Hash of a locator, used to index the pending datagrams.
+    struct LocatorHash
+    {
+        size_t operator ()(
+                const Locator_t& locator) const
+        {
+            size_t h = static_cast<size_t>(static_cast<uint32_t>(locator.kind)) * 31 + locator.port;
+            for (octet byte : locator.address)
+            {
+                h = h * 31 + byte;
+            }
+            return h;
+        }
+
+    };
+
+    bool analyze_message(
+            const CDRMessage_t* msg,
+            MessageInfo& info) const;
+
+    void append_nts(
+            const Locator_t& locator,
+            const CDRMessage_t* msg,
+            const MessageInfo& info,
+            fastdds::rtps::SendResourceList& send_resources,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
+
+    void flush_nts(
+            const Locator_t& locator,
+            fastdds::rtps::SendResourceList& send_resources);
+
+    void send_nts(
+            PendingDatagram& datagram,
+            fastdds::rtps::SendResourceList& send_resources);
+
+    PendingDatagram* find_datagram_nts(
+            const Locator_t& locator);
+
+    //! Maximum size of a coalesced datagram.
+    uint32_t max_datagram_size_;
+    //! Messages bigger than this are sent directly.
+    uint32_t max_message_size_;
+    //! Whether new messages can be queued.
+    bool enabled_ = true;
+    //! Whether the linger timer is currently scheduled.
+    bool timer_armed_ = false;
+    //! Datagrams being built, one per destination locator.
+    std::unordered_map<Locator_t, std::unique_ptr<PendingDatagram>, LocatorHash> datagrams_;
+    //! Linger timer. Should be the last member (see TimedEvent documentation).
+    std::unique_ptr<TimedEvent> linger_timer_;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#endif // RTPS_MESSAGES_RTPSMESSAGECOALESCER_HPP
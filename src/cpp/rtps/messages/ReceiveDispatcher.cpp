@@ -0,0 +1,171 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReceiveDispatcher.cpp
+ */
+
+#include <rtps/messages/ReceiveDispatcher.hpp>
+
+#include <algorithm>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/reader/RTPSReader.h>
+
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+ReceiveDispatcher::ReceiveDispatcher(
+        uint32_t num_workers,
+        uint32_t max_queued_tasks,
+        const fastdds::rtps::ThreadSettings& thread_settings,
+        uint32_t participant_id)
+    : max_queued_tasks_((std::max)(max_queued_tasks, 1u))
+{
+    workers_.reserve(num_workers);
+    for (uint32_t i = 0; i < num_workers; ++i)
+    {
+        workers_.emplace_back(new Worker());
+        Worker* worker = workers_.back().get();
+        worker->thread = create_thread([this, worker]()
+                        {
+                            run(*worker);
+                        }, thread_settings, "dds.rxw.%u.%u", participant_id, i);
+    }
+}
+
+ReceiveDispatcher::~ReceiveDispatcher()
+{
+    for (auto& worker : workers_)
+    {
+        {
+            std::lock_guard<std::mutex> guard(worker->mtx);
+            worker->stop = true;
+            worker->queue.clear();
+        }
+        worker->queue_cv.notify_all();
+    }
+
+    for (auto& worker : workers_)
+    {
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+    }
+}
+
+void ReceiveDispatcher::push(
+        RTPSReader* reader,
+        Task&& task)
+{
+    Worker& worker = worker_for(reader);
+
+    std::unique_lock<std::mutex> lock(worker.mtx);
+    if (worker.stop)
+    {
+        return;
+    }
+
+    // The reception thread cannot wait here, as it holds the lock of its MessageReceiver
+    if (worker.queue.size() >= max_queued_tasks_)
+    {
+        worker.queue.pop_front();
+        dropped_tasks_.fetch_add(1, std::memory_order_relaxed);
+        ++worker.dropped_since_warning;
+
+        // Do not flood the log while the worker is overloaded
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (now - worker.last_drop_warning >= std::chrono::seconds(1))
+        {
+            EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "Receive dispatch queue full, " << worker.dropped_since_warning
+                                                                              << " tasks discarded");
+            worker.dropped_since_warning = 0;
+            worker.last_drop_warning = now;
+        }
+    }
+
+    worker.queue.push_back({reader, std::move(task)});
+    lock.unlock();
+    worker.queue_cv.notify_one();
+}
+
+void ReceiveDispatcher::remove_reader(
+        RTPSReader* reader)
+{
+    Worker& worker = worker_for(reader);
+
+    std::unique_lock<std::mutex> lock(worker.mtx);
+    worker.queue.erase(std::remove_if(worker.queue.begin(), worker.queue.end(),
+            [reader](const QueuedTask& queued)
+            {
+                return queued.reader == reader;
+            }), worker.queue.end());
+
+    // A task removing its own reader cannot wait for itself
+    if (worker.thread.is_calling_thread())
+    {
+        return;
+    }
+
+    // Wait for the current task on the reader to finish
+    worker.idle_cv.wait(lock, [reader, &worker]()
+            {
+                return worker.running_reader != reader;
+            });
+}
+
+ReceiveDispatcher::Worker& ReceiveDispatcher::worker_for(
+        const RTPSReader* reader)
+{
+    size_t index = std::hash<EntityId_t>()(reader->getGuid().entityId) % workers_.size();
+    return *workers_[index];
+}
+
+void ReceiveDispatcher::run(
+        Worker& worker)
+{
+    std::unique_lock<std::mutex> lock(worker.mtx);
+    while (true)
+    {
+        worker.queue_cv.wait(lock, [&worker]()
+                {
+                    return worker.stop || !worker.queue.empty();
+                });
+
+        if (worker.stop)
+        {
+            break;
+        }
+
+        QueuedTask queued = std::move(worker.queue.front());
+        worker.queue.pop_front();
+        worker.running_reader = queued.reader;
+        lock.unlock();
+
+        queued.task();
+
+        lock.lock();
+        worker.running_reader = nullptr;
+        // Wake up any thread waiting on remove_reader
+        worker.idle_cv.notify_all();
+    }
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
@@ -0,0 +1,149 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReceiveDispatcher.hpp
+ */
+
+#ifndef RTPS_MESSAGES_RECEIVEDISPATCHER_HPP
+#define RTPS_MESSAGES_RECEIVEDISPATCHER_HPP
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastdds/rtps/common/Guid.h>
+
+#include <utils/thread.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class RTPSReader;
+
+/**
+ * Pool of worker threads where the submessages directed to user readers are processed.
+ *
+ * Each reader is served always by the same worker, so the submessages directed to a reader are processed in the
+ * same order they were received, while different readers are processed in parallel.
+ *
+ * Tasks are pushed by the reception threads while they hold the lock of their MessageReceiver, so pushing never
+ * blocks. When the queue of a worker is full, its oldest task is discarded. Reliable readers recover the discarded
+ * submessages through the retransmission mechanism. Discarded tasks are counted, and reported on a rate-limited
+ * warning.
+ * @ingroup MANAGEMENT_MODULE
+ */
+class ReceiveDispatcher
+{
+public:
+
+    using Task = std::function<void()>;
+
+    /**
+     * Construct a ReceiveDispatcher and start its worker threads.
+     * @param num_workers Number of worker threads.
+     * @param max_queued_tasks Maximum number of tasks waiting on each worker.
+     *                         When reached, the oldest task is discarded.
+     * @param thread_settings Settings of the worker threads.
+     * @param participant_id Identifier of the participant, used on the name of the threads.
+     */
+    ReceiveDispatcher(
+            uint32_t num_workers,
+            uint32_t max_queued_tasks,
+            const fastdds::rtps::ThreadSettings& thread_settings,
+            uint32_t participant_id);
+
+    ~ReceiveDispatcher();
+
+    /**
+     * Queue a task for a reader. This method never blocks.
+     * @param reader Reader the task is directed to.
+     * @param task Processing to be performed on the reader.
+     */
+    void push(
+            RTPSReader* reader,
+            Task&& task);
+
+    /**
+     * Discard all the tasks queued for a reader, waiting for the one being currently executed (if any).
+     * After this call, the reader will not be accessed by the workers unless new tasks are pushed for it.
+     * When called from a task of the reader (e.g. a listener removing it), the running task is the caller, so it is
+     * not waited for.
+     * @param reader Reader being removed.
+     * @pre The caller does not hold locks that the tasks of the reader may need, as the running task is waited for.
+     */
+    void remove_reader(
+            RTPSReader* reader);
+
+    /**
+     * Get the number of tasks discarded because the queue of their worker was full.
+     * @return Number of discarded tasks since construction.
+     */
+    uint64_t dropped_tasks() const
+    {
+        return dropped_tasks_.load(std::memory_order_relaxed);
+    }
+
+private:
+
+    struct QueuedTask
+    {
+        RTPSReader* reader;
+        Task task;
+    };
+
+    struct Worker
+    {
+        std::mutex mtx;
+        std::condition_variable queue_cv;
+        std::condition_variable idle_cv;
+        std::deque<QueuedTask> queue;
+        RTPSReader* running_reader = nullptr;
+        bool stop = false;
+        //! Tasks discarded since the last warning.
+        uint64_t dropped_since_warning = 0;
+        //! Time of the last warning about discarded tasks.
+        std::chrono::steady_clock::time_point last_drop_warning;
+        eprosima::thread thread;
+    };
+
+    Worker& worker_for(
+            const RTPSReader* reader);
+
+    void run(
+            Worker& worker);
+
+    uint32_t max_queued_tasks_;
+
+    std::atomic<uint64_t> dropped_tasks_{0};
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#endif // RTPS_MESSAGES_RECEIVEDISPATCHER_HPP
@@ -40,8 +40,12 @@ ReceiverResource::ReceiverResource(
     , cv_()
     , receiver(nullptr)
     , max_message_size_(max_recv_buffer_size)
-    , active_callbacks_(0)
+    , generation_(0)
+    , disabled_(false)
 {
+    active_callbacks_[0].store(0);
+    active_callbacks_[1].store(0);
+
     // Internal channel is opened and assigned to this resource.
     mValid = transport.OpenInputChannel(locator, this, max_message_size_);
     if (!mValid)
@@ -67,13 +71,14 @@ ReceiverResource::ReceiverResource(
 
     Cleanup.swap(rValueResource.Cleanup);
     LocatorMapsToManagedChannel.swap(rValueResource.LocatorMapsToManagedChannel);
-    receiver = rValueResource.receiver;
-    rValueResource.receiver = nullptr;
+    receiver.store(rValueResource.receiver.exchange(nullptr));
     mValid = rValueResource.mValid;
     rValueResource.mValid = false;
     max_message_size_ = rValueResource.max_message_size_;
-    active_callbacks_ = rValueResource.active_callbacks_;
-    rValueResource.active_callbacks_ = 0;
+    generation_.store(rValueResource.generation_.load());
+    active_callbacks_[0].store(rValueResource.active_callbacks_[0].exchange(0));
+    active_callbacks_[1].store(rValueResource.active_callbacks_[1].exchange(0));
+    disabled_.store(rValueResource.disabled_.load());
 }
 
 bool ReceiverResource::SupportsLocator(
@@ -89,23 +94,21 @@ bool ReceiverResource::SupportsLocator(
 void ReceiverResource::RegisterReceiver(
         MessageReceiver* rcv)
 {
-    std::lock_guard<std::mutex> _(mtx);
-
-    if (receiver == nullptr)
-    {
-        receiver = rcv;
-    }
+    MessageReceiver* expected = nullptr;
+    receiver.compare_exchange_strong(expected, rcv);
 }
 
 void ReceiverResource::UnregisterReceiver(
         MessageReceiver* rcv)
 {
-    std::lock_guard<std::mutex> _(mtx);
-
-    if (receiver == rcv)
+    MessageReceiver* expected = rcv;
+    if (!receiver.compare_exchange_strong(expected, nullptr))
     {
-        receiver = nullptr;
+        return;
     }
+
+    // Callbacks started from now on will not see the receiver, wait for the ones that could be using it
+    wait_for_running_callbacks();
 }
 
 void ReceiverResource::OnDataReceived(
@@ -116,14 +119,21 @@ void ReceiverResource::OnDataReceived(
 {
     (void)localLocator;
 
-    std::lock_guard<std::mutex> _(mtx);
+    // Count this callback before checking the state, so disable() and UnregisterReceiver() either wait for it or it
+    // sees the new state. It is counted again if a waiter has started a new generation meanwhile.
+    uint32_t generation = generation_.load();
+    active_callbacks_[generation & 1].fetch_add(1);
+    while (generation != generation_.load())
+    {
+        callback_finished(generation);
+        generation = generation_.load();
+        active_callbacks_[generation & 1].fetch_add(1);
+    }
 
-    MessageReceiver* rcv = receiver;
+    MessageReceiver* rcv = receiver.load();
 
-    if (rcv != nullptr && active_callbacks_ >= 0)
+    if (rcv != nullptr && !disabled_.load())
     {
-        ++active_callbacks_;
-
         CDRMessage_t msg(0);
         msg.wraps = true;
         msg.buffer = const_cast<octet*>(data);
@@ -131,17 +141,36 @@ void ReceiverResource::OnDataReceived(
         msg.max_size = size;
         msg.reserved_size = size;
 
-        // TODO: Should we unlock in case UnregisterReceiver is called from callback ?
         rcv->processCDRMsg(remoteLocator, localLocator, &msg);
+    }
 
-        // allow disabling
-        if (--active_callbacks_ == 0)
-        {
-            cv_.notify_one();
-        }
+    // allow disabling and unregistering the receiver
+    callback_finished(generation);
+}
+
+void ReceiverResource::callback_finished(
+        uint32_t generation)
+{
+    // Only the last callback of a previous generation, or of any generation once disabled, can have a waiter
+    if (1 == active_callbacks_[generation & 1].fetch_sub(1) &&
+            (generation != generation_.load() || disabled_.load()))
+    {
+        std::lock_guard<std::mutex> _(mtx);
+        cv_.notify_all();
     }
 }
 
+void ReceiverResource::wait_for_running_callbacks()
+{
+    // The slot of the previous generation is only reused if another receiver is registered and unregistered meanwhile
+    std::unique_lock<std::mutex> lock(mtx);
+    uint32_t previous = generation_.fetch_add(1);
+    cv_.wait(lock, [this, previous]
+            {
+                return active_callbacks_[previous & 1].load() <= 0;
+            });
+}
+
 void ReceiverResource::disable()
 {
     if (Cleanup)
@@ -149,14 +178,15 @@ void ReceiverResource::disable()
         Cleanup();
     }
 
-    // wait until all callbacks are finished
+    // no more callbacks
+    disabled_.store(true);
+
+    // wait until all callbacks are finished, as the resource can be destroyed afterwards
     std::unique_lock<std::mutex> lock(mtx);
     cv_.wait(lock, [this]
             {
-                return active_callbacks_ <= 0;
+                return active_callbacks_[0].load() <= 0 && active_callbacks_[1].load() <= 0;
             });
-    // no more callbacks
-    active_callbacks_ = -1;
 }
 
 ReceiverResource::~ReceiverResource()
@@ -15,6 +15,7 @@
 #ifndef _RTPS_NETWORK_RECEIVERRESOURCE_H_
 #define _RTPS_NETWORK_RECEIVERRESOURCE_H_
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -45,6 +46,8 @@ public:
 
     /**
      * Method called by the transport when receiving data.
+     * It can be called from several transport threads at the same time, and the registered MessageReceiver is
+     * called without any lock taken.
      * @param data Pointer to the received data.
      * @param size Number of bytes received.
      * @param localLocator Locator identifying the local endpoint.
@@ -72,13 +75,15 @@ public:
 
     /**
      * Unregister a MessageReceiver object to be called upon reception of data.
+     * Waits for the callbacks being executed, so the receiver can be destroyed on return.
      * @param receiver The message receiver to unregister.
+     * @pre Not called from inside a callback of this resource.
      */
     void UnregisterReceiver(
             MessageReceiver* receiver);
 
     /**
-     * Closes related ChannelResources.
+     * Closes related ChannelResources, and waits for the callbacks being executed.
      */
     void disable();
 
@@ -112,11 +117,29 @@ private:
     std::function<bool(const Locator_t&)> LocatorMapsToManagedChannel;
     bool mValid; // Post-construction validity check for the NetworkFactory
 
+    /**
+     * Wait for the callbacks that could have seen the receiver being unregistered.
+     * Callbacks started afterwards are counted on a new generation, so a busy locator does not delay the return.
+     */
+    void wait_for_running_callbacks();
+
+    /**
+     * Account for the end of a callback, notifying the waiter if it was the last one of its generation.
+     * @param generation Generation the callback was counted on.
+     */
+    void callback_finished(
+            uint32_t generation);
+
+    //! Used, together with cv_, to wait for the callbacks being executed when disabling or unregistering.
     std::mutex mtx;
     std::condition_variable cv_;
-    MessageReceiver* receiver;
+    std::atomic<MessageReceiver*> receiver;
     uint32_t max_message_size_;
-    int active_callbacks_;
+    //! Incremented each time the callbacks being executed have to be waited for.
+    std::atomic<uint32_t> generation_;
+    //! Number of transport threads inside OnDataReceived, indexed by the parity of the generation they entered.
+    std::atomic<int> active_callbacks_[2];
+    std::atomic<bool> disabled_;
 };
 
 } // namespace rtps
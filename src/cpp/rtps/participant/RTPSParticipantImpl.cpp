@@ -484,6 +484,9 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     }
 #endif // if HAVE_SECURITY
 
+    // Must be created before the message receivers
+    setup_receive_dispatcher();
+    setup_fragment_reassembly();
     setup_meta_traffic();
     setup_user_traffic();
     setup_initial_peers();
@@ -722,6 +725,148 @@ void RTPSParticipantImpl::setup_output_traffic()
     {
         flow_controller_factory_.register_flow_controller(*flow_controller_desc.get());
     }
+
+    setup_message_coalescing();
+}
+
+void RTPSParticipantImpl::setup_message_coalescing()
+{
+    uint32_t linger_us = 0;
+    uint32_t max_coalesced_message_size = 1024;
+
+    try
+    {
+        const std::string* linger_property =
+                PropertyPolicyHelper::find_property(m_att.properties, "fastdds.message_coalescing.linger_us");
+        if (linger_property != nullptr)
+        {
+            linger_us = static_cast<uint32_t>(std::stoul(*linger_property));
+        }
+
+        const std::string* max_size_property =
+                PropertyPolicyHelper::find_property(m_att.properties, "fastdds.message_coalescing.max_message_size");
+        if (max_size_property != nullptr)
+        {
+            max_coalesced_message_size = static_cast<uint32_t>(std::stoul(*max_size_property));
+        }
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT, "Error parsing message coalescing properties: " << e.what());
+        return;
+    }
+
+    if (0 == linger_us)
+    {
+        return;
+    }
+
+#if HAVE_SECURITY
+    // Protected RTPS messages are encoded as a whole and cannot be concatenated.
+    if (security_attributes_.is_rtps_protected)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_PARTICIPANT, "Message coalescing is not compatible with RTPS protection. Ignoring.");
+        return;
+    }
+#endif  // HAVE_SECURITY
+
+    message_coalescer_.reset(new RTPSMessageCoalescer(mp_event_thr,
+            [this]()
+            {
+                flush_coalesced_messages();
+            },
+            std::chrono::microseconds(linger_us),
+            (std::min)(getMaxMessageSize(), fastdds::rtps::s_maximumMessageSize),
+            max_coalesced_message_size));
+}
+
+void RTPSParticipantImpl::setup_receive_dispatcher()
+{
+    uint32_t num_threads = 0;
+    uint32_t max_queued_tasks = 256;
+
+    try
+    {
+        const std::string* threads_property =
+                PropertyPolicyHelper::find_property(m_att.properties, "fastdds.receive_dispatch.threads");
+        if (threads_property != nullptr)
+        {
+            num_threads = static_cast<uint32_t>(std::stoul(*threads_property));
+        }
+
+        const std::string* queue_property =
+                PropertyPolicyHelper::find_property(m_att.properties, "fastdds.receive_dispatch.max_queued_tasks");
+        if (queue_property != nullptr)
+        {
+            max_queued_tasks = static_cast<uint32_t>(std::stoul(*queue_property));
+        }
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT, "Error parsing receive dispatch properties: " << e.what());
+        return;
+    }
+
+    if (0 == num_threads)
+    {
+        return;
+    }
+
+#if HAVE_SECURITY
+    // Decoded payloads are only valid during the reception of the message.
+    if (m_security_manager.is_security_active())
+    {
+        EPROSIMA_LOG_WARNING(RTPS_PARTICIPANT, "Receive dispatch is not compatible with security. Ignoring.");
+        return;
+    }
+#endif  // HAVE_SECURITY
+
+    receive_dispatcher_.reset(new ReceiveDispatcher(num_threads, max_queued_tasks, fastdds::rtps::ThreadSettings{},
+            static_cast<uint32_t>(m_att.participantID)));
+}
+
+void RTPSParticipantImpl::setup_fragment_reassembly()
+{
+    uint64_t max_bytes = 0;
+    uint32_t max_samples_per_writer = 0;
+
+    try
+    {
+        const std::string* bytes_property =
+                PropertyPolicyHelper::find_property(m_att.properties, "fastdds.reassembly.max_bytes");
+        if (bytes_property != nullptr)
+        {
+            max_bytes = static_cast<uint64_t>(std::stoull(*bytes_property));
+        }
+
+        const std::string* samples_property =
+                PropertyPolicyHelper::find_property(m_att.properties, "fastdds.reassembly.max_samples_per_writer");
+        if (samples_property != nullptr)
+        {
+            max_samples_per_writer = static_cast<uint32_t>(std::stoul(*samples_property));
+        }
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT, "Error parsing fragment reassembly properties: " << e.what());
+        return;
+    }
+
+    if (0 == max_bytes && 0 == max_samples_per_writer)
+    {
+        return;
+    }
+
+    fragment_reassembly_budget_.reset(new FragmentReassemblyBudget(max_bytes, max_samples_per_writer));
+}
+
+void RTPSParticipantImpl::flush_coalesced_messages()
+{
+    std::lock_guard<std::timed_mutex> guard(m_send_resources_mutex_);
+    if (message_coalescer_)
+    {
+        message_coalescer_->flush_all_nts(send_resource_list_);
+    }
 }
 
 void RTPSParticipantImpl::enable()
@@ -741,6 +886,15 @@ void RTPSParticipantImpl::disable()
     // stopRTPSParticipantAnnouncement()
     mp_event_thr.stop_thread();
 
+    // Send pending coalesced messages, and send any further message directly, as the linger timer will not run.
+    {
+        std::lock_guard<std::timed_mutex> guard(m_send_resources_mutex_);
+        if (message_coalescer_)
+        {
+            message_coalescer_->disable_nts(send_resource_list_);
+        }
+    }
+
     // Disable Retries on Transports
     m_network_Factory.Shutdown();
 
@@ -784,6 +938,7 @@ RTPSParticipantImpl::~RTPSParticipantImpl()
         delete block.mp_receiver;
     }
     m_receiverResourcelist.clear();
+    receive_dispatcher_.reset();
 
     delete mp_userParticipant;
     mp_userParticipant = nullptr;
@@ -2156,6 +2311,12 @@ bool RTPSParticipantImpl::deleteUserEndpoint(
         return false;
     }
 
+    if (p_endpoint->getAttributes().endpointKind == READER)
+    {
+        // Should be done before unlinking from the receivers (see MessageReceiver::findAllReaders)
+        matched_readers_index_.remove_reader(static_cast<RTPSReader*>(p_endpoint));
+    }
+
     {
         std::lock_guard<std::mutex> _(m_receiverResourcelistMutex);
 
@@ -2248,6 +2409,11 @@ void RTPSParticipantImpl::deleteAllUserEndpoints()
     // unlink the transport receiver blocks from the endpoints
     for ( auto endpoint : tmp)
     {
+        if (endpoint->getAttributes().endpointKind == READER)
+        {
+            matched_readers_index_.remove_reader(static_cast<RTPSReader*>(endpoint));
+        }
+
         std::lock_guard<std::mutex> _(m_receiverResourcelistMutex);
 
         for (auto& rb : m_receiverResourcelist)
@@ -51,8 +51,12 @@
 #include <fastrtps/utils/shared_mutex.hpp>
 
 #include "../flowcontrol/FlowControllerFactory.hpp"
+#include <rtps/messages/MatchedReadersIndex.hpp>
+#include <rtps/messages/ReceiveDispatcher.hpp>
+#include <rtps/messages/RTPSMessageCoalescer.hpp>
 #include <rtps/messages/RTPSMessageGroup_t.hpp>
 #include <rtps/messages/SendBuffersManager.hpp>
+#include <rtps/reader/FragmentReassemblyBudget.hpp>
 #include <rtps/network/NetworkFactory.h>
 #include <rtps/network/ReceiverResource.h>
 #include <statistics/rtps/monitor-service/interfaces/IConnectionsObserver.hpp>
@@ -273,6 +277,24 @@ public:
         return mp_event_thr;
     }
 
+    //! Get the index of the local user readers matched with each remote writer.
+    MatchedReadersIndex& matched_readers_index()
+    {
+        return matched_readers_index_;
+    }
+
+    //! Get the dispatcher where user readers process received submessages (null when processed inline).
+    ReceiveDispatcher* receive_dispatcher() const
+    {
+        return receive_dispatcher_.get();
+    }
+
+    //! Get the memory budget for the reassembly of fragmented samples on user readers (null when unlimited).
+    FragmentReassemblyBudget* fragment_reassembly_budget() const
+    {
+        return fragment_reassembly_budget_.get();
+    }
+
     /**
      * Send a message to several locations
      * @param msg Message to send.
@@ -300,12 +322,19 @@ public:
         {
             ret_code = true;
 
-            for (auto& send_resource : send_resource_list_)
+            bool coalesced = message_coalescer_ &&
+                    message_coalescer_->add_message_nts(msg, destination_locators_begin, destination_locators_end,
+                            send_resource_list_, max_blocking_time_point);
+
+            if (!coalesced)
             {
-                LocatorIteratorT locators_begin = destination_locators_begin;
-                LocatorIteratorT locators_end = destination_locators_end;
-                send_resource->send(msg->buffer, msg->length, &locators_begin, &locators_end,
-                        max_blocking_time_point);
+                for (auto& send_resource : send_resource_list_)
+                {
+                    LocatorIteratorT locators_begin = destination_locators_begin;
+                    LocatorIteratorT locators_end = destination_locators_end;
+                    send_resource->send(msg->buffer, msg->length, &locators_begin, &locators_end,
+                            max_blocking_time_point);
+                }
             }
 
             lock.unlock();
@@ -604,6 +633,9 @@ private:
     security::SecurityManager m_security_manager;
 #endif // if HAVE_SECURITY
 
+    //! Local user readers matched with each remote writer, used by the message receivers.
+    MatchedReadersIndex matched_readers_index_;
+
     //! Encapsulates all associated resources on a Receiving element.
     std::list<ReceiverControlBlock> m_receiverResourcelist;
     //! Receiver resource list needs its own mutext to avoid a race condition.
@@ -612,6 +644,12 @@ private:
     //!SenderResource List
     std::timed_mutex m_send_resources_mutex_;
     fastdds::rtps::SendResourceList send_resource_list_;
+    //! Packs small messages from different endpoints into a single datagram. Protected by m_send_resources_mutex_.
+    std::unique_ptr<RTPSMessageCoalescer> message_coalescer_;
+    //! Worker threads where user readers process received submessages. Null when processing is done inline.
+    std::unique_ptr<ReceiveDispatcher> receive_dispatcher_;
+    //! Memory budget for the reassembly of fragmented samples on user readers. Null when unlimited.
+    std::unique_ptr<FragmentReassemblyBudget> fragment_reassembly_budget_;
 
     //!Participant Listener
     RTPSParticipantListener* mp_participantListener;
@@ -632,6 +670,12 @@ private:
     void setup_user_traffic();
     void setup_initial_peers();
     void setup_output_traffic();
+    void setup_message_coalescing();
+    void setup_receive_dispatcher();
+    void setup_fragment_reassembly();
+
+    //! Send all the messages kept by the message coalescer.
+    void flush_coalesced_messages();
 
     RTPSParticipantImpl& operator =(
             const RTPSParticipantImpl&) = delete;
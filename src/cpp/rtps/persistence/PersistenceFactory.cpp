@@ -30,7 +30,7 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
-std::vector<CacheChange_t*>& IPersistenceService::get_changes(
+History::changes_container& IPersistenceService::get_changes(
         WriterHistory* history)
 {
     return history->m_changes;
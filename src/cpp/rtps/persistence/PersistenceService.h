@@ -22,6 +22,7 @@
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/common/CacheChange.h>
 #include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/rtps/history/History.h>
 #include <fastdds/rtps/history/IChangePool.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
 
@@ -109,7 +110,7 @@ public:
             const GUID_t& writer_guid,
             const SequenceNumber_t& seq_number) = 0;
 
-    static std::vector<CacheChange_t*>& get_changes(
+    static History::changes_container& get_changes(
             WriterHistory* history);
 
     static void set_fragments(
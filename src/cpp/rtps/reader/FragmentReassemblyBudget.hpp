@@ -0,0 +1,113 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FragmentReassemblyBudget.hpp
+ */
+
+#ifndef FASTRTPS_RTPS_READER_FRAGMENTREASSEMBLYBUDGET_HPP_
+#define FASTRTPS_RTPS_READER_FRAGMENTREASSEMBLYBUDGET_HPP_
+
+#include <atomic>
+#include <cstdint>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Memory budget shared by all the readers of a participant for the reassembly of fragmented samples.
+ *
+ * Readers reserve the size of a fragmented sample when its first fragment is received, and release it when the
+ * sample is completed or discarded. Fragments of new samples are dropped while the budget is exhausted, or while
+ * their writer already has the maximum number of samples being reassembled, and will be recovered by the
+ * retransmission mechanism of reliable writers.
+ */
+class FragmentReassemblyBudget
+{
+public:
+
+    /**
+     * @param max_bytes Maximum number of bytes being reassembled at the same time. 0 means no limit.
+     * @param max_samples_per_writer Maximum number of samples of each writer being reassembled at the same time.
+     * 0 means no limit.
+     */
+    FragmentReassemblyBudget(
+            uint64_t max_bytes,
+            uint32_t max_samples_per_writer)
+        : max_bytes_(max_bytes)
+        , max_samples_per_writer_(max_samples_per_writer)
+    {
+    }
+
+    /**
+     * Reserve memory for the reassembly of a sample.
+     * @param bytes Size of the sample.
+     * @return Whether the memory fits in the budget.
+     */
+    bool try_reserve(
+            uint64_t bytes)
+    {
+        uint64_t used = used_bytes_.load(std::memory_order_relaxed);
+        do
+        {
+            if (0 != max_bytes_ && (bytes > max_bytes_ || used > max_bytes_ - bytes))
+            {
+                return false;
+            }
+        } while (!used_bytes_.compare_exchange_weak(used, used + bytes, std::memory_order_relaxed));
+
+        return true;
+    }
+
+    /**
+     * Release memory previously reserved with try_reserve.
+     * @param bytes Size of the sample.
+     */
+    void release(
+            uint64_t bytes)
+    {
+        used_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    //! Number of bytes currently reserved.
+    uint64_t used_bytes() const
+    {
+        return used_bytes_.load(std::memory_order_relaxed);
+    }
+
+    //! Maximum number of bytes being reassembled at the same time. 0 means no limit.
+    uint64_t max_bytes() const
+    {
+        return max_bytes_;
+    }
+
+    //! Maximum number of samples of each writer being reassembled at the same time. 0 means no limit.
+    uint32_t max_samples_per_writer() const
+    {
+        return max_samples_per_writer_;
+    }
+
+private:
+
+    const uint64_t max_bytes_;
+    const uint32_t max_samples_per_writer_;
+    std::atomic<uint64_t> used_bytes_{0};
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif // FASTRTPS_RTPS_READER_FRAGMENTREASSEMBLYBUDGET_HPP_
@@ -126,12 +126,28 @@ void RTPSReader::init(
             getGuid(), att.endpoint.data_sharing_configuration().shm_directory());
         if (notification)
         {
+            uint32_t spin_budget_us = 0;
+            const std::string* spin_property =
+                    PropertyPolicyHelper::find_property(att.endpoint.properties, "fastdds.datasharing.spin_budget_us");
+            if (spin_property != nullptr)
+            {
+                try
+                {
+                    spin_budget_us = static_cast<uint32_t>(std::stoul(*spin_property));
+                }
+                catch (const std::exception& e)
+                {
+                    EPROSIMA_LOG_ERROR(RTPS_READER, "Error parsing datasharing spin_budget_us property: " << e.what());
+                }
+            }
+
             is_datasharing_compatible_ = true;
             datasharing_listener_.reset(new DataSharingListener(
                         notification,
                         att.endpoint.data_sharing_configuration().shm_directory(),
                         att.data_sharing_listener_thread,
                         att.matched_writers_allocation,
+                        spin_budget_us,
                         this));
 
             // We can start the listener here, as no writer can be matched already,
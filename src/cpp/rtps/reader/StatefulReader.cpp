@@ -17,6 +17,7 @@
  *
  */
 
+#include <algorithm>
 #include <cassert>
 #include <mutex>
 #include <thread>
@@ -37,6 +38,7 @@
 #include <rtps/DataSharing/ReaderPool.hpp>
 #include <rtps/history/HistoryAttributesExtension.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
+#include <rtps/reader/FragmentReassemblyBudget.hpp>
 #include <rtps/reader/WriterProxy.h>
 
 #include "rtps/RTPSDomainImpl.hpp"
@@ -53,7 +55,7 @@ static void send_datasharing_ack(
 {
     // This may not be the change read with highest SN,
     // need to find largest SN to ACK
-    for (std::vector<CacheChange_t*>::iterator it = history->changesBegin(); it != history->changesEnd(); ++it)
+    for (ReaderHistory::iterator it = history->changesBegin(); it != history->changesEnd(); ++it)
     {
         if (!(*it)->isRead)
         {
@@ -99,6 +101,13 @@ StatefulReader::~StatefulReader()
     {
         std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
         is_alive_ = false;
+
+        // Changes still being reassembled will not be released through change_removed_by_history
+        if (nullptr != reassembly_budget_)
+        {
+            reassembly_budget_->release(reassembly_bytes_);
+            reassembly_bytes_ = 0;
+        }
     }
 
     // Datasharing listener must be stopped to avoid processing notifications
@@ -187,6 +196,11 @@ void StatefulReader::init(
     {
         matched_writers_pool_.push_back(new WriterProxy(this, part_att.allocation.locators, proxy_changes_config_));
     }
+
+    if (!m_guid.is_builtin())
+    {
+        reassembly_budget_ = pimpl->fragment_reassembly_budget();
+    }
 }
 
 bool StatefulReader::matched_writer_add(
@@ -334,6 +348,11 @@ bool StatefulReader::matched_writer_add(
             matched_writers_.push_back(wp);
             EPROSIMA_LOG_INFO(RTPS_READER, "Writer Proxy " << wp->guid() << " added to " << m_guid.entityId);
         }
+
+        if (!m_guid.is_builtin())
+        {
+            mp_RTPSParticipant->matched_readers_index().add(wdata.guid(), m_guid.entityId, this);
+        }
     }
     if (liveliness_lease_duration_ < c_TimeInfinite)
     {
@@ -419,6 +438,10 @@ bool StatefulReader::matched_writer_remove(
                 EPROSIMA_LOG_INFO(RTPS_READER, "Writer proxy " << writer_guid << " removed from " << m_guid.entityId);
                 wproxy = *it;
                 matched_writers_.erase(it);
+                if (!m_guid.is_builtin())
+                {
+                    mp_RTPSParticipant->matched_readers_index().remove(writer_guid, this);
+                }
 
                 break;
             }
@@ -727,21 +750,29 @@ bool StatefulReader::processDataFragMsg(
             CacheChange_t* work_change = nullptr;
             if (!mp_history->get_change(change_to_add->sequenceNumber, change_to_add->writerGUID, &work_change))
             {
-                // A new change should be reserved
-                if (reserveCache(&work_change, sampleSize))
+                // A new change should be reserved, unless the reassembly limits have been reached
+                if (reserve_reassembly_nts(pWP, sampleSize))
                 {
-                    if (work_change->serializedPayload.max_size < sampleSize)
+                    if (reserveCache(&work_change, sampleSize))
                     {
-                        releaseCache(work_change);
-                        work_change = nullptr;
+                        if (work_change->serializedPayload.max_size < sampleSize)
+                        {
+                            releaseCache(work_change);
+                            work_change = nullptr;
+                        }
+                        else
+                        {
+                            work_change->copy_not_memcpy(change_to_add);
+                            work_change->serializedPayload.length = sampleSize;
+                            work_change->instanceHandle.clear();
+                            work_change->setFragmentSize(change_to_add->getFragmentSize(), true);
+                            change_created = work_change;
+                        }
                     }
-                    else
+
+                    if (nullptr == change_created)
                     {
-                        work_change->copy_not_memcpy(change_to_add);
-                        work_change->serializedPayload.length = sampleSize;
-                        work_change->instanceHandle.clear();
-                        work_change->setFragmentSize(change_to_add->getFragmentSize(), true);
-                        change_created = work_change;
+                        release_reassembly_nts(pWP, sampleSize);
                     }
                 }
             }
@@ -768,12 +799,15 @@ bool StatefulReader::processDataFragMsg(
 
                     releaseCache(change_created);
                     work_change = nullptr;
+                    release_reassembly_nts(pWP, sampleSize);
                 }
             }
 
             // If change has been fully reassembled, mark as received and add notify user
             if (work_change != nullptr && work_change->is_fully_assembled())
             {
+                release_reassembly_nts(pWP, work_change->serializedPayload.length);
+
                 fastdds::dds::SampleRejectedStatusKind rejection_reason;
                 if (mp_history->completed_change(work_change, changes_up_to, rejection_reason))
                 {
@@ -1043,6 +1077,7 @@ bool StatefulReader::change_removed_by_history(
             {
                 if (!findWriterProxy(a_change->writerGUID, &proxy))
                 {
+                    release_reassembly_nts(nullptr, a_change->serializedPayload.length);
                     return false;
                 }
 
@@ -1050,6 +1085,7 @@ bool StatefulReader::change_removed_by_history(
                 send_ack_if_datasharing(this, mp_history, proxy, a_change->sequenceNumber);
             }
 
+            release_reassembly_nts(proxy, a_change->serializedPayload.length);
         }
 
         return true;
@@ -1276,7 +1312,7 @@ void StatefulReader::remove_changes_from(
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
     std::vector<CacheChange_t*> toremove;
-    for (std::vector<CacheChange_t*>::iterator it = mp_history->changesBegin();
+    for (ReaderHistory::iterator it = mp_history->changesBegin();
             it != mp_history->changesEnd(); ++it)
     {
         if ((*it)->writerGUID == writerGUID)
@@ -1299,6 +1335,46 @@ void StatefulReader::remove_changes_from(
     }
 }
 
+bool StatefulReader::reserve_reassembly_nts(
+        WriterProxy* wp,
+        uint32_t sample_size)
+{
+    if (nullptr == reassembly_budget_)
+    {
+        return true;
+    }
+
+    uint32_t max_samples = reassembly_budget_->max_samples_per_writer();
+    if ((0 != max_samples && wp->fragmented_changes_in_flight() >= max_samples) ||
+            !reassembly_budget_->try_reserve(sample_size))
+    {
+        EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Reassembly limits reached. Dropping fragment from " << wp->guid());
+        return false;
+    }
+
+    wp->fragmented_change_started();
+    reassembly_bytes_ += sample_size;
+    return true;
+}
+
+void StatefulReader::release_reassembly_nts(
+        WriterProxy* wp,
+        uint32_t sample_size)
+{
+    if (nullptr == reassembly_budget_)
+    {
+        return;
+    }
+
+    uint64_t bytes = std::min<uint64_t>(sample_size, reassembly_bytes_);
+    reassembly_budget_->release(bytes);
+    reassembly_bytes_ -= bytes;
+    if (nullptr != wp)
+    {
+        wp->fragmented_change_finished();
+    }
+}
+
 ResourceEvent& StatefulReader::getEventResource() const
 {
     return mp_RTPSParticipant->getEventResource();
@@ -1316,7 +1392,7 @@ bool StatefulReader::nextUntakenCache(
 
     bool takeok = false;
     WriterProxy* wp;
-    std::vector<CacheChange_t*>::iterator it = mp_history->changesBegin();
+    ReaderHistory::iterator it = mp_history->changesBegin();
     while (it != mp_history->changesEnd())
     {
         if (this->matched_writer_lookup((*it)->writerGUID, &wp))
@@ -1370,7 +1446,7 @@ bool StatefulReader::nextUnreadCache(
     std::vector<CacheChange_t*> toremove;
     bool readok = false;
     WriterProxy* wp = nullptr;
-    std::vector<CacheChange_t*>::iterator it = mp_history->changesBegin();
+    ReaderHistory::iterator it = mp_history->changesBegin();
     while (it != mp_history->changesEnd())
     {
         if ((*it)->isRead)
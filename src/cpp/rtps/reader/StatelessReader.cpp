@@ -36,6 +36,7 @@
 #include <rtps/DataSharing/DataSharingListener.hpp>
 #include <rtps/DataSharing/ReaderPool.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
+#include <rtps/reader/FragmentReassemblyBudget.hpp>
 
 #define IDSTRING "(ID:" << std::this_thread::get_id() << ") " <<
 
@@ -51,6 +52,11 @@ StatelessReader::~StatelessReader()
     {
         datasharing_listener_->stop();
     }
+
+    for (RemoteWriterInfo_t& writer : matched_writers_)
+    {
+        release_reassembly_nts(writer);
+    }
 }
 
 StatelessReader::StatelessReader(
@@ -61,6 +67,7 @@ StatelessReader::StatelessReader(
         ReaderListener* listen)
     : RTPSReader(pimpl, guid, att, hist, listen)
     , matched_writers_(att.matched_writers_allocation)
+    , reassembly_budget_(guid.is_builtin() ? nullptr : pimpl->fragment_reassembly_budget())
 {
 }
 
@@ -73,6 +80,7 @@ StatelessReader::StatelessReader(
         ReaderListener* listen)
     : RTPSReader(pimpl, guid, att, payload_pool, hist, listen)
     , matched_writers_(att.matched_writers_allocation)
+    , reassembly_budget_(guid.is_builtin() ? nullptr : pimpl->fragment_reassembly_budget())
 {
 }
 
@@ -86,6 +94,7 @@ StatelessReader::StatelessReader(
         ReaderListener* listen)
     : RTPSReader(pimpl, guid, att, payload_pool, change_pool, hist, listen)
     , matched_writers_(att.matched_writers_allocation)
+    , reassembly_budget_(guid.is_builtin() ? nullptr : pimpl->fragment_reassembly_budget())
 {
 }
 
@@ -173,6 +182,11 @@ bool StatelessReader::matched_writer_add(
         }
         EPROSIMA_LOG_INFO(RTPS_READER, "Writer " << wdata.guid() << " added to reader " << m_guid);
 
+        if (!m_guid.is_builtin())
+        {
+            mp_RTPSParticipant->matched_readers_index().add(wdata.guid(), m_guid.entityId, this);
+        }
+
         add_persistence_guid(info.guid, info.persistence_guid);
 
         m_acceptMessagesFromUnkownWriters = false;
@@ -271,7 +285,12 @@ bool StatelessReader::matched_writer_remove(
                 }
 
                 remove_persistence_guid(it->guid, it->persistence_guid, removed_by_lease);
+                release_reassembly_nts(*it);
                 matched_writers_.erase(it);
+                if (!m_guid.is_builtin())
+                {
+                    mp_RTPSParticipant->matched_readers_index().remove(writer_guid, this);
+                }
                 if (nullptr != mp_listener)
                 {
                     // call the listener without lock
@@ -403,7 +422,7 @@ void StatelessReader::remove_changes_from(
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
     std::vector<CacheChange_t*> toremove;
-    for (std::vector<CacheChange_t*>::iterator it = mp_history->changesBegin();
+    for (ReaderHistory::iterator it = mp_history->changesBegin();
             it != mp_history->changesEnd(); ++it)
     {
         if ((*it)->writerGUID == writerGUID)
@@ -426,6 +445,35 @@ void StatelessReader::remove_changes_from(
     }
 }
 
+bool StatelessReader::reserve_reassembly_nts(
+        RemoteWriterInfo_t& writer,
+        uint32_t sample_size)
+{
+    assert(0 == writer.reassembly_bytes);
+
+    if (nullptr != reassembly_budget_)
+    {
+        if (!reassembly_budget_->try_reserve(sample_size))
+        {
+            EPROSIMA_LOG_INFO(RTPS_MSG_IN,
+                    IDSTRING "Reassembly budget exhausted. Dropping fragment from " << writer.guid);
+            return false;
+        }
+        writer.reassembly_bytes = sample_size;
+    }
+    return true;
+}
+
+void StatelessReader::release_reassembly_nts(
+        RemoteWriterInfo_t& writer)
+{
+    if (nullptr != reassembly_budget_ && 0 != writer.reassembly_bytes)
+    {
+        reassembly_budget_->release(writer.reassembly_bytes);
+        writer.reassembly_bytes = 0;
+    }
+}
+
 bool StatelessReader::nextUntakenCache(
         CacheChange_t** change,
         WriterProxy** /*wpout*/)
@@ -440,7 +488,7 @@ bool StatelessReader::nextUnreadCache(
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
     bool found = false;
-    std::vector<CacheChange_t*>::iterator it = mp_history->changesBegin();
+    ReaderHistory::iterator it = mp_history->changesBegin();
     while (it != mp_history->changesEnd())
     {
         if ((*it)->isRead)
@@ -743,7 +791,9 @@ bool StatelessReader::processDataFragMsg(
                         }
 
                         // Pending change should be dropped. Check if it can be reused
-                        if (sampleSize <= work_change->serializedPayload.max_size)
+                        release_reassembly_nts(writer);
+                        if (sampleSize <= work_change->serializedPayload.max_size &&
+                                reserve_reassembly_nts(writer, sampleSize))
                         {
                             // Sample fits inside pending change. Reuse it.
                             work_change->copy_not_memcpy(change_to_add);
@@ -761,7 +811,7 @@ bool StatelessReader::processDataFragMsg(
                 }
 
                 // Check if a new change should be reserved
-                if (work_change == nullptr)
+                if (work_change == nullptr && reserve_reassembly_nts(writer, sampleSize))
                 {
                     if (reserveCache(&work_change, sampleSize))
                     {
@@ -778,6 +828,11 @@ bool StatelessReader::processDataFragMsg(
                             work_change->setFragmentSize(change_to_add->getFragmentSize(), true);
                         }
                     }
+
+                    if (work_change == nullptr)
+                    {
+                        release_reassembly_nts(writer);
+                    }
                 }
 
                 // Process fragment and set change_completed if it is fully reassembled
@@ -795,6 +850,7 @@ bool StatelessReader::processDataFragMsg(
                     {
                         change_completed = work_change;
                         work_change = nullptr;
+                        release_reassembly_nts(writer);
                     }
                 }
 
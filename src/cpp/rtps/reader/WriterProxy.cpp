@@ -149,6 +149,7 @@ void WriterProxy::start(
     initial_acknack_->restart_timer();
     loaded_from_storage(initial_sequence);
     received_at_least_one_heartbeat_ = false;
+    fragmented_changes_in_flight_ = 0;
 }
 
 void WriterProxy::update(
@@ -331,6 +331,27 @@ public:
         return is_datasharing_writer_;
     }
 
+    //! Number of fragmented changes from this writer currently being reassembled.
+    uint32_t fragmented_changes_in_flight() const
+    {
+        return fragmented_changes_in_flight_;
+    }
+
+    //! Called when the reassembly of a fragmented change from this writer starts.
+    void fragmented_change_started()
+    {
+        ++fragmented_changes_in_flight_;
+    }
+
+    //! Called when a fragmented change from this writer is completed or discarded.
+    void fragmented_change_finished()
+    {
+        if (0 < fragmented_changes_in_flight_)
+        {
+            --fragmented_changes_in_flight_;
+        }
+    }
+
     /*
      * Do nothing.
      * This object always is protected by reader's mutex.
@@ -415,6 +436,8 @@ private:
     bool is_datasharing_writer_;
     //! Wether at least one heartbeat was recevied.
     bool received_at_least_one_heartbeat_;
+    //! Number of fragmented changes being reassembled.
+    uint32_t fragmented_changes_in_flight_ = 0;
     //! Current state of this Writer Proxy
     std::atomic<StateCode> state_;
 
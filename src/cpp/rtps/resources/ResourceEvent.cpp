@@ -16,6 +16,7 @@
  * @file ResourceEvent.cpp
  */
 
+#include <algorithm>
 #include <cassert>
 
 #include <fastdds/rtps/resources/ResourceEvent.h>
@@ -29,22 +30,47 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
-static bool event_compare(
-        TimedEventImpl* lhs,
-        TimedEventImpl* rhs)
+//! Resolution of the timing wheel.
+static constexpr std::chrono::nanoseconds timer_wheel_resolution = std::chrono::milliseconds(1);
+
+//! Number of slots of the timing wheel. Should be a power of two.
+static constexpr uint64_t timer_wheel_size = 1024;
+
+//! Returns the last tick of the timing wheel before a time point.
+static uint64_t tick_before(
+        const std::chrono::steady_clock::time_point& time)
+{
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch());
+    return static_cast<uint64_t>(ns.count() / timer_wheel_resolution.count());
+}
+
+//! Returns the first tick of the timing wheel after a time point.
+static uint64_t tick_after(
+        const std::chrono::steady_clock::time_point& time)
 {
-    return lhs->next_trigger_time() < rhs->next_trigger_time();
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch());
+    return static_cast<uint64_t>((ns.count() + timer_wheel_resolution.count() - 1) / timer_wheel_resolution.count());
+}
+
+//! Returns the time point of a tick of the timing wheel.
+static std::chrono::steady_clock::time_point tick_time(
+        uint64_t tick)
+{
+    auto ns = std::chrono::nanoseconds(static_cast<int64_t>(tick) * timer_wheel_resolution.count());
+    return std::chrono::steady_clock::time_point(
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(ns));
 }
 
 ResourceEvent::ResourceEvent()
-    : thread_(new eprosima::thread())
+    : timer_wheel_(timer_wheel_size, nullptr)
+    , thread_(new eprosima::thread())
 {
 }
 
 ResourceEvent::~ResourceEvent()
 {
     // All timer should be unregistered before destroying this object.
-    assert(pending_timers_.empty());
+    assert(nullptr == pending_timers_.load());
     assert(timers_count_ == 0);
 
     stop_thread();
@@ -93,32 +119,34 @@ void ResourceEvent::unregister_timer(
     }
 
     bool should_notify = false;
-    std::vector<TimedEventImpl*>::iterator it;
 
-    // Remove from pending
-    it = std::find(pending_timers_.begin(), pending_timers_.end(), event);
-    if (it != pending_timers_.end())
+    // Remove from pending, putting back the rest of events
+    if (event->is_pending_.load())
     {
-        pending_timers_.erase(it);
+        TimedEventImpl* pending = pending_timers_.exchange(nullptr);
+        while (nullptr != pending)
+        {
+            TimedEventImpl* next = pending->next_pending_;
+            pending->is_pending_.store(false);
+            if (pending != event)
+            {
+                push_pending_timer(pending);
+            }
+            pending = next;
+        }
         should_notify = true;
     }
 
-    // Remove from active
-    it = std::find(active_timers_.begin(), active_timers_.end(), event);
-    if (it != active_timers_.end())
+    // Remove from the timing wheel
+    if (event->is_on_wheel_)
     {
-        active_timers_.erase(it);
-
-        if (is_service_thread)
-        {
-            //! Warn the do_timer_actions loop to skip checking the rest of active_timers
-            //! in this iteration to prevent iterator invalidation
-            skip_checking_active_timers_.store(true);
-        }
-
+        unschedule_timer(event);
         should_notify = true;
     }
 
+    //! Warn the do_timer_actions loop not to trigger the event if it was going to
+    std::replace(due_timers_.begin(), due_timers_.end(), event, static_cast<TimedEventImpl*>(nullptr));
+
     // Decrement counter of created timers
     --timers_count_;
 
@@ -132,11 +160,11 @@ void ResourceEvent::unregister_timer(
 void ResourceEvent::notify(
         TimedEventImpl* event)
 {
-    std::lock_guard<TimedMutex> lock(mutex_);
-
-    if (register_timer_nts(event))
+    if (push_pending_timer(event))
     {
-        // Notify the execution thread that something changed
+        // Notify the execution thread that something changed.
+        // Taking the mutex ensures the notification is not lost if the thread is about to wait.
+        std::lock_guard<TimedMutex> lock(mutex_);
         cv_.notify_one();
     }
 }
@@ -145,15 +173,15 @@ void ResourceEvent::notify(
         TimedEventImpl* event,
         const std::chrono::steady_clock::time_point& timeout)
 {
+    if (push_pending_timer(event))
+    {
 #if HAVE_STRICT_REALTIME
-    std::unique_lock<TimedMutex> lock(mutex_, std::defer_lock);
-    if (lock.try_lock_until(timeout))
+        std::unique_lock<TimedMutex> lock(mutex_, std::defer_lock);
+        if (lock.try_lock_until(timeout))
 #else
-    static_cast<void>(timeout);
-    std::lock_guard<TimedMutex> _(mutex_);
+        static_cast<void>(timeout);
+        std::lock_guard<TimedMutex> _(mutex_);
 #endif  // HAVE_STRICT_REALTIME
-    {
-        if (register_timer_nts(event))
         {
             // Notify the execution thread that something changed
             cv_.notify_one();
@@ -161,16 +189,65 @@ void ResourceEvent::notify(
     }
 }
 
-bool ResourceEvent::register_timer_nts(
+bool ResourceEvent::push_pending_timer(
+        TimedEventImpl* event)
+{
+    if (event->is_pending_.exchange(true))
+    {
+        return false;
+    }
+
+    TimedEventImpl* head = pending_timers_.load();
+    do
+    {
+        event->next_pending_ = head;
+    } while (!pending_timers_.compare_exchange_weak(head, event));
+
+    return nullptr == head;
+}
+
+void ResourceEvent::schedule_timer(
+        TimedEventImpl* event)
+{
+    assert(!event->is_on_wheel_);
+
+    // Events are never scheduled on ticks already processed
+    uint64_t tick = (std::max)(tick_after(event->next_trigger_time()), last_tick_ + 1);
+    TimedEventImpl*& slot = timer_wheel_[tick & (timer_wheel_size - 1)];
+
+    event->wheel_tick_ = tick;
+    event->wheel_prev_ = nullptr;
+    event->wheel_next_ = slot;
+    if (nullptr != slot)
+    {
+        slot->wheel_prev_ = event;
+    }
+    slot = event;
+    event->is_on_wheel_ = true;
+}
+
+void ResourceEvent::unschedule_timer(
         TimedEventImpl* event)
 {
-    if (std::find(pending_timers_.begin(), pending_timers_.end(), event) == pending_timers_.end())
+    assert(event->is_on_wheel_);
+
+    if (nullptr != event->wheel_prev_)
+    {
+        event->wheel_prev_->wheel_next_ = event->wheel_next_;
+    }
+    else
+    {
+        timer_wheel_[event->wheel_tick_ & (timer_wheel_size - 1)] = event->wheel_next_;
+    }
+
+    if (nullptr != event->wheel_next_)
     {
-        pending_timers_.push_back(event);
-        return true;
+        event->wheel_next_->wheel_prev_ = event->wheel_prev_;
     }
 
-    return false;
+    event->wheel_prev_ = nullptr;
+    event->wheel_next_ = nullptr;
+    event->is_on_wheel_ = false;
 }
 
 void ResourceEvent::event_service()
@@ -190,7 +267,7 @@ void ResourceEvent::event_service()
         }
 
         // If pending timers exist, there is some work to be done, so no need to wait.
-        if (!pending_timers_.empty())
+        if (nullptr != pending_timers_.load())
         {
             continue;
         }
@@ -200,10 +277,7 @@ void ResourceEvent::event_service()
         cv_manipulation_.notify_all();
 
         // Wait for the first timer to be triggered
-        std::chrono::steady_clock::time_point next_trigger =
-                active_timers_.empty() ?
-                current_time_ + std::chrono::seconds(1) :
-                active_timers_[0]->next_trigger_time();
+        std::chrono::steady_clock::time_point next_trigger = next_wheel_time();
 
         auto current_time = std::chrono::steady_clock::now();
         if (current_time > next_trigger)
@@ -226,9 +300,17 @@ void ResourceEvent::event_service()
     cv_manipulation_.notify_all();
 }
 
-void ResourceEvent::sort_timers()
+std::chrono::steady_clock::time_point ResourceEvent::next_wheel_time() const
 {
-    std::sort(active_timers_.begin(), active_timers_.end(), event_compare);
+    for (uint64_t tick = last_tick_ + 1; tick <= last_tick_ + timer_wheel_size; ++tick)
+    {
+        if (nullptr != timer_wheel_[tick & (timer_wheel_size - 1)])
+        {
+            return tick_time(tick);
+        }
+    }
+
+    return current_time_ + std::chrono::seconds(1);
 }
 
 void ResourceEvent::update_current_time()
@@ -241,72 +323,75 @@ void ResourceEvent::do_timer_actions()
     std::chrono::steady_clock::time_point cancel_time =
             current_time_ + std::chrono::hours(24);
 
-    bool did_something = false;
-
     // Process pending orders
+    TimedEventImpl* pending = pending_timers_.exchange(nullptr);
+    while (nullptr != pending)
     {
-        std::lock_guard<TimedMutex> lock(mutex_);
-        for (TimedEventImpl* tp : pending_timers_)
+        TimedEventImpl* tp = pending;
+        pending = tp->next_pending_;
+        tp->is_pending_.store(false);
+
+        // Remove item from the timing wheel
+        if (tp->is_on_wheel_)
         {
-            // Remove item from active timers
-            auto current_pos = std::lower_bound(active_timers_.begin(), active_timers_.end(), tp, event_compare);
-            current_pos = std::find(current_pos, active_timers_.end(), tp);
-            if (current_pos != active_timers_.end())
+            unschedule_timer(tp);
+        }
+
+        // Update timer info
+        if (tp->update(current_time_, cancel_time))
+        {
+            // Timer has to be activated
+            if (tp->next_trigger_time() <= current_time_)
             {
-                active_timers_.erase(current_pos);
+                due_timers_.push_back(tp);
             }
-
-            // Update timer info
-            if (tp->update(current_time_, cancel_time))
+            else
             {
-                // Timer has to be activated: add to active timers
-                std::vector<TimedEventImpl*>::iterator low_bound;
-
-                // Insert on correct position
-                low_bound = std::lower_bound(active_timers_.begin(), active_timers_.end(), tp, event_compare);
-                active_timers_.emplace(low_bound, tp);
+                schedule_timer(tp);
             }
         }
-        pending_timers_.clear();
     }
 
-    // Trigger active timers
-    skip_checking_active_timers_.store(false);
-    for (TimedEventImpl* tp : active_timers_)
+    // Collect the timers on the slots of the ticks elapsed since last time.
+    // Slots may also hold timers for the next turns of the wheel, which are kept.
+    uint64_t current_tick = tick_before(current_time_);
+    uint64_t elapsed_ticks = (std::min)(current_tick - last_tick_, timer_wheel_size);
+    for (uint64_t tick = current_tick - elapsed_ticks + 1; tick <= current_tick; ++tick)
     {
-        if (tp->next_trigger_time() <= current_time_)
+        TimedEventImpl* tp = timer_wheel_[tick & (timer_wheel_size - 1)];
+        while (nullptr != tp)
         {
-            did_something = true;
-            tp->trigger(current_time_, cancel_time);
-
-            //! skip this iteration as active_timers has been manipulated
-            if (skip_checking_active_timers_.load())
+            TimedEventImpl* next = tp->wheel_next_;
+            if (tp->wheel_tick_ <= current_tick)
             {
-                break;
+                unschedule_timer(tp);
+                due_timers_.push_back(tp);
             }
-        }
-        else
-        {
-            break;
+            tp = next;
         }
     }
+    last_tick_ = current_tick;
 
-    // If an action was made, keep active_timers_ sorted
-    if (did_something)
+    // Trigger due timers
+    for (size_t i = 0; i < due_timers_.size(); ++i)
     {
-        sort_timers();
-        active_timers_.erase(
-            std::lower_bound(active_timers_.begin(), active_timers_.end(), nullptr,
-            [cancel_time](
-                TimedEventImpl* a,
-                TimedEventImpl* b)
-            {
-                (void)b;
-                return a->next_trigger_time() < cancel_time;
-            }),
-            active_timers_.end()
-            );
+        TimedEventImpl* tp = due_timers_[i];
+
+        //! skip timers unregistered by the callback of a previous one
+        if (nullptr == tp)
+        {
+            continue;
+        }
+
+        tp->trigger(current_time_, cancel_time);
+
+        // Timer restarted by its callback, unless it was unregistered by it
+        if (nullptr != due_timers_[i] && tp->next_trigger_time() < cancel_time)
+        {
+            schedule_timer(tp);
+        }
     }
+    due_timers_.clear();
 }
 
 void ResourceEvent::init_thread(
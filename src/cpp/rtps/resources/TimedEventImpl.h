@@ -41,6 +41,8 @@ class TimedEventImpl
 {
     using Callback = std::function<bool ()>;
 
+    friend class ResourceEvent;
+
 public:
 
     enum StateCode
@@ -156,6 +158,24 @@ private:
 
     //! Current state of this event
     std::atomic<StateCode> state_;
+
+    //! Whether this event is on the queue of events pending update action of ResourceEvent
+    std::atomic<bool> is_pending_{false};
+
+    //! Next event on the queue of events pending update action of ResourceEvent
+    TimedEventImpl* next_pending_ = nullptr;
+
+    //! Previous event on the slot of the timing wheel of ResourceEvent
+    TimedEventImpl* wheel_prev_ = nullptr;
+
+    //! Next event on the slot of the timing wheel of ResourceEvent
+    TimedEventImpl* wheel_next_ = nullptr;
+
+    //! Tick of the timing wheel when this event should be triggered
+    uint64_t wheel_tick_ = 0;
+
+    //! Whether this event is on the timing wheel of ResourceEvent
+    bool is_on_wheel_ = false;
 };
 
 } // namespace rtps
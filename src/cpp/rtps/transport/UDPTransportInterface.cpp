@@ -20,6 +20,11 @@
 #include <limits>
 #include <utility>
 
+#if defined(__linux__)
+#include <linux/filter.h>
+#include <sys/socket.h>
+#endif // if defined(__linux__)
+
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/transport/TransportInterface.h>
 #include <fastdds/rtps/messages/CDRMessage.h>
@@ -56,6 +61,7 @@ bool UDPTransportDescriptor::operator ==(
 {
     return (this->m_output_udp_socket == t.m_output_udp_socket &&
            this->non_blocking_send == t.non_blocking_send &&
+           this->input_sockets_per_locator == t.input_sockets_per_locator &&
            SocketTransportDescriptor::operator ==(t));
 }
 
@@ -219,14 +225,36 @@ bool UDPTransportInterface::OpenAndBindInputSockets(
 {
     std::unique_lock<std::recursive_mutex> scopedLock(mInputMapMutex);
 
+    uint32_t sockets_per_interface = 1;
+#if defined(__linux__)
+    if (!is_multicast)
+    {
+        sockets_per_interface = (std::max)(configuration()->input_sockets_per_locator, 1u);
+    }
+#endif // if defined(__linux__)
+    bool reuse_port = sockets_per_interface > 1;
+
     try
     {
         std::vector<std::string> vInterfaces = get_binding_interfaces_list();
         for (std::string sInterface : vInterfaces)
         {
-            UDPChannelResource* p_channel_resource;
-            p_channel_resource = CreateInputChannelResource(sInterface, locator, is_multicast, maxMsgSize, receiver);
-            mInputSockets[IPLocator::getPhysicalPort(locator)].push_back(p_channel_resource);
+            // The first socket of the group is bound without SO_REUSEPORT, so its bind fails when the port is in use
+            // by any other socket, even one with SO_REUSEPORT of another participant. The option is enabled on it
+            // afterwards for the rest of the group to join, so the port is never left unbound in between.
+            for (uint32_t i = 0; i < sockets_per_interface; ++i)
+            {
+                bool first = 0 == i;
+                UDPChannelResource* p_channel_resource;
+                p_channel_resource = CreateInputChannelResource(sInterface, locator, is_multicast,
+                                reuse_port && !first, maxMsgSize, receiver);
+                mInputSockets[IPLocator::getPhysicalPort(locator)].push_back(p_channel_resource);
+
+                if (reuse_port && first)
+                {
+                    create_reuseport_group(p_channel_resource, sockets_per_interface);
+                }
+            }
         }
     }
     catch (asio::system_error const& e)
@@ -245,16 +273,59 @@ UDPChannelResource* UDPTransportInterface::CreateInputChannelResource(
         const std::string& sInterface,
         const Locator& locator,
         bool is_multicast,
+        bool reuse_port,
         uint32_t maxMsgSize,
         TransportReceiverInterface* receiver)
 {
     eProsimaUDPSocket unicastSocket = OpenAndBindInputSocket(sInterface,
-                    IPLocator::getPhysicalPort(locator), is_multicast);
+                    IPLocator::getPhysicalPort(locator), is_multicast, reuse_port);
     UDPChannelResource* p_channel_resource = new UDPChannelResource(this, unicastSocket, maxMsgSize, locator,
                     sInterface, receiver, configuration()->get_thread_config_for_port(locator.port));
     return p_channel_resource;
 }
 
+void UDPTransportInterface::create_reuseport_group(
+        UDPChannelResource* channel_resource,
+        uint32_t num_sockets)
+{
+#if defined(__linux__)
+    // Throws when the option cannot be set, so the locator is not opened with a single socket
+    channel_resource->socket()->set_option(asio::detail::socket_option::boolean<
+                ASIO_OS_DEF(SOL_SOCKET), SO_REUSEPORT>(true));
+#endif // if defined(__linux__)
+
+#if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+    // The program is run with the UDP payload at offset 0. It selects the socket with a hash of the GUID prefix on
+    // the RTPS header, which starts at offset 8. Datagrams too short to be RTPS messages are steered to socket 0.
+    struct sock_filter code[] = {
+        BPF_STMT(BPF_LD | BPF_W | BPF_ABS, 8),
+        BPF_STMT(BPF_MISC | BPF_TAX, 0),
+        BPF_STMT(BPF_LD | BPF_W | BPF_ABS, 12),
+        BPF_STMT(BPF_ALU | BPF_XOR | BPF_X, 0),
+        BPF_STMT(BPF_MISC | BPF_TAX, 0),
+        BPF_STMT(BPF_LD | BPF_W | BPF_ABS, 16),
+        BPF_STMT(BPF_ALU | BPF_XOR | BPF_X, 0),
+        BPF_STMT(BPF_ALU | BPF_MOD | BPF_K, num_sockets),
+        BPF_STMT(BPF_RET | BPF_A, 0)
+    };
+    struct sock_fprog program;
+    program.len = static_cast<unsigned short>(sizeof(code) / sizeof(code[0]));
+    program.filter = code;
+
+    if (0 != setsockopt(channel_resource->socket()->native_handle(), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF,
+            &program, sizeof(program)))
+    {
+        // Without the program the kernel distributes the datagrams by source address and port, which also keeps
+        // the order of the messages sent by each remote socket.
+        EPROSIMA_LOG_WARNING(TRANSPORT_UDP, "Couldn't attach the SO_REUSEPORT steering program on interface "
+                << channel_resource->iface());
+    }
+#else
+    static_cast<void>(channel_resource);
+    static_cast<void>(num_sockets);
+#endif // if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+}
+
 eProsimaUDPSocket UDPTransportInterface::OpenAndBindUnicastOutputSocket(
         const ip::udp::endpoint& endpoint,
         uint16_t& port)
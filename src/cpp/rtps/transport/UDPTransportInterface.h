@@ -270,12 +270,25 @@ protected:
             const std::string& sInterface,
             const Locator& locator,
             bool is_multicast,
+            bool reuse_port,
             uint32_t maxMsgSize,
             TransportReceiverInterface* receiver);
     virtual eProsimaUDPSocket OpenAndBindInputSocket(
             const std::string& sIp,
             uint16_t port,
-            bool is_multicast) = 0;
+            bool is_multicast,
+            bool reuse_port) = 0;
+
+    /**
+     * Make an exclusively bound socket the first one of a group sharing its port with SO_REUSEPORT, and steer the
+     * datagrams received on the group, so all the datagrams coming from the same participant are received on the
+     * same socket.
+     * @param channel_resource Channel resource of the first socket of the group.
+     * @param num_sockets Number of sockets on the group.
+     */
+    void create_reuseport_group(
+            UDPChannelResource* channel_resource,
+            uint32_t num_sockets);
     eProsimaUDPSocket OpenAndBindUnicastOutputSocket(
             const asio::ip::udp::endpoint& endpoint,
             uint16_t& port);
@@ -9,7 +9,7 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
-using LivelinessDataIterator = ResourceLimitedVector<LivelinessData>::iterator;
+constexpr size_t LivelinessManager::no_position;
 
 LivelinessManager::LivelinessManager(
         const LivelinessCallback& callback,
@@ -18,9 +18,13 @@ LivelinessManager::LivelinessManager(
     : callback_(callback)
     , manage_automatic_(manage_automatic)
     , writers_()
+    , writer_positions_()
+    , kind_positions_()
+    , alive_writers_()
     , mutex_()
     , col_mutex_()
-    , timer_owner_(nullptr)
+    , timer_owner_(no_position)
+    , timer_time_()
     , timer_(
         service,
         [this]() -> bool
@@ -34,7 +38,7 @@ LivelinessManager::LivelinessManager(
 LivelinessManager::~LivelinessManager()
 {
     std::lock_guard<std::mutex> _(mutex_);
-    timer_owner_ = nullptr;
+    timer_owner_ = no_position;
     timer_.cancel_timer();
 }
 
@@ -49,43 +53,29 @@ bool LivelinessManager::add_writer(
         return false;
     }
 
-    {
-        // collection guard
-        std::lock_guard<shared_mutex> _(col_mutex_);
-        // writers_ elements guard
-        std::lock_guard<std::mutex> __(mutex_);
-
-        for (LivelinessData& writer : writers_)
-        {
-            if (writer.guid == guid &&
-                    writer.kind == kind &&
-                    writer.lease_duration == lease_duration)
-            {
-                writer.count++;
-                return true;
-            }
-        }
-        writers_.emplace_back(guid, kind, lease_duration);
-    }
+    // collection guard
+    std::lock_guard<shared_mutex> _(col_mutex_);
+    // writers_ elements guard
+    std::lock_guard<std::mutex> __(mutex_);
 
-    if (!calculate_next())
+    size_t position = find_writer_nts(guid, kind, lease_duration);
+    if (no_position != position)
     {
-        // TimedEvent is thread safe
-        timer_.cancel_timer();
+        writers_[position].count++;
         return true;
     }
 
-    std::lock_guard<std::mutex> _(mutex_);
-
-    if (timer_owner_ != nullptr)
+    if (nullptr == writers_.emplace_back(guid, kind, lease_duration))
     {
-        // Some times the interval could be negative if a writer expired during the call to this function
-        // Once in this situation there is not much we can do but let asio timers expire immediately
-        auto interval = timer_owner_->time - steady_clock::now();
-        timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-        timer_.restart_timer();
+        EPROSIMA_LOG_WARNING(RTPS_WRITER, "Maximum number of writers reached, writer not added");
+        return false;
     }
 
+    // The new writer has not asserted its liveliness yet, so the timer is not affected
+    position = writers_.size() - 1;
+    writer_positions_.emplace(guid, position);
+    kind_positions_[kind].push_back(position);
+
     return true;
 }
 
@@ -95,50 +85,37 @@ bool LivelinessManager::remove_writer(
         Duration_t lease_duration,
         LivelinessData::WriterStatus& writer_status)
 {
-    bool removed = false;
+    // collection guard
+    std::lock_guard<shared_mutex> _(col_mutex_);
+    // writers_ elements guard
+    std::lock_guard<std::mutex> __(mutex_);
 
+    size_t position = find_writer_nts(guid, kind, lease_duration);
+    if (no_position == position)
     {
-        // collection guard
-        std::lock_guard<shared_mutex> _(col_mutex_);
-        // writers_ elements guard
-        std::lock_guard<std::mutex> __(mutex_);
-
-        removed = writers_.remove_if([guid, kind, lease_duration, &writer_status](LivelinessData& writer)
-                        {
-                            writer_status = writer.status;
-                            return writer.guid == guid &&
-                            writer.kind == kind &&
-                            writer.lease_duration == lease_duration &&
-                            --writer.count == 0;
-                        });
+        return false;
     }
 
-    if (!removed)
+    LivelinessData& writer = writers_[position];
+    writer_status = writer.status;
+    if (--writer.count > 0)
     {
         return false;
     }
 
-    std::unique_lock<std::mutex> lock(mutex_);
+    bool was_timer_owner = timer_owner_ == position;
+    remove_writer_nts(position);
 
-    if (timer_owner_ != nullptr)
+    if (was_timer_owner)
     {
-        lock.unlock();
-
-        if (!calculate_next())
+        if (calculate_next_nts())
         {
-            timer_.cancel_timer();
-            return true;
+            schedule_timer_nts();
         }
-
-        lock.lock();
-
-        if (timer_owner_ != nullptr)
+        else
         {
-            // Some times the interval could be negative if a writer expired during the call to this function
-            // Once in this situation there is not much we can do but let asio timers expire inmediately
-            auto interval = timer_owner_->time - steady_clock::now();
-            timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-            timer_.restart_timer();
+            // TimedEvent is thread safe
+            timer_.cancel_timer();
         }
     }
 
@@ -150,71 +127,36 @@ bool LivelinessManager::assert_liveliness(
         LivelinessQosPolicyKind kind,
         Duration_t lease_duration)
 {
-    bool found = false;
+    // collection guard
+    shared_lock<shared_mutex> _(col_mutex_);
 
+    size_t position = no_position;
     {
-        // collection guard
-        shared_lock<shared_mutex> _(col_mutex_);
-
-        for (LivelinessData& writer : writers_)
-        {
-            // writers_ elements guard
-            std::unique_lock<std::mutex> lock(mutex_);
-
-            if (writer.guid == guid &&
-                    writer.kind == kind &&
-                    writer.lease_duration == lease_duration)
-            {
-                lock.unlock();
-
-                found = true;
-
-                // Execute the callbacks
-                if (writer.kind == LivelinessQosPolicyKind::MANUAL_BY_PARTICIPANT_LIVELINESS_QOS ||
-                        writer.kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
-                {
-                    for (LivelinessData& w: writers_)
-                    {
-                        if (w.kind == writer.kind &&
-                                w.guid.guidPrefix == guid.guidPrefix)
-                        {
-                            assert_writer_liveliness(w);
-                        }
-                    }
-                }
-                else if (writer.kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
-                {
-                    assert_writer_liveliness(writer);
-                }
-
-                break;
-            }
-        }
+        // writers_ elements guard
+        std::lock_guard<std::mutex> lock(mutex_);
+        position = find_writer_nts(guid, kind, lease_duration);
     }
 
-    if (!found)
+    if (no_position == position)
     {
         return false;
     }
 
-    timer_.cancel_timer();
-
-    // Updates the timer owner
-    if (!calculate_next())
+    // Execute the callbacks
+    if (kind == LivelinessQosPolicyKind::MANUAL_BY_PARTICIPANT_LIVELINESS_QOS ||
+            kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
     {
-        EPROSIMA_LOG_ERROR(RTPS_WRITER, "Error when restarting liveliness timer");
-        return false;
+        for (size_t w : kind_positions_[kind])
+        {
+            if (writers_[w].guid.guidPrefix == guid.guidPrefix)
+            {
+                assert_writer_liveliness(w);
+            }
+        }
     }
-
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    if (timer_owner_ != nullptr)
+    else if (kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
     {
-        // Some times the interval could be negative if a writer expired during the call to this function
-        // Once in this situation there is not much we can do but let asio timers expire inmediately
-        auto interval = timer_owner_->time - steady_clock::now();
-        timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-        timer_.restart_timer();
+        assert_writer_liveliness(position);
     }
 
     return true;
@@ -231,30 +173,25 @@ bool LivelinessManager::assert_liveliness(
         return false;
     }
 
-    {
-        // collection guard
-        shared_lock<shared_mutex> _(col_mutex_);
-
-        if (writers_.empty())
-        {
-            return true;
-        }
+    // collection guard
+    shared_lock<shared_mutex> _(col_mutex_);
 
+    if (writers_.empty())
+    {
+        return true;
+    }
 
-        for (LivelinessData& writer: writers_)
+    for (size_t w : kind_positions_[kind])
+    {
+        if (guid_prefix == writers_[w].guid.guidPrefix)
         {
-            if (writer.kind == kind &&
-                    guid_prefix == writer.guid.guidPrefix)
-            {
-                assert_writer_liveliness(writer);
-            }
+            assert_writer_liveliness(w);
         }
     }
 
-    timer_.cancel_timer();
+    std::lock_guard<std::mutex> lock(mutex_);
 
-    // Updates the timer owner
-    if (!calculate_next())
+    if (no_position == timer_owner_)
     {
         EPROSIMA_LOG_INFO(RTPS_WRITER,
                 "Error when restarting liveliness timer: " << writers_.size() << " writers, liveliness " <<
@@ -262,115 +199,187 @@ bool LivelinessManager::assert_liveliness(
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(mutex_);
+    return true;
+}
 
-    if (timer_owner_ != nullptr)
+size_t LivelinessManager::find_writer_nts(
+        const GUID_t& guid,
+        LivelinessQosPolicyKind kind,
+        const Duration_t& lease_duration) const
+{
+    auto range = writer_positions_.equal_range(guid);
+    for (auto it = range.first; it != range.second; ++it)
     {
-        // Some times the interval could be negative if a writer expired during the call to this function
-        // Once in this situation there is not much we can do but let asio timers expire inmediately
-        auto interval = timer_owner_->time - steady_clock::now();
-        timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-        timer_.restart_timer();
+        const LivelinessData& writer = writers_[it->second];
+        if (writer.kind == kind && writer.lease_duration == lease_duration)
+        {
+            return it->second;
+        }
     }
 
-    return true;
+    return no_position;
 }
 
-bool LivelinessManager::calculate_next()
+void LivelinessManager::remove_writer_nts(
+        size_t position)
 {
-    // Keep this lock order to prevent ABBA deadlocks
-    shared_lock<shared_mutex> _(col_mutex_);
-    std::lock_guard<std::mutex> __(mutex_);
+    auto update_kind_position = [](
+        std::vector<size_t>& positions,
+        size_t old_position,
+        size_t new_position)
+            {
+                auto it = std::find(positions.begin(), positions.end(), old_position);
+                if (no_position == new_position)
+                {
+                    *it = positions.back();
+                    positions.pop_back();
+                }
+                else
+                {
+                    *it = new_position;
+                }
+            };
 
-    bool any_alive = false;
-    steady_clock::time_point min_time = steady_clock::now() + nanoseconds(c_TimeInfinite.to_ns());
+    auto update_guid_position = [this](
+        const GUID_t& guid,
+        size_t old_position,
+        size_t new_position)
+            {
+                auto range = writer_positions_.equal_range(guid);
+                for (auto it = range.first; it != range.second; ++it)
+                {
+                    if (it->second == old_position)
+                    {
+                        if (no_position == new_position)
+                        {
+                            writer_positions_.erase(it);
+                        }
+                        else
+                        {
+                            it->second = new_position;
+                        }
+                        break;
+                    }
+                }
+            };
 
-    timer_owner_ = nullptr;
+    LivelinessData& writer = writers_[position];
+    if (LivelinessData::WriterStatus::ALIVE == writer.status)
+    {
+        --alive_writers_[writer.kind];
+    }
+    update_guid_position(writer.guid, position, no_position);
+    update_kind_position(kind_positions_[writer.kind], position, no_position);
 
-    // collection guard
-    for (LivelinessData& writer : writers_)
+    if (timer_owner_ == position)
     {
-        if (writer.status == LivelinessData::WriterStatus::ALIVE)
+        timer_owner_ = no_position;
+    }
+
+    // Move the last writer to the position of the removed one
+    size_t last = writers_.size() - 1;
+    if (position != last)
+    {
+        LivelinessData& moved = writers_[last];
+        update_guid_position(moved.guid, last, position);
+        update_kind_position(kind_positions_[moved.kind], last, position);
+        writer = std::move(moved);
+
+        if (timer_owner_ == last)
         {
-            if (writer.time < min_time)
-            {
-                min_time = writer.time;
-                timer_owner_ = &writer;
-            }
-            any_alive = true;
+            timer_owner_ = position;
+        }
+    }
+
+    writers_.pop_back();
+}
+
+bool LivelinessManager::calculate_next_nts()
+{
+    timer_owner_ = no_position;
+
+    for (size_t i = 0; i < writers_.size(); ++i)
+    {
+        const LivelinessData& writer = writers_[i];
+        if (writer.status == LivelinessData::WriterStatus::ALIVE &&
+                (no_position == timer_owner_ || writer.time < timer_time_))
+        {
+            timer_owner_ = i;
+            timer_time_ = writer.time;
         }
     }
 
-    return any_alive;
+    return no_position != timer_owner_;
+}
+
+void LivelinessManager::schedule_timer_nts()
+{
+    // Some times the interval could be negative if a writer expired during the call to this function
+    // Once in this situation there is not much we can do but let asio timers expire inmediately
+    auto interval = timer_time_ - steady_clock::now();
+    timer_.cancel_timer();
+    timer_.update_interval_millisec(duration<double, std::milli>(interval).count());
+    timer_.restart_timer();
 }
 
 bool LivelinessManager::timer_expired()
 {
     std::unique_lock<std::mutex> lock(mutex_);
 
-    if (timer_owner_ == nullptr)
+    if (no_position == timer_owner_)
     {
         EPROSIMA_LOG_ERROR(RTPS_WRITER, "Liveliness timer expired but there is no writer");
         return false;
     }
-    else
-    {
-        timer_owner_->status = LivelinessData::WriterStatus::NOT_ALIVE;
-    }
 
-    auto guid = timer_owner_->guid;
-    auto kind = timer_owner_->kind;
-    auto lease_duration = timer_owner_->lease_duration;
+    // The timer owner may have asserted its liveliness after the timer was scheduled. In that case the timer is
+    // just moved to the writer which is now next due to lose its liveliness.
+    LivelinessData& owner = writers_[timer_owner_];
+    bool lost = owner.status == LivelinessData::WriterStatus::ALIVE && owner.time <= steady_clock::now();
 
-    lock.unlock();
+    auto guid = owner.guid;
+    auto kind = owner.kind;
+    auto lease_duration = owner.lease_duration;
 
-    if (callback_ != nullptr)
+    if (lost)
     {
-        callback_(guid, kind, lease_duration, -1, 1);
+        owner.status = LivelinessData::WriterStatus::NOT_ALIVE;
+        --alive_writers_[kind];
     }
 
-    if (calculate_next())
+    bool restart = calculate_next_nts();
+    if (restart)
     {
-        lock.lock();
+        // Some times the interval could be negative if a writer expired during the call to this function
+        // Once in this situation there is not much we can do but let asio timers expire inmediately
+        auto interval = timer_time_ - steady_clock::now();
+        timer_.update_interval_millisec(duration<double, std::milli>(interval).count());
+    }
 
-        if ( timer_owner_ != nullptr)
-        {
-            // Some times the interval could be negative if a writer expired during the call to this function
-            // Once in this situation there is not much we can do but let asio timers expire inmediately
-            auto interval = timer_owner_->time - steady_clock::now();
-            timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
+    lock.unlock();
 
-            return true;
-        }
+    if (lost && callback_ != nullptr)
+    {
+        callback_(guid, kind, lease_duration, -1, 1);
     }
 
-    return false;
+    return restart;
 }
 
 bool LivelinessManager::is_any_alive(
         LivelinessQosPolicyKind kind)
 {
-    // Keep this lock order to prevent ABBA deadlocks
-    shared_lock<shared_mutex> _(col_mutex_);
-    std::lock_guard<std::mutex> __(mutex_);
-
-    for (const auto& writer : writers_)
-    {
-        if (writer.kind == kind && writer.status == LivelinessData::WriterStatus::ALIVE)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    std::lock_guard<std::mutex> _(mutex_);
+    return 0 < alive_writers_[kind];
 }
 
 void LivelinessManager::assert_writer_liveliness(
-        LivelinessData& writer)
+        size_t position)
 {
     // The shared_mutex is taken, that is, the writer referenced will not be destroyed during this call
     std::unique_lock<std::mutex> lock(mutex_);
 
+    LivelinessData& writer = writers_[position];
     auto status = writer.status;
     auto guid = writer.guid;
     auto kind = writer.kind;
@@ -379,6 +388,19 @@ void LivelinessManager::assert_writer_liveliness(
     writer.status = LivelinessData::WriterStatus::ALIVE;
     writer.time = steady_clock::now() + nanoseconds(writer.lease_duration.to_ns());
 
+    // Asserting the liveliness of an alive writer only delays its expiration, so the timer is only rescheduled
+    // when a writer becoming alive is due to lose its liveliness before the current timer owner
+    if (status != LivelinessData::WriterStatus::ALIVE)
+    {
+        ++alive_writers_[kind];
+        if (no_position == timer_owner_ || writer.time < timer_time_)
+        {
+            timer_owner_ = position;
+            timer_time_ = writer.time;
+            schedule_timer_nts();
+        }
+    }
+
     lock.unlock();
 
     if (callback_ != nullptr)
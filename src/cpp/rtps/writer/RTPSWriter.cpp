@@ -155,6 +155,8 @@ RTPSWriter::~RTPSWriter()
     // Deletion of the events has to be made in child destructor.
     // Also at this point all CacheChange_t must have been released by the child destructor
 
+    assert(nullptr == sample_batch_group_);
+
     mp_history->mp_writer = nullptr;
     mp_history->mp_mutex = nullptr;
 }
@@ -439,6 +441,56 @@ bool RTPSWriter::is_datasharing_compatible_with(
     return false;
 }
 
+void RTPSWriter::begin_sample_batch_nts(
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    if (nullptr != sample_batch_group_ || !flow_controller_->is_synchronous())
+    {
+        return;
+    }
+
+    // The locator selector is kept locked while the batch is open, as the flow controller does for a single sample.
+    LocatorSelectorSender& locator_selector = get_general_locator_selector();
+#if HAVE_STRICT_REALTIME
+    if (!locator_selector.try_lock_until(max_blocking_time))
+    {
+        return;
+    }
+#else
+    locator_selector.lock();
+#endif // if HAVE_STRICT_REALTIME
+
+    try
+    {
+        sample_batch_group_ = new RTPSMessageGroup(mp_RTPSParticipant, this, &locator_selector, max_blocking_time);
+    }
+    catch (RTPSMessageGroup::timeout&)
+    {
+        locator_selector.unlock();
+    }
+}
+
+void RTPSWriter::end_sample_batch_nts()
+{
+    if (nullptr == sample_batch_group_)
+    {
+        return;
+    }
+
+    // Destroying the group sends the pending submessages, which may throw.
+    RTPSMessageGroup* group = sample_batch_group_;
+    sample_batch_group_ = nullptr;
+    try
+    {
+        delete group;
+    }
+    catch (RTPSMessageGroup::timeout&)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_WRITER, "Max blocking time reached sending a batch of samples");
+    }
+    get_general_locator_selector().unlock();
+}
+
 bool RTPSWriter::is_pool_initialized() const
 {
     if (is_datasharing_compatible())
@@ -616,7 +616,8 @@ bool ReaderProxy::has_unacknowledged(
 
 bool ReaderProxy::requested_fragment_set(
         const SequenceNumber_t& seq_num,
-        const FragmentNumberSet_t& frag_set)
+        const FragmentNumberSet_t& frag_set,
+        uint32_t max_repair_fragments)
 {
     // Locate the outbound change referenced by the NACK_FRAG
     ChangeIterator changeIter = find_change(seq_num, true);
@@ -625,7 +626,13 @@ bool ReaderProxy::requested_fragment_set(
         return false;
     }
 
-    changeIter->markFragmentsAsUnsent(frag_set);
+    // Same as with ACKNACK, requests are suppressed while the fragments just sent may still be in flight.
+    if (changeIter->getStatus() == UNDERWAY)
+    {
+        return false;
+    }
+
+    changeIter->markFragmentsAsUnsent(frag_set, max_repair_fragments);
 
     // If it was UNSENT, we shouldn't switch back to REQUESTED to prevent stalling.
     if (changeIter->getStatus() != UNSENT)
@@ -640,14 +647,15 @@ bool ReaderProxy::process_nack_frag(
         const GUID_t& reader_guid,
         uint32_t nack_count,
         const SequenceNumber_t& seq_num,
-        const FragmentNumberSet_t& fragments_state)
+        const FragmentNumberSet_t& fragments_state,
+        uint32_t max_repair_fragments)
 {
     if (guid() == reader_guid)
     {
         if (last_nackfrag_count_ < nack_count)
         {
             last_nackfrag_count_ = nack_count;
-            if (requested_fragment_set(seq_num, fragments_state))
+            if (requested_fragment_set(seq_num, fragments_state, max_repair_fragments))
             {
                 return true;
             }
@@ -275,6 +275,21 @@ void StatefulWriter::init(
     auto push_mode = PropertyPolicyHelper::find_property(att.endpoint.properties, "fastdds.push_mode");
     m_pushMode = !((nullptr != push_mode) && ("false" == *push_mode));
 
+    // Bound the fragments resent to a reader on each NACK_FRAG, so repairs of large samples are paced by the reader
+    auto max_repair_fragments = PropertyPolicyHelper::find_property(att.endpoint.properties,
+                    "fastdds.nack_frag.max_repair_fragments");
+    if (nullptr != max_repair_fragments)
+    {
+        try
+        {
+            max_repair_fragments_ = static_cast<uint32_t>(std::stoul(*max_repair_fragments));
+        }
+        catch (const std::exception& e)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_WRITER, "Error parsing max_repair_fragments property: " << e.what());
+        }
+    }
+
     periodic_hb_event_ = new TimedEvent(
         pimpl->getEventResource(),
         [&]() -> bool
@@ -1604,6 +1619,9 @@ bool StatefulWriter::try_remove_change(
 {
     EPROSIMA_LOG_INFO(RTPS_WRITER, "Starting process try remove change for writer " << getGuid());
 
+    // Samples of an open batch cannot be acknowledged until they are sent
+    end_sample_batch_nts();
+
     SequenceNumber_t min_low_mark;
 
     {
@@ -1645,6 +1663,9 @@ bool StatefulWriter::wait_for_acknowledgement(
         const std::chrono::steady_clock::time_point& max_blocking_time_point,
         std::unique_lock<RecursiveTimedMutex>& lock)
 {
+    // Samples of an open batch cannot be acknowledged until they are sent
+    end_sample_batch_nts();
+
     return may_remove_change_cond_.wait_until(lock, max_blocking_time_point,
                    [this, &seq]()
                    {
@@ -2067,7 +2088,8 @@ bool StatefulWriter::process_nack_frag(
                 {
                     if (reader->guid() == reader_guid)
                     {
-                        if (reader->process_nack_frag(reader_guid, ack_count, seq_num, fragments_state))
+                        if (reader->process_nack_frag(reader_guid, ack_count, seq_num, fragments_state,
+                                max_repair_fragments_))
                         {
                             nack_response_event_->restart_timer();
                         }
@@ -435,6 +435,9 @@ bool StatelessWriter::wait_for_acknowledgement(
         const std::chrono::steady_clock::time_point& max_blocking_time_point,
         std::unique_lock<RecursiveTimedMutex>& lock)
 {
+    // Samples of an open batch are not sent until it ends
+    end_sample_batch_nts();
+
     uint64_t seq_long_64 = seq.to64long();
     auto change_is_acknowledged = [this, seq, seq_long_64]()
             {
@@ -708,6 +711,42 @@ void StatelessWriter::unsent_changes_reset()
             });
 }
 
+bool StatelessWriter::send_heartbeat()
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+
+    SequenceNumber_t first_seq = get_seq_num_min();
+    SequenceNumber_t last_seq = get_seq_num_max();
+    if (SequenceNumber_t::unknown() == first_seq || SequenceNumber_t::unknown() == last_seq)
+    {
+        return false;
+    }
+
+    try
+    {
+        std::lock_guard<LocatorSelectorSender> selector_guard(locator_selector_);
+
+        locator_selector_.locator_selector.reset(true);
+        if (locator_selector_.locator_selector.state_has_changed())
+        {
+            mp_RTPSParticipant->network_factory().select_locators(locator_selector_.locator_selector);
+            if (!has_builtin_guid())
+            {
+                compute_selected_guids(locator_selector_);
+            }
+        }
+
+        RTPSMessageGroup group(mp_RTPSParticipant, this, &locator_selector_);
+        return group.add_heartbeat(first_seq, last_seq, ++heartbeat_count_, true, false);
+    }
+    catch (const RTPSMessageGroup::timeout&)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_WRITER, "Max blocking time reached");
+    }
+
+    return false;
+}
+
 bool StatelessWriter::send_nts(
         CDRMessage_t* message,
         const LocatorSelectorSender& locator_selector,
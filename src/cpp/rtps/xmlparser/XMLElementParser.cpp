@@ -3650,6 +3650,7 @@ XMLP_ret XMLParser::getXMLHistoryMemoryPolicy(
                 <xs:enumeration value="PREALLOCATED_WITH_REALLOC"/>
                 <xs:enumeration value="DYNAMIC"/>
                 <xs:enumeration value="DYNAMIC_REUSABLE"/>
+                <xs:enumeration value="DYNAMIC_SIZE_CLASS"/>
             </xs:restriction>
         </xs:simpleType>
      */
@@ -3664,7 +3665,8 @@ XMLP_ret XMLParser::getXMLHistoryMemoryPolicy(
             PREALLOCATED, MemoryManagementPolicy::PREALLOCATED_MEMORY_MODE,
             PREALLOCATED_WITH_REALLOC, MemoryManagementPolicy::PREALLOCATED_WITH_REALLOC_MEMORY_MODE,
             DYNAMIC, MemoryManagementPolicy::DYNAMIC_RESERVE_MEMORY_MODE,
-            DYNAMIC_REUSABLE, MemoryManagementPolicy::DYNAMIC_REUSABLE_MEMORY_MODE))
+            DYNAMIC_REUSABLE, MemoryManagementPolicy::DYNAMIC_REUSABLE_MEMORY_MODE,
+            DYNAMIC_SIZE_CLASS, MemoryManagementPolicy::DYNAMIC_SIZE_CLASS_MEMORY_MODE))
     {
         EPROSIMA_LOG_ERROR(XMLPARSER, "Node '" << KIND << "' bad content");
         return XMLP_ret::XML_ERROR;
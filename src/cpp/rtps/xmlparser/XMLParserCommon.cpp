@@ -47,6 +47,7 @@ const char* RECEIVE_BUFFER_SIZE = "receiveBufferSize";
 const char* SEND_BUFFER_SIZE = "sendBufferSize";
 const char* TTL = "TTL";
 const char* NON_BLOCKING_SEND = "non_blocking_send";
+const char* INPUT_SOCKETS_PER_LOCATOR = "input_sockets_per_locator";
 const char* WHITE_LIST = "interfaceWhiteList";
 const char* NETWORK_INTERFACE = "interface";
 const char* NETMASK_FILTER = "netmask_filter";
@@ -180,6 +181,7 @@ const char* PREALLOCATED = "PREALLOCATED";
 const char* PREALLOCATED_WITH_REALLOC = "PREALLOCATED_WITH_REALLOC";
 const char* DYNAMIC = "DYNAMIC";
 const char* DYNAMIC_REUSABLE = "DYNAMIC_REUSABLE";
+const char* DYNAMIC_SIZE_CLASS = "DYNAMIC_SIZE_CLASS";
 const char* LOCATOR = "locator";
 const char* UDPv4_LOCATOR = "udpv4";
 const char* UDPv6_LOCATOR = "udpv6";
@@ -0,0 +1,103 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file hash.hpp
+ */
+
+#ifndef UTILS__HASH_HPP_
+#define UTILS__HASH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/InstanceHandle.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+//! Initial value of a 64-bit FNV-1a hash.
+constexpr uint64_t fnv1a_64_offset_basis = 14695981039346656037ull;
+
+/**
+ * Hash a buffer with the 64-bit FNV-1a algorithm.
+ * Several buffers can be hashed as a single one by passing the result of each call as the initial hash of the next.
+ * @param data Buffer to hash.
+ * @param size Number of bytes of the buffer.
+ * @param hash Initial hash.
+ * @return Hash of the buffer.
+ */
+inline uint64_t fnv1a_64(
+        const void* data,
+        size_t size,
+        uint64_t hash = fnv1a_64_offset_basis)
+{
+    const octet* bytes = static_cast<const octet*>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/**
+ * Hash function for GuidPrefix_t keys on unordered containers.
+ */
+struct GuidPrefixHash
+{
+    std::size_t operator ()(
+            const GuidPrefix_t& prefix) const noexcept
+    {
+        return static_cast<std::size_t>(fnv1a_64(prefix.value, GuidPrefix_t::size));
+    }
+
+};
+
+/**
+ * Hash function for GUID_t keys on unordered containers.
+ * Entities of different participants only differ on the prefix, so the whole GUID is taken into account.
+ */
+struct GuidHash
+{
+    std::size_t operator ()(
+            const GUID_t& guid) const noexcept
+    {
+        uint64_t hash = fnv1a_64(guid.guidPrefix.value, GuidPrefix_t::size);
+        return static_cast<std::size_t>(fnv1a_64(guid.entityId.value, EntityId_t::size, hash));
+    }
+
+};
+
+/**
+ * Hash function for InstanceHandle_t keys on unordered containers.
+ * The whole value is taken into account, as key hashes of short keys only differ on their first bytes.
+ */
+struct InstanceHandleHash
+{
+    std::size_t operator ()(
+            const InstanceHandle_t& handle) const noexcept
+    {
+        return static_cast<std::size_t>(fnv1a_64(handle.value, sizeof(handle.value)));
+    }
+
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // UTILS__HASH_HPP_
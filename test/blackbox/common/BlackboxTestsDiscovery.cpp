@@ -14,7 +14,11 @@
 
 
 #include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #ifndef _WIN32
 #include <stdlib.h>
@@ -606,6 +610,123 @@ TEST(Discovery, ParticipantLivelinessAssertion)
     thread.join();
 }
 
+/*!
+ * @test Checks the participant property fastdds.discovery.delta_announcements.
+ *
+ * The writer participant replaces 3 out of 4 periodic announcements by a HEARTBEAT of its SPDP writer. Its sent
+ * messages are grouped by announcement period, checking that exactly 3 HEARTBEATs are sent between two full DATA(p).
+ * Then every DATA(p) is dropped, and the reader keeps the writer participant alive for longer than its lease duration
+ * thanks to the HEARTBEATs alone.
+ */
+TEST(Discovery, ParticipantDeltaAnnouncements)
+{
+    PubSubReader<HelloWorldPubSubType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldPubSubType> writer(TEST_TOPIC_NAME);
+
+    constexpr uint32_t num_heartbeats = 3;
+    constexpr std::chrono::milliseconds announcement_period(200);
+
+    // Kind of the SPDP submessages sent by the writer participant, with the time they were sent
+    struct SentAnnouncement
+    {
+        bool is_data;
+        std::chrono::steady_clock::time_point time;
+    };
+    std::mutex sent_mutex;
+    std::vector<SentAnnouncement> sent;
+    std::atomic<bool> drop_data_p{false};
+
+    auto test_transport = std::make_shared<test_UDPv4TransportDescriptor>();
+    test_transport->sub_messages_filter_ = [&](CDRMessage_t& msg) -> bool
+            {
+                // The writer id follows the reader id, and the extra flags and octets to inline QoS on DATA
+                octet submessage_id = msg.buffer[msg.pos];
+                uint32_t writer_id_pos = msg.pos + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + 4;
+                if (DATA == submessage_id)
+                {
+                    writer_id_pos += 4;
+                }
+                else if (HEARTBEAT != submessage_id)
+                {
+                    return false;
+                }
+                if (writer_id_pos + 4 > msg.length ||
+                        0 != memcmp(&msg.buffer[writer_id_pos], c_EntityId_SPDPWriter.value, 4))
+                {
+                    return false;
+                }
+
+                bool is_data = DATA == submessage_id;
+                {
+                    std::lock_guard<std::mutex> guard(sent_mutex);
+                    sent.push_back({is_data, std::chrono::steady_clock::now()});
+                }
+                return is_data && drop_data_p;
+            };
+
+    reader.init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    PropertyPolicy property_policy;
+    property_policy.properties().emplace_back("fastdds.discovery.delta_announcements",
+            std::to_string(num_heartbeats));
+    writer.disable_builtin_transport().add_user_transport_to_pparams(test_transport).
+            property_policy(property_policy).
+            lease_duration({ 1, 0 }, { 0, 200000000 }).init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    // Let the initial announcements finish, and record some periods
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    {
+        std::lock_guard<std::mutex> guard(sent_mutex);
+        sent.clear();
+    }
+    std::this_thread::sleep_for(announcement_period * (num_heartbeats + 1) * 4);
+
+    // The messages of an announcement are sent to every locator at once, so they are grouped by period
+    std::vector<bool> periods_with_data;
+    {
+        std::lock_guard<std::mutex> guard(sent_mutex);
+        for (size_t i = 0; i < sent.size(); ++i)
+        {
+            if (0 == i || sent[i].time - sent[i - 1].time > announcement_period / 2)
+            {
+                periods_with_data.push_back(sent[i].is_data);
+            }
+            else if (sent[i].is_data)
+            {
+                periods_with_data.back() = true;
+            }
+        }
+    }
+
+    // A full DATA(p) is sent every num_heartbeats + 1 periods
+    size_t num_data = 0;
+    size_t last_data = 0;
+    for (size_t i = 0; i < periods_with_data.size(); ++i)
+    {
+        if (periods_with_data[i])
+        {
+            if (0 < num_data)
+            {
+                EXPECT_EQ(num_heartbeats + 1, i - last_data);
+            }
+            ++num_data;
+            last_data = i;
+        }
+    }
+    EXPECT_LE(3u, num_data);
+    EXPECT_LE(3u * num_heartbeats, periods_with_data.size() - num_data);
+
+    // The HEARTBEATs alone keep the writer participant alive
+    drop_data_p = true;
+    EXPECT_FALSE(reader.wait_participant_undiscovery(std::chrono::seconds(3)));
+    drop_data_p = false;
+}
+
 // Regression test of Refs #2535, github micro-RTPS #1
 TEST(Discovery, PubXmlLoadedPartition)
 {
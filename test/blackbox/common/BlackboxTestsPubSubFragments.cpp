@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
 #include <thread>
 
 #include <fastdds/dds/log/Log.hpp>
@@ -709,6 +710,101 @@ TEST(PubSubFragmentsLimited,
         testTransport->dropLogLength);
 }
 
+/*
+ * Checks the reassembly budget of the reader participant:
+ * - Fragments of new samples are dropped while the budget is held by a sample that is never completed.
+ * - The budget is released when the writer of that sample is removed, which is also the path taken when its
+ *   liveliness lease expires.
+ * - The budget is released after each reassembly, so samples larger than half the budget are all received.
+ */
+static void fragment_reassembly_budget_test(
+        eprosima::fastrtps::ReliabilityQosPolicyKind reliability)
+{
+    PubSubReader<Data1mbPubSubType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<Data1mbPubSubType> stalled_writer(TEST_TOPIC_NAME);
+    PubSubWriter<Data1mbPubSubType> writer(TEST_TOPIC_NAME);
+
+    // Room for a single 300kb sample being reassembled
+    PropertyPolicy reader_properties;
+    reader_properties.properties().emplace_back("fastdds.reassembly.max_bytes", "400000");
+    reader.property_policy(reader_properties)
+            .socket_buffer_size(1048576)
+            .history_depth(10)
+            .reliability(reliability)
+            .init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    // Only the first DATA_FRAG message of the stalled writer reaches the reader, so its sample is never completed
+    std::atomic<uint32_t> stalled_data_frags{0};
+    auto stalled_transport = std::make_shared<test_UDPv4TransportDescriptor>();
+    stalled_transport->drop_data_frag_messages_filter_ =
+            [&stalled_data_frags](eprosima::fastrtps::rtps::CDRMessage_t& msg)->bool
+            {
+                static_cast<void>(msg);
+                return 0 < stalled_data_frags++;
+            };
+    stalled_writer.disable_builtin_transport()
+            .add_user_transport_to_pparams(stalled_transport)
+            .history_depth(1)
+            .reliability(reliability)
+            .init();
+    ASSERT_TRUE(stalled_writer.isInitialized());
+
+    writer.disable_builtin_transport()
+            .add_user_transport_to_pparams(std::make_shared<test_UDPv4TransportDescriptor>())
+            .heartbeat_period_seconds(0)
+            .heartbeat_period_nanosec(100000000)
+            .history_depth(10)
+            .reliability(reliability)
+            .init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    stalled_writer.wait_discovery();
+    writer.wait_discovery();
+    reader.wait_discovery(std::chrono::seconds::zero(), 2u);
+
+    // 1. The stalled sample takes the whole budget
+    auto stalled_data = default_data300kb_data_generator(1);
+    stalled_writer.send(stalled_data);
+    ASSERT_TRUE(stalled_data.empty());
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    ASSERT_LT(1u, stalled_data_frags.load());
+
+    // 2. Samples of the other writer are dropped while the budget is exhausted
+    auto data = default_data300kb_data_generator(3);
+    auto expected_data = data;
+    reader.startReception(expected_data);
+    writer.send(data, 10u);
+    ASSERT_TRUE(data.empty());
+    EXPECT_EQ(0u, reader.block_for_all(std::chrono::seconds(1)));
+
+    // 3. Removing the stalled writer releases the budget. Each sample releases it once reassembled.
+    stalled_writer.destroy();
+    reader.wait_writer_undiscovery(1u);
+    if (eprosima::fastrtps::RELIABLE_RELIABILITY_QOS == reliability)
+    {
+        // Dropped fragments are recovered through retransmission
+        reader.block_for_all();
+    }
+    else
+    {
+        data = expected_data;
+        writer.send(data, 10u);
+        ASSERT_TRUE(data.empty());
+        reader.block_for_at_least(2u);
+    }
+}
+
+TEST(PubSubFragmentsLimited, BestEffortReassemblyBudgetDropsAndReleases)
+{
+    fragment_reassembly_budget_test(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS);
+}
+
+TEST(PubSubFragmentsLimited, ReliableReassemblyBudgetDropsAndReleases)
+{
+    fragment_reassembly_budget_test(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS);
+}
+
 TEST_P(PubSubFragmentsLimited, AsyncPubSubAsReliableVolatileData300kbInLossyConditionsSmallFragments)
 {
     PubSubReader<Data1mbPubSubType> reader(TEST_TOPIC_NAME);
@@ -1420,7 +1420,8 @@ GTEST_INSTANTIATE_TEST_MACRO(PubSubHistory,
                 rtps::PREALLOCATED_MEMORY_MODE,
                 rtps::PREALLOCATED_WITH_REALLOC_MEMORY_MODE,
                 rtps::DYNAMIC_RESERVE_MEMORY_MODE,
-                rtps::DYNAMIC_REUSABLE_MEMORY_MODE)),
+                rtps::DYNAMIC_REUSABLE_MEMORY_MODE,
+                rtps::DYNAMIC_SIZE_CLASS_MEMORY_MODE)),
         [](const testing::TestParamInfo<PubSubHistory::ParamType>& info)
         {
             std::string suffix;
@@ -1439,6 +1440,9 @@ GTEST_INSTANTIATE_TEST_MACRO(PubSubHistory,
                 case rtps::DYNAMIC_REUSABLE_MEMORY_MODE:
                     suffix = "_DYNAMIC_REUSABLE";
                     break;
+                case rtps::DYNAMIC_SIZE_CLASS_MEMORY_MODE:
+                    suffix = "_DYNAMIC_SIZE_CLASS";
+                    break;
             }
 
             switch (std::get<0>(info.param))
@@ -12,19 +12,27 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstdio>
 #include <cstdlib>
 #include <ctime>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <fstream>
 #include <future>
+#include <iomanip>
+#include <iterator>
 #include <memory>
 #include <mutex>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
 
 #include "BlackboxTests.hpp"
 #include "PubSubParticipant.hpp"
@@ -413,6 +421,158 @@ TEST(DDSDiscovery, ServersConnectionTCP)
     server_3.wait_discovery(std::chrono::seconds::zero(), 2, true); // Knows server1 and server2
 }
 
+/**
+ * This test checks that a BACKUP server restores the participants it knew from its backup files.
+ * It does so by:
+ *    1. Creating a BACKUP server and a client. The server journals the client, but it does not store a binary
+ *       snapshot, as the journal is far from the default compaction threshold.
+ *    2. Destroying both, and creating the server again. It must discover the client from the journal alone.
+ *    3. Creating the server again with a compaction threshold of 0, and waiting until it stores the client on its
+ *       binary snapshot.
+ *    4. Creating the server again. It must discover the client from the snapshot.
+ *    5. Replacing the binary snapshot with a JSON one, as stored by previous versions, and creating the server again.
+ *       It must discover the client from the JSON backup.
+ */
+TEST(DDSDiscovery, BackupServerRestoresDiscoveryDataBase)
+{
+    using namespace eprosima;
+    using namespace eprosima::fastdds::dds;
+    using namespace eprosima::fastrtps::rtps;
+
+    char* value = nullptr;
+    std::string W_UNICAST_PORT_RANDOM_NUMBER_STR;
+
+    /* Get random port from the environment */
+    value = std::getenv("W_UNICAST_PORT_RANDOM_NUMBER");
+    if (value != nullptr)
+    {
+        W_UNICAST_PORT_RANDOM_NUMBER_STR = value;
+    }
+    else
+    {
+        W_UNICAST_PORT_RANDOM_NUMBER_STR = "11811";
+    }
+
+    /* Configure the backup server */
+    WireProtocolConfigQos server_qos;
+    server_qos.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol_t::BACKUP;
+    // Generate random GUID prefix
+    srand(static_cast<unsigned>(time(nullptr)));
+    GuidPrefix_t server_prefix;
+    for (auto i = 0; i < 12; i++)
+    {
+        server_prefix.value[i] = eprosima::fastrtps::rtps::octet(rand() % 254);
+    }
+    server_qos.prefix = server_prefix;
+    // Generate server's listening locator
+    Locator_t locator_server;
+    IPLocator::setIPv4(locator_server, 127, 0, 0, 1);
+    locator_server.port = stoi(W_UNICAST_PORT_RANDOM_NUMBER_STR) + 2;
+    server_qos.builtin.metatrafficUnicastLocatorList.push_back(locator_server);
+
+    // The server stores its backup files on the working directory, named after its prefix
+    std::ostringstream prefix_name;
+    prefix_name << "server-" << server_prefix;
+    std::string backup_name = prefix_name.str();
+    std::replace(backup_name.begin(), backup_name.end(), '.', '-');
+    std::string snapshot_file = backup_name + ".cbor";
+    std::string journal_file = backup_name + "_queue.cbor";
+    std::string legacy_file = backup_name + ".json";
+    auto remove_backup_files = [&backup_name]()
+            {
+                for (const char* suffix : {".cbor", ".cbor.tmp", ".json", "_queue.cbor", "_reader.db", "_writer.db"})
+                {
+                    std::remove((backup_name + suffix).c_str());
+                }
+            };
+    remove_backup_files();
+
+    /* Create the server and a client connected to it */
+    std::unique_ptr<PubSubParticipant<HelloWorldPubSubType>> server(
+        new PubSubParticipant<HelloWorldPubSubType>(0u, 0u, 0u, 0u));
+    ASSERT_TRUE(server->wire_protocol(server_qos).init_participant());
+
+    PubSubParticipant<HelloWorldPubSubType>* client = new PubSubParticipant<HelloWorldPubSubType>(0u, 0u, 0u, 0u);
+    WireProtocolConfigQos client_qos;
+    client_qos.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol_t::CLIENT;
+    GuidPrefix_t client_prefix = server_prefix;
+    client_prefix.value[11]++;
+    client_qos.prefix = client_prefix;
+    RemoteServerAttributes server_att;
+    server_att.guidPrefix = server_prefix;
+    server_att.metatrafficUnicastLocatorList.push_back(Locator_t(locator_server));
+    client_qos.builtin.discovery_config.m_DiscoveryServers.push_back(server_att);
+    ASSERT_TRUE(client->wire_protocol(client_qos).init_participant());
+    ASSERT_TRUE(server->wait_discovery(std::chrono::seconds(10), 1, true));
+
+    std::ostringstream client_name;
+    client_name << client_prefix;
+
+    // The client is only on the journal
+    {
+        std::ifstream journal_stream(journal_file, std::ios_base::in | std::ios_base::binary | std::ios_base::ate);
+        ASSERT_TRUE(journal_stream.is_open());
+        EXPECT_LT(0, journal_stream.tellg());
+        std::ifstream snapshot_stream(snapshot_file);
+        EXPECT_FALSE(snapshot_stream.is_open());
+    }
+
+    // The server is destroyed first, so it is not notified of the client leaving
+    server.reset();
+    delete client;
+
+    /* The server restores the client from the journal */
+    server.reset(new PubSubParticipant<HelloWorldPubSubType>(0u, 0u, 0u, 0u));
+    ASSERT_TRUE(server->wire_protocol(server_qos).init_participant());
+    EXPECT_TRUE(server->wait_discovery(std::chrono::seconds(5), 1, true));
+    server.reset();
+
+    /* The server compacts the journal into the binary snapshot */
+    PropertyPolicy server_properties;
+    server_properties.properties().emplace_back("fastdds.discovery.backup_compaction_threshold", "0");
+    server.reset(new PubSubParticipant<HelloWorldPubSubType>(0u, 0u, 0u, 0u));
+    ASSERT_TRUE(server->wire_protocol(server_qos).property_policy(server_properties).init_participant());
+    EXPECT_TRUE(server->wait_discovery(std::chrono::seconds(5), 1, true));
+
+    nlohmann::json snapshot;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!snapshot.contains("participants") || !snapshot["participants"].contains(client_name.str()))
+    {
+        ASSERT_LT(std::chrono::steady_clock::now(), deadline) << "Client not stored on " << snapshot_file;
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        std::ifstream snapshot_stream(snapshot_file, std::ios_base::in | std::ios_base::binary);
+        std::vector<uint8_t> snapshot_data((std::istreambuf_iterator<char>(snapshot_stream)),
+                std::istreambuf_iterator<char>());
+        snapshot = nlohmann::json::from_cbor(snapshot_data, true, false);
+        if (snapshot.is_discarded())
+        {
+            snapshot = nlohmann::json();
+        }
+    }
+    server.reset();
+
+    /* The server restores the client from the binary snapshot */
+    server.reset(new PubSubParticipant<HelloWorldPubSubType>(0u, 0u, 0u, 0u));
+    ASSERT_TRUE(server->wire_protocol(server_qos).init_participant());
+    EXPECT_TRUE(server->wait_discovery(std::chrono::seconds(5), 1, true));
+    server.reset();
+
+    /* The server restores the client from the JSON backup of a previous version */
+    std::remove(snapshot_file.c_str());
+    {
+        std::ofstream legacy_stream(legacy_file);
+        legacy_stream << std::setw(4) << snapshot << std::endl;
+    }
+
+    server.reset(new PubSubParticipant<HelloWorldPubSubType>(0u, 0u, 0u, 0u));
+    ASSERT_TRUE(server->wire_protocol(server_qos).init_participant());
+    EXPECT_TRUE(server->wait_discovery(std::chrono::seconds(5), 1, true));
+    server.reset();
+
+    remove_backup_files();
+}
+
 /**
  * This test checks the addition of network interfaces at run-time.
  *
@@ -23,6 +23,9 @@
 #include <fastdds/rtps/history/IPayloadPool.h>
 #include <rtps/history/PoolConfig.h>
 
+#include <memory>
+#include <vector>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -32,6 +35,13 @@ class DataSharingPayloadPool : public IPayloadPool
 
 public:
 
+    //! Payloads of the same maximum size on a writer pool
+    struct SizeClass
+    {
+        uint32_t payload_size;  //< Maximum size of the serialized payload data
+        uint32_t count;         //< Number of payloads
+    };
+
     DataSharingPayloadPool() = default;
 
     ~DataSharingPayloadPool() = default;
@@ -94,6 +104,13 @@ public:
         return std::make_shared<DataSharingPayloadPool>();
     }
 
+    static std::shared_ptr<DataSharingPayloadPool> get_writer_pool(
+            const PoolConfig& /*config*/,
+            const std::vector<SizeClass>& /*size_classes*/)
+    {
+        return std::make_shared<DataSharingPayloadPool>();
+    }
+
     static std::string get_default_directory()
     {
         return std::string();
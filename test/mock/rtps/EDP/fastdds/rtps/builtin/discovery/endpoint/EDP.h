@@ -53,6 +53,12 @@ public:
 
     }
 
+    virtual void remote_participant_updated(
+            const eprosima::fastrtps::rtps::ParticipantProxyData&)
+    {
+
+    }
+
     virtual bool areRemoteEndpointsMatched(
             const eprosima::fastrtps::rtps::ParticipantProxyData*)
     {
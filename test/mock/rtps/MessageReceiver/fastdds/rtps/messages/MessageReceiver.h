@@ -69,6 +69,13 @@ public:
     {
     }
 
+    virtual void processCDRMsg(
+            const Locator_t& /*source_locator*/,
+            const Locator_t& /*reception_locator*/,
+            CDRMessage_t* /*msg*/)
+    {
+    }
+
     void setReceiverResource(
             ReceiverResource* /*receiverResource*/)
     {
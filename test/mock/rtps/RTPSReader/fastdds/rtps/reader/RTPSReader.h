@@ -65,7 +65,7 @@ public:
     virtual bool matched_writer_is_matched(
             const GUID_t& wguid) = 0;
 
-    const GUID_t& getGuid()
+    const GUID_t& getGuid() const
     {
         return m_guid;
     }
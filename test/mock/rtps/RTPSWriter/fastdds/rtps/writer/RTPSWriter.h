@@ -272,6 +272,20 @@ public:
         return async_locator_selector_;
     }
 
+    void begin_sample_batch_nts(
+            const std::chrono::time_point<std::chrono::steady_clock>&)
+    {
+    }
+
+    void end_sample_batch_nts()
+    {
+    }
+
+    RTPSMessageGroup* sample_batch_group_nts() const
+    {
+        return nullptr;
+    }
+
     WriterHistory* history_;
 
     WriterListener* listener_;
@@ -586,6 +586,18 @@ TEST(DataWriterTests, ForcedDataSharing)
     datawriter = publisher->create_datawriter(topic, qos);
     ASSERT_EQ(datawriter, nullptr);
 
+    // DataSharing enabled, unbounded topic data type, size classes
+    qos.properties().properties().emplace_back(fastrtps::rtps::Property("fastdds.datasharing.size_classes",
+            "1024:4,65536:2"));
+    datawriter = publisher->create_datawriter(topic, qos);
+    ASSERT_NE(datawriter, nullptr);
+    ASSERT_EQ(publisher->delete_datawriter(datawriter), ReturnCode_t::RETCODE_OK);
+
+    // DataSharing enabled, unbounded topic data type, wrong size classes
+    qos.properties().properties().back().value("1024");
+    datawriter = publisher->create_datawriter(topic, qos);
+    ASSERT_EQ(datawriter, nullptr);
+
     // DataSharing enabled, bounded topic data type
     datawriter = publisher->create_datawriter(bounded_topic, qos);
     ASSERT_NE(datawriter, nullptr);
@@ -836,6 +848,181 @@ TEST(DataWriterTests, WriteWithTimestamp)
     ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
 }
 
+TEST(DataWriterTests, WriteMany)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DataWriterQos wqos;
+    wqos.history().kind = KEEP_LAST_HISTORY_QOS;
+    wqos.history().depth = 2;
+
+    DataWriter* datawriter = publisher->create_datawriter(topic, wqos);
+    ASSERT_NE(datawriter, nullptr);
+
+    FooType data[4];
+    std::vector<void*> samples;
+    for (FooType& sample : data)
+    {
+        sample.message("HelloWorld");
+        samples.push_back(&sample);
+    }
+
+    // 1. An empty batch is accepted
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write_many({}));
+    // 2. Nothing is written when one of the samples is nullptr
+    std::vector<void*> wrong_samples(samples);
+    wrong_samples[2] = nullptr;
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, datawriter->write_many(wrong_samples));
+    // 3. Correct case, with more samples than the history depth
+    fastrtps::rtps::WriteParams params;
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write_many(samples, params));
+    EXPECT_EQ(datawriter->guid(), params.sample_identity().writer_guid());
+    EXPECT_EQ(fastrtps::rtps::SequenceNumber_t(0, 4), params.sample_identity().sequence_number());
+    // 4. Following writes continue the sequence
+    ASSERT_TRUE(datawriter->write(&data[0], params));
+    EXPECT_EQ(fastrtps::rtps::SequenceNumber_t(0, 5), params.sample_identity().sequence_number());
+
+    ASSERT_TRUE(publisher->delete_datawriter(datawriter) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_topic(topic) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_publisher(publisher) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
+}
+
+TEST(DataWriterTests, WriteManyParallelSerialization)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    // Serialize all the batches on two worker threads
+    DataWriterQos wqos;
+    wqos.properties().properties().emplace_back("fastdds.parallel_serialization.threads", "2");
+    wqos.properties().properties().emplace_back("fastdds.parallel_serialization.min_size", "0");
+
+    DataWriter* datawriter = publisher->create_datawriter(topic, wqos);
+    ASSERT_NE(datawriter, nullptr);
+
+    FooType data[16];
+    std::vector<void*> samples;
+    for (FooType& sample : data)
+    {
+        sample.message("HelloWorld");
+        samples.push_back(&sample);
+    }
+
+    fastrtps::rtps::WriteParams params;
+    for (int64_t batch = 1; batch <= 4; ++batch)
+    {
+        ASSERT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write_many(samples, params));
+        EXPECT_EQ(fastrtps::rtps::SequenceNumber_t(0, static_cast<uint32_t>(batch * samples.size())),
+                params.sample_identity().sequence_number());
+    }
+
+    ASSERT_TRUE(publisher->delete_datawriter(datawriter) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_topic(topic) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_publisher(publisher) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
+}
+
+/**
+ * Type support whose serialization fails for the samples with message "fail".
+ */
+class FailingTopicDataTypeMock : public TopicDataTypeMock
+{
+public:
+
+    using TopicDataTypeMock::serialize;
+
+    bool serialize(
+            void* data,
+            fastrtps::rtps::SerializedPayload_t* /*payload*/,
+            DataRepresentationId_t /*data_representation*/) override
+    {
+        return "fail" != static_cast<FooType*>(data)->message();
+    }
+
+};
+
+/**
+ * Tests that, when a sample of a batch fails its serialization on the worker threads, only the samples before it are
+ * written.
+ */
+TEST(DataWriterTests, WriteManyParallelSerializationFailure)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    TypeSupport type(new FailingTopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DataWriterQos wqos;
+    wqos.history().kind = KEEP_ALL_HISTORY_QOS;
+    wqos.properties().properties().emplace_back("fastdds.parallel_serialization.threads", "2");
+    wqos.properties().properties().emplace_back("fastdds.parallel_serialization.min_size", "0");
+
+    DataWriter* datawriter = publisher->create_datawriter(topic, wqos);
+    ASSERT_NE(datawriter, nullptr);
+
+    constexpr uint32_t failing_sample = 5;
+    FooType data[8];
+    std::vector<void*> samples;
+    for (FooType& sample : data)
+    {
+        sample.message("HelloWorld");
+        samples.push_back(&sample);
+    }
+    data[failing_sample].message("fail");
+
+    // 1. Only the samples before the failing one are written, with consecutive sequence numbers
+    fastrtps::rtps::WriteParams params;
+    EXPECT_EQ(ReturnCode_t::RETCODE_ERROR, datawriter->write_many(samples, params));
+    EXPECT_EQ(fastrtps::rtps::SequenceNumber_t(0, failing_sample), params.sample_identity().sequence_number());
+
+    // 2. The samples after the failing one did not take any sequence number
+    data[failing_sample].message("HelloWorld");
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write_many(samples, params));
+    EXPECT_EQ(fastrtps::rtps::SequenceNumber_t(0, failing_sample + 8u), params.sample_identity().sequence_number());
+
+    // 3. A failure on the first sample writes nothing
+    data[0].message("fail");
+    EXPECT_EQ(ReturnCode_t::RETCODE_ERROR, datawriter->write_many(samples, params));
+    data[0].message("HelloWorld");
+    ASSERT_TRUE(datawriter->write(&data[0], params));
+    EXPECT_EQ(fastrtps::rtps::SequenceNumber_t(0, failing_sample + 9u), params.sample_identity().sequence_number());
+
+    ASSERT_TRUE(publisher->delete_datawriter(datawriter) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_topic(topic) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_publisher(publisher) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
+}
+
 void set_listener_test (
         DataWriter* writer,
         DataWriterListener* listener,
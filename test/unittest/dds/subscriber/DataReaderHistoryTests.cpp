@@ -4,6 +4,7 @@
 #include <fastdds/dds/topic/Topic.hpp>
 #include <fastrtps/utils/TimedMutex.hpp>
 #include <fastdds/rtps/reader/StatelessReader.h>
+#include <utils/hash.hpp>
 
 
 #include <gmock/gmock.h>
@@ -267,6 +268,108 @@ TEST(DataReaderHistory, exclusive_ownership_keyed_sample_reception)
     ASSERT_EQ(18u, history.getHistorySize());
 }
 
+/*!
+ * Tests the instances of a keyed `DataReaderHistory` can be added, found and removed, and removing one of them keeps
+ * the others accessible.
+ */
+TEST(DataReaderHistory, instances_add_lookup_and_remove)
+{
+    TestType* type_ = new TestType();
+    EXPECT_CALL(*type_, createData()).Times(1);
+    EXPECT_CALL(*type_, deleteData(nullptr)).Times(1);
+
+    const TypeSupport type(type_);
+    type->m_isGetKeyDefined = true;
+    const Topic topic("test", "test");
+    DataReaderQos qos;
+    qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    qos.resource_limits().max_instances = 3;
+    DataReaderHistory history(type, topic, qos);
+    eprosima::fastrtps::RecursiveTimedMutex mutex;
+    eprosima::fastrtps::rtps::StatelessReader reader(&history, &mutex);
+
+    const InstanceHandle_t instance_1 = eprosima::fastrtps::rtps::GUID_t{{}, 1};
+    const InstanceHandle_t instance_2 = eprosima::fastrtps::rtps::GUID_t{{}, 2};
+    const InstanceHandle_t instance_3 = eprosima::fastrtps::rtps::GUID_t{{}, 3};
+    const InstanceHandle_t instance_4 = eprosima::fastrtps::rtps::GUID_t{{}, 4};
+    eprosima::fastrtps::rtps::CacheChange_t changes[5];
+    eprosima::fastrtps::rtps::SequenceNumber_t seq;
+    auto receive = [&](
+        eprosima::fastrtps::rtps::CacheChange_t& change,
+        const InstanceHandle_t& instance,
+        eprosima::fastrtps::rtps::ChangeKind_t kind)
+            {
+                change.writerGUID = {{}, 1};
+                change.sequenceNumber = ++seq;
+                change.instanceHandle = instance;
+                change.kind = kind;
+                if (!history.received_change(&change, 0))
+                {
+                    return false;
+                }
+                history.update_instance_nts(&change);
+                return true;
+            };
+
+    // Add one instance up to the limit
+    ASSERT_TRUE(receive(changes[0], instance_1, eprosima::fastrtps::rtps::ALIVE));
+    ASSERT_TRUE(receive(changes[1], instance_2, eprosima::fastrtps::rtps::ALIVE));
+    ASSERT_TRUE(receive(changes[2], instance_3, eprosima::fastrtps::rtps::ALIVE));
+    EXPECT_TRUE(history.is_instance_present(instance_1));
+    EXPECT_TRUE(history.is_instance_present(instance_2));
+    EXPECT_TRUE(history.is_instance_present(instance_3));
+    EXPECT_FALSE(history.is_instance_present(instance_4));
+
+    // All instances are alive, so no other can be added
+    EXPECT_FALSE(receive(changes[3], instance_4, eprosima::fastrtps::rtps::ALIVE));
+    EXPECT_FALSE(history.is_instance_present(instance_4));
+
+    // Unregister instance 2 and remove its samples
+    ASSERT_TRUE(receive(changes[3], instance_2, eprosima::fastrtps::rtps::NOT_ALIVE_DISPOSED_UNREGISTERED));
+    ASSERT_TRUE(history.remove_change_sub(&changes[1]));
+    ASSERT_TRUE(history.remove_change_sub(&changes[3]));
+    auto it = history.lookup_available_instance(instance_2, true);
+    ASSERT_TRUE(it.first);
+    history.check_and_remove_instance(it.second);
+
+    // Instance 2 is gone, and the remaining ones are still found, in order
+    EXPECT_FALSE(history.is_instance_present(instance_2));
+    EXPECT_FALSE(history.lookup_available_instance(instance_2, true).first);
+    EXPECT_TRUE(history.is_instance_present(instance_1));
+    EXPECT_TRUE(history.is_instance_present(instance_3));
+    EXPECT_TRUE(history.lookup_available_instance(instance_1, true).first);
+    EXPECT_TRUE(history.lookup_available_instance(instance_3, true).first);
+    it = history.lookup_available_instance(instance_1, false);
+    ASSERT_TRUE(it.first);
+    EXPECT_EQ(instance_3, it.second->first);
+
+    // The place of the removed instance can be used by a new one
+    ASSERT_TRUE(receive(changes[4], instance_4, eprosima::fastrtps::rtps::ALIVE));
+    EXPECT_TRUE(history.is_instance_present(instance_1));
+    EXPECT_TRUE(history.is_instance_present(instance_3));
+    EXPECT_TRUE(history.is_instance_present(instance_4));
+    EXPECT_EQ(3u, history.getHistorySize());
+}
+
+/*!
+ * Tests the hash of an `InstanceHandle_t`, used to index the instances of the history, depends on all its bytes.
+ */
+TEST(DataReaderHistory, instance_handle_hash_uses_the_whole_handle)
+{
+    eprosima::fastrtps::rtps::InstanceHandleHash hasher;
+    InstanceHandle_t handle;
+    handle.value[0] = 1;
+    const size_t base = hasher(handle);
+    EXPECT_EQ(base, hasher(handle));
+
+    for (size_t i = 0; i < 16; ++i)
+    {
+        InstanceHandle_t other = handle;
+        other.value[i] ^= 0x80;
+        EXPECT_NE(base, hasher(other)) << "Byte " << i;
+    }
+}
+
 int main(
         int argc,
         char** argv)
@@ -1663,6 +1663,205 @@ TEST_F(DataReaderTests, get_unread_count)
     EXPECT_EQ(0, data_reader_->get_unread_count());
 }
 
+TEST_F(DataReaderTests, take_batch)
+{
+    static const Duration_t time_to_wait(0, 100 * 1000 * 1000);
+    static constexpr int32_t num_samples = 10;
+
+    const ReturnCode_t& ok_code = ReturnCode_t::RETCODE_OK;
+    const ReturnCode_t& no_data_code = ReturnCode_t::RETCODE_NO_DATA;
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    writer_qos.history().depth = num_samples;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    reader_qos.resource_limits().max_instances = 2;
+    reader_qos.resource_limits().max_samples_per_instance = num_samples;
+    reader_qos.resource_limits().max_samples = 2 * num_samples;
+
+    create_instance_handles();
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    FooType data;
+    data.message()[1] = '\0';
+
+    // Send samples on two instances
+    for (char i = 0; i < num_samples; ++i)
+    {
+        data.index(i % 2);
+        data.message()[0] = i + '0';
+        EXPECT_EQ(ok_code, data_writer_->write(&data, HANDLE_NIL));
+    }
+    EXPECT_TRUE(data_reader_->wait_for_unread_message(time_to_wait));
+
+    FooSeq data_seq;
+    SampleInfoBatch infos;
+
+    // Take part of the samples with a loan
+    ASSERT_EQ(ok_code, data_reader_->take_batch(data_seq, infos, 4));
+    EXPECT_FALSE(data_seq.has_ownership());
+    ASSERT_EQ(4, data_seq.length());
+    ASSERT_EQ(4u, infos.size());
+    EXPECT_EQ(4u, infos.source_timestamp.size());
+    EXPECT_EQ(4u, infos.instance_handle.size());
+    EXPECT_EQ(4u, infos.writer_guid.size());
+    EXPECT_EQ(4u, infos.valid_data.size());
+    for (size_t n = 0; n < infos.size(); ++n)
+    {
+        EXPECT_TRUE(infos.valid_data[n]);
+        EXPECT_EQ(data_writer_->guid(), infos.writer_guid[n]);
+    }
+    EXPECT_EQ(ok_code, data_reader_->return_loan(data_seq, infos));
+    EXPECT_EQ(0u, infos.size());
+
+    // Take the rest of the samples copying them
+    FooSeq owned_seq(num_samples);
+    ASSERT_EQ(ok_code, data_reader_->take_batch(owned_seq, infos));
+    EXPECT_TRUE(owned_seq.has_ownership());
+    ASSERT_EQ(num_samples - 4, owned_seq.length());
+    ASSERT_EQ(static_cast<size_t>(num_samples - 4), infos.size());
+
+    // Samples are taken instance by instance, in order of sequence number
+    for (size_t n = 1; n < infos.size(); ++n)
+    {
+        if (infos.instance_handle[n] == infos.instance_handle[n - 1])
+        {
+            EXPECT_LT(infos.sequence_number[n - 1], infos.sequence_number[n]);
+        }
+    }
+
+    // Nothing else to take
+    EXPECT_EQ(no_data_code, data_reader_->take_batch(data_seq, infos));
+    EXPECT_EQ(0u, infos.size());
+    EXPECT_TRUE(data_seq.has_ownership());
+    EXPECT_EQ(0u, data_reader_->get_unread_count());
+}
+
+TEST_F(DataReaderTests, take_serialized)
+{
+    static const Duration_t time_to_wait(0, 100 * 1000 * 1000);
+    static constexpr int32_t num_samples = 4;
+
+    const ReturnCode_t& ok_code = ReturnCode_t::RETCODE_OK;
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    writer_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+
+    create_instance_handles();
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    FooType data;
+    data.message()[1] = '\0';
+    for (char i = 0; i < num_samples; ++i)
+    {
+        data.index(static_cast<uint32_t>(i));
+        data.message()[0] = i + '0';
+        EXPECT_EQ(ok_code, data_writer_->write(&data, HANDLE_NIL));
+    }
+    EXPECT_TRUE(data_reader_->wait_for_unread_message(time_to_wait));
+
+    // Views can only be loaned
+    SerializedSampleViewSeq owned_views(num_samples);
+    SampleInfoSeq owned_infos(num_samples);
+    EXPECT_EQ(ReturnCode_t::RETCODE_PRECONDITION_NOT_MET,
+            data_reader_->take_serialized(owned_views, owned_infos));
+
+    SerializedSampleViewSeq views;
+    SampleInfoSeq infos;
+    ASSERT_EQ(ok_code, data_reader_->take_serialized(views, infos));
+    ASSERT_EQ(num_samples, views.length());
+
+    for (SerializedSampleViewSeq::size_type n = 0; n < views.length(); ++n)
+    {
+        ASSERT_TRUE(infos[n].valid_data);
+        ASSERT_TRUE(views[n].is_supported());
+        EXPECT_EQ(views[n].is_little_endian() ? CDR_LE : CDR_BE, views[n].encapsulation());
+
+        // Decode only the index field, which is the first member of the type
+        uint32_t index = 0;
+        ASSERT_TRUE(views[n].get(0, index));
+
+        // Misaligned accesses are detected. XCDR1 aligns 8-byte fields to 8 bytes
+        uint64_t misaligned = 0;
+        EXPECT_FALSE(views[n].get(2, index));
+        EXPECT_FALSE(views[n].get(4, misaligned));
+
+        // Decode the whole sample
+        FooType sample;
+        ASSERT_TRUE(views[n].deserialize(&sample));
+        EXPECT_EQ(sample.index(), index);
+        EXPECT_EQ(static_cast<char>(index + '0'), sample.message()[0]);
+
+        // Out of bounds access is detected
+        EXPECT_FALSE(views[n].get(views[n].size(), index));
+    }
+
+    EXPECT_EQ(ok_code, data_reader_->return_loan(views, infos));
+    EXPECT_EQ(0u, data_reader_->get_unread_count());
+}
+
+TEST_F(DataReaderTests, take_serialized_xcdr2)
+{
+    static const Duration_t time_to_wait(0, 100 * 1000 * 1000);
+    static constexpr uint16_t plain_cdr2_be = 0x0006;
+    static constexpr uint16_t plain_cdr2_le = 0x0007;
+
+    const ReturnCode_t& ok_code = ReturnCode_t::RETCODE_OK;
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    writer_qos.representation().m_value.push_back(DataRepresentationId_t::XCDR2_DATA_REPRESENTATION);
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.type_consistency().representation.m_value.push_back(DataRepresentationId_t::XCDR2_DATA_REPRESENTATION);
+
+    create_instance_handles();
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    FooType data;
+    data.index(7u);
+    data.message()[0] = '7';
+    data.message()[1] = '\0';
+    EXPECT_EQ(ok_code, data_writer_->write(&data, HANDLE_NIL));
+    EXPECT_TRUE(data_reader_->wait_for_unread_message(time_to_wait));
+
+    SerializedSampleViewSeq views;
+    SampleInfoSeq infos;
+    ASSERT_EQ(ok_code, data_reader_->take_serialized(views, infos));
+    ASSERT_EQ(1, views.length());
+    ASSERT_TRUE(infos[0].valid_data);
+    ASSERT_TRUE(views[0].is_supported());
+    EXPECT_EQ(views[0].is_little_endian() ? plain_cdr2_le : plain_cdr2_be, views[0].encapsulation());
+
+    uint32_t index = 0;
+    ASSERT_TRUE(views[0].get(0, index));
+    EXPECT_EQ(7u, index);
+
+    // XCDR2 aligns 8-byte fields to 4 bytes
+    uint64_t aligned = 0;
+    EXPECT_TRUE(views[0].get(4, aligned));
+    EXPECT_FALSE(views[0].get(2, index));
+
+    FooType sample;
+    ASSERT_TRUE(views[0].deserialize(&sample));
+    EXPECT_EQ(7u, sample.index());
+
+    EXPECT_EQ(ok_code, data_reader_->return_loan(views, infos));
+}
+
 template<typename DataType>
 void lookup_instance_test(
         DataType& data,
@@ -0,0 +1,218 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <rtps/DataSharing/DataSharingListener.hpp>
+#include <rtps/DataSharing/DataSharingNotification.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+//! Notification segment owned by the reader side, giving access to the shared flags
+class TestNotification : public DataSharingNotification
+{
+public:
+
+    bool create(
+            const GUID_t& reader_guid)
+    {
+        return create_and_init_notification(reader_guid);
+    }
+
+    bool new_data() const
+    {
+        return notification_->new_data.load();
+    }
+
+    bool listener_waiting() const
+    {
+        return notification_->listener_waiting.load();
+    }
+
+    static std::string segment_name(
+            const GUID_t& reader_guid)
+    {
+        return generate_segment_name(std::string(), reader_guid);
+    }
+
+};
+
+//! Listener running its loop on a plain thread, as there is no reader to name the thread after
+class TestListener : public DataSharingListener
+{
+public:
+
+    TestListener(
+            std::shared_ptr<DataSharingNotification> notification,
+            uint32_t spin_budget_us)
+        : DataSharingListener(notification, std::string(), fastdds::rtps::ThreadSettings{},
+                ResourceLimitedContainerConfig(), spin_budget_us, nullptr)
+    {
+    }
+
+    ~TestListener()
+    {
+        stop_thread();
+    }
+
+    void start_thread()
+    {
+        is_running_.store(true);
+        thread_ = std::thread([this]()
+                        {
+                            run();
+                        });
+    }
+
+    void stop_thread()
+    {
+        if (is_running_.exchange(false))
+        {
+            notification_->notify();
+            thread_.join();
+        }
+    }
+
+private:
+
+    std::thread thread_;
+};
+
+class DataSharingListenerTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        // Use a different reader on each test run, as tests may run in parallel processes
+        uint64_t stamp = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        uint64_t test = std::hash<std::string>()(::testing::UnitTest::GetInstance()->current_test_info()->name());
+        memcpy(reader_guid_.guidPrefix.value, &stamp, sizeof(stamp));
+        memcpy(&reader_guid_.guidPrefix.value[sizeof(stamp)], &test, GuidPrefix_t::size - sizeof(stamp));
+        reader_guid_.entityId = c_EntityId_Unknown;
+        reader_guid_.entityId.value[3] = 0x04;
+
+        reader_notification_ = std::make_shared<TestNotification>();
+        ASSERT_TRUE(reader_notification_->create(reader_guid_));
+        writer_notification_ = DataSharingNotification::open_notification(reader_guid_);
+        ASSERT_NE(nullptr, writer_notification_);
+    }
+
+    void TearDown() override
+    {
+        // The listener removes the segment when destroyed, but not every test creates one
+        fastdds::rtps::SharedMemSegment::remove(TestNotification::segment_name(reader_guid_));
+    }
+
+    //! Wait until the condition holds, or the timeout expires
+    static bool wait_for(
+            std::function<bool()> condition)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!condition())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    GUID_t reader_guid_;
+    std::shared_ptr<TestNotification> reader_notification_;
+    std::shared_ptr<DataSharingNotification> writer_notification_;
+};
+
+//! A listener blocked on the segment flags it, and is woken up by the writer
+TEST_F(DataSharingListenerTests, blocked_listener_is_notified)
+{
+    TestListener listener(reader_notification_, 0);
+    listener.start_thread();
+
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(wait_for([this]()
+                {
+                    return reader_notification_->listener_waiting();
+                }));
+
+        writer_notification_->notify();
+        EXPECT_TRUE(wait_for([this]()
+                {
+                    return !reader_notification_->new_data();
+                }));
+    }
+
+    // Stopping wakes up the blocked listener
+    listener.stop_thread();
+    EXPECT_FALSE(reader_notification_->listener_waiting());
+}
+
+//! A spinning listener takes the new data without blocking on the segment
+TEST_F(DataSharingListenerTests, spinning_listener_is_not_blocked)
+{
+    TestListener listener(reader_notification_, 60 * 1000 * 1000);
+    listener.start_thread();
+
+    for (int i = 0; i < 3; ++i)
+    {
+        writer_notification_->notify();
+        EXPECT_TRUE(wait_for([this]()
+                {
+                    return !reader_notification_->new_data();
+                }));
+        EXPECT_FALSE(reader_notification_->listener_waiting());
+    }
+
+    listener.stop_thread();
+}
+
+//! Writers do not attach to a segment whose notification has a different layout version
+TEST_F(DataSharingListenerTests, open_checks_notification_version)
+{
+    GUID_t other_reader = reader_guid_;
+    other_reader.entityId.value[1] = 0xff;
+    std::string name = TestNotification::segment_name(other_reader);
+
+    fastdds::rtps::SharedMemSegment::remove(name);
+    {
+        fastdds::rtps::SharedMemSegment segment(boost::interprocess::create_only, name, 1024);
+        segment.get().construct<uint64_t>("notification_node")(0u);
+        EXPECT_EQ(nullptr, DataSharingNotification::open_notification(other_reader));
+    }
+    fastdds::rtps::SharedMemSegment::remove(name);
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,159 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/writer/RTPSWriter.h>
+
+#include <rtps/DataSharing/WriterPool.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+//! Writer owning the pool, with a different GUID on each test run so their segments do not collide
+class TestWriter : public RTPSWriter
+{
+public:
+
+    TestWriter()
+    {
+        uint64_t stamp = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        memcpy(m_guid.guidPrefix.value, &stamp, sizeof(stamp));
+        m_guid.guidPrefix.value[GuidPrefix_t::size - 1] = 0xd5;
+    }
+
+};
+
+class WriterPoolTests : public ::testing::Test
+{
+protected:
+
+    void create_pool(
+            const std::vector<DataSharingPayloadPool::SizeClass>& size_classes)
+    {
+        pool_ = std::make_shared<WriterPool>(0u, 0u, size_classes);
+        ASSERT_TRUE(pool_->init_shared_memory(&writer_, std::string()));
+    }
+
+    //! Take a payload and return the maximum size of its class, or 0 when there is no payload for it
+    uint32_t get(
+            CacheChange_t& change,
+            uint32_t size)
+    {
+        if (!pool_->get_payload(size, change))
+        {
+            return 0;
+        }
+        EXPECT_EQ(pool_.get(), change.payload_owner());
+        EXPECT_NE(nullptr, change.serializedPayload.data);
+        return change.serializedPayload.max_size;
+    }
+
+    TestWriter writer_;
+    std::shared_ptr<WriterPool> pool_;
+};
+
+//! Payloads are taken from the smallest class able to hold them, whatever the order the classes are given
+TEST_F(WriterPoolTests, get_payload_uses_smallest_class)
+{
+    create_pool({{1024, 1}, {64, 1}, {256, 1}});
+
+    CacheChange_t changes[4];
+    EXPECT_EQ(64u, get(changes[0], 64));
+    EXPECT_EQ(256u, get(changes[1], 65));
+    EXPECT_EQ(1024u, get(changes[2], 1000));
+
+    // No class can hold it
+    EXPECT_EQ(0u, get(changes[3], 1025));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(pool_->release_payload(changes[i]));
+    }
+}
+
+//! When the smallest class is exhausted, the payload is taken from the next one
+TEST_F(WriterPoolTests, get_payload_falls_back_to_bigger_class)
+{
+    create_pool({{64, 2}, {256, 1}, {1024, 1}});
+
+    CacheChange_t changes[5];
+    EXPECT_EQ(64u, get(changes[0], 10));
+    EXPECT_EQ(64u, get(changes[1], 10));
+    EXPECT_EQ(256u, get(changes[2], 10));
+    EXPECT_EQ(1024u, get(changes[3], 10));
+    EXPECT_EQ(0u, get(changes[4], 10));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(pool_->release_payload(changes[i]));
+    }
+}
+
+//! Released payloads go back to their own class
+TEST_F(WriterPoolTests, release_payload_returns_to_its_class)
+{
+    create_pool({{64, 1}, {256, 1}});
+
+    CacheChange_t small;
+    CacheChange_t big;
+    ASSERT_EQ(64u, get(small, 10));
+    ASSERT_EQ(256u, get(big, 10));
+    octet* small_data = small.serializedPayload.data;
+    octet* big_data = big.serializedPayload.data;
+
+    // Releasing the big payload does not make room for small ones on the small class
+    EXPECT_TRUE(pool_->release_payload(big));
+    EXPECT_EQ(nullptr, big.serializedPayload.data);
+    CacheChange_t other;
+    ASSERT_EQ(256u, get(other, 10));
+    EXPECT_EQ(big_data, other.serializedPayload.data);
+    EXPECT_EQ(0u, get(big, 10));
+
+    // The small payload is reused once released
+    EXPECT_TRUE(pool_->release_payload(small));
+    ASSERT_EQ(64u, get(small, 64));
+    EXPECT_EQ(small_data, small.serializedPayload.data);
+
+    EXPECT_TRUE(pool_->release_payload(small));
+    EXPECT_TRUE(pool_->release_payload(other));
+
+    // Without size classes, every payload has the configured size
+    pool_.reset();
+    pool_ = std::make_shared<WriterPool>(2u, 128u);
+    ASSERT_TRUE(pool_->init_shared_memory(&writer_, std::string()));
+    EXPECT_EQ(128u, get(small, 10));
+    EXPECT_EQ(128u, get(big, 100));
+    EXPECT_EQ(0u, get(other, 10));
+    EXPECT_TRUE(pool_->release_payload(small));
+    EXPECT_TRUE(pool_->release_payload(big));
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
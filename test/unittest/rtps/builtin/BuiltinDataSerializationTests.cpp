@@ -1837,6 +1837,56 @@ TEST(BuiltinDataSerializationTests, contentfilterproperty_max_parameter_check)
     }
 }
 
+/*!
+ * This test checks that the hash of a serialized parameter list changes with its contents, and that it is kept
+ * when the proxy data objects are copied.
+ */
+TEST(BuiltinDataSerializationTests, payload_hash)
+{
+    WriterProxyData in(max_unicast_locators, max_multicast_locators);
+    in.topicName("TEST");
+    in.typeName("TestType");
+
+    auto serialize = [](const WriterProxyData& data, SerializedPayload_t& payload)
+            {
+                CDRMessage_t msg(payload);
+                EXPECT_TRUE(data.writeToCDRMessage(&msg, true));
+                payload.length = msg.length;
+            };
+
+    uint32_t msg_size = in.get_serialized_size(true) + 16;
+    SerializedPayload_t first(msg_size);
+    SerializedPayload_t second(msg_size);
+    serialize(in, first);
+    serialize(in, second);
+
+    uint64_t hash = fastdds::dds::ParameterList::payload_hash(first);
+    EXPECT_NE(0u, hash);
+    EXPECT_EQ(hash, fastdds::dds::ParameterList::payload_hash(second));
+
+    in.topicName("TEST2");
+    SerializedPayload_t third(msg_size);
+    serialize(in, third);
+    EXPECT_NE(hash, fastdds::dds::ParameterList::payload_hash(third));
+
+    WriterProxyData out(max_unicast_locators, max_multicast_locators);
+    EXPECT_FALSE(out.is_read_from(first, hash));
+    out.serialized_payload(first, hash);
+    EXPECT_TRUE(out.is_read_from(second, hash));
+    // A hash collision is detected by comparing the payloads
+    EXPECT_FALSE(out.is_read_from(third, hash));
+
+    WriterProxyData copy(out);
+    EXPECT_EQ(hash, copy.serialized_hash());
+    EXPECT_TRUE(copy.is_read_from(second, hash));
+    copy.clear();
+    EXPECT_EQ(0u, copy.serialized_hash());
+    EXPECT_FALSE(copy.is_read_from(second, hash));
+    copy = out;
+    EXPECT_EQ(hash, copy.serialized_hash());
+    EXPECT_TRUE(copy.is_read_from(second, hash));
+}
+
 TEST(BuiltinDataSerializationTests, null_checks)
 {
     {
@@ -0,0 +1,525 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/EntityId_t.hpp>
+#include <fastdds/rtps/common/Guid.h>
+
+#include <rtps/builtin/discovery/database/DiscoveryDataBase.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+using fastrtps::rtps::CacheChange_t;
+using fastrtps::rtps::ChangeKind_t;
+using fastrtps::rtps::EntityId_t;
+using fastrtps::rtps::GUID_t;
+using fastrtps::rtps::GuidPrefix_t;
+using fastrtps::rtps::SequenceNumber_t;
+
+//! Database giving access to its collections, to check they are consistent with their indexes
+class TestDiscoveryDataBase : public DiscoveryDataBase
+{
+public:
+
+    using DiscoveryDataBase::DiscoveryDataBase;
+
+    bool has_participant(
+            const GuidPrefix_t& prefix) const
+    {
+        return participants_.find(prefix) != participants_.end();
+    }
+
+    bool has_writer(
+            const GUID_t& guid) const
+    {
+        return writers_.find(guid) != writers_.end();
+    }
+
+    bool has_reader(
+            const GUID_t& guid) const
+    {
+        return readers_.find(guid) != readers_.end();
+    }
+
+    //! Writers of the topic, without the virtual ones of the local servers
+    std::vector<GUID_t> writers_of_topic(
+            const std::string& topic)
+    {
+        return endpoints_of_topic(writers_, writers_by_topic_, topic);
+    }
+
+    //! Readers of the topic, without the virtual ones of the local servers
+    std::vector<GUID_t> readers_of_topic(
+            const std::string& topic)
+    {
+        return endpoints_of_topic(readers_, readers_by_topic_, topic);
+    }
+
+    std::set<std::string> dirty_topics() const
+    {
+        return std::set<std::string>(dirty_topics_.begin(), dirty_topics_.end());
+    }
+
+    //! Check every collection holds the same elements than its index, and entities reference each other
+    void check_consistency()
+    {
+        check_indexed(dirty_topics_, dirty_topics_index_);
+        check_indexed(disposals_, disposals_index_);
+        check_indexed(pdp_to_send_, pdp_to_send_index_);
+        check_indexed(edp_publications_to_send_, edp_publications_to_send_index_);
+        check_indexed(edp_subscriptions_to_send_, edp_subscriptions_to_send_index_);
+
+        for (auto& participant : participants_)
+        {
+            for (const GUID_t& writer : participant.second.writers())
+            {
+                EXPECT_EQ(participant.first, writer.guidPrefix);
+                EXPECT_TRUE(has_writer(writer)) << writer;
+            }
+            for (const GUID_t& reader : participant.second.readers())
+            {
+                EXPECT_EQ(participant.first, reader.guidPrefix);
+                EXPECT_TRUE(has_reader(reader)) << reader;
+            }
+        }
+
+        check_endpoints(writers_, writers_by_topic_);
+        check_endpoints(readers_, readers_by_topic_);
+    }
+
+private:
+
+    static std::vector<GUID_t> endpoints_of_topic(
+            EndpointMap& endpoints,
+            const TopicMap& by_topic,
+            const std::string& topic)
+    {
+        std::vector<GUID_t> result;
+        auto it = by_topic.find(topic);
+        if (it != by_topic.end())
+        {
+            for (const GUID_t& guid : it->second)
+            {
+                auto endpoint = endpoints.find(guid);
+                if (endpoint == endpoints.end() || !endpoint->second.is_virtual())
+                {
+                    result.push_back(guid);
+                }
+            }
+        }
+        return result;
+    }
+
+    template<typename T>
+    static void check_indexed(
+            const std::vector<T>& collection,
+            const std::unordered_set<T>& index)
+    {
+        EXPECT_EQ(collection.size(), index.size());
+        for (const T& element : collection)
+        {
+            EXPECT_EQ(1u, index.count(element));
+        }
+    }
+
+    void check_endpoints(
+            EndpointMap& endpoints,
+            const TopicMap& by_topic)
+    {
+        for (auto& endpoint : endpoints)
+        {
+            auto participant = participants_.find(endpoint.first.guidPrefix);
+            ASSERT_NE(participants_.end(), participant);
+        }
+
+        for (const auto& topic : by_topic)
+        {
+            for (const GUID_t& guid : topic.second)
+            {
+                auto endpoint = endpoints.find(guid);
+                ASSERT_NE(endpoints.end(), endpoint) << guid;
+                // Virtual endpoints are listed on every topic
+                if (!endpoint->second.is_virtual())
+                {
+                    EXPECT_EQ(topic.first, endpoint->second.topic());
+                }
+            }
+        }
+    }
+
+};
+
+class DiscoveryDataBaseTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        server_prefix_.value[0] = 0x01;
+        create_database();
+    }
+
+    void create_database()
+    {
+        if (db_)
+        {
+            db_->disable();
+        }
+        db_.reset(new TestDiscoveryDataBase(server_prefix_, {}));
+
+        // The server knows its own DATA(p) before any other
+        add_participant(server_prefix_, false);
+        db_->process_pdp_data_queue();
+    }
+
+    void TearDown() override
+    {
+        db_->disable();
+        db_.reset();
+    }
+
+    static GuidPrefix_t prefix(
+            uint8_t id)
+    {
+        GuidPrefix_t prefix;
+        prefix.value[0] = 0x02;
+        prefix.value[1] = id;
+        return prefix;
+    }
+
+    static GUID_t endpoint(
+            const GuidPrefix_t& prefix,
+            uint8_t id,
+            bool is_writer)
+    {
+        return GUID_t(prefix, EntityId_t(static_cast<uint32_t>(id) << 8 | (is_writer ? 0x03 : 0x04)));
+    }
+
+    //! Build a discovery change announcing an entity, kept by the test until the end
+    CacheChange_t* new_change(
+            const GUID_t& entity,
+            const EntityId_t& builtin_writer,
+            ChangeKind_t kind)
+    {
+        changes_.emplace_back(new CacheChange_t());
+        CacheChange_t* change = changes_.back().get();
+        change->kind = kind;
+        change->writerGUID = GUID_t(entity.guidPrefix, builtin_writer);
+        change->instanceHandle = entity;
+        fastrtps::rtps::SampleIdentity identity;
+        identity.writer_guid(change->writerGUID);
+        identity.sequence_number(SequenceNumber_t(0, ++sequence_number_));
+        change->write_params.sample_identity(identity);
+        change->write_params.related_sample_identity(identity);
+        return change;
+    }
+
+    CacheChange_t* add_participant(
+            const GuidPrefix_t& prefix,
+            bool is_client,
+            ChangeKind_t kind = fastrtps::rtps::ALIVE)
+    {
+        CacheChange_t* change = new_change(GUID_t(prefix, fastrtps::rtps::c_EntityId_RTPSParticipant),
+                        fastrtps::rtps::c_EntityId_SPDPWriter, kind);
+        EXPECT_TRUE(db_->update(change, DiscoveryParticipantChangeData(
+                    fastrtps::rtps::RemoteLocatorList(), is_client, true)));
+        return change;
+    }
+
+    CacheChange_t* add_endpoint(
+            const GUID_t& guid,
+            const std::string& topic,
+            ChangeKind_t kind = fastrtps::rtps::ALIVE)
+    {
+        bool is_writer = DiscoveryDataBase::is_writer(guid);
+        CacheChange_t* change = new_change(guid,
+                        is_writer ? fastrtps::rtps::c_EntityId_SEDPPubWriter : fastrtps::rtps::c_EntityId_SEDPSubWriter,
+                        kind);
+        EXPECT_TRUE(db_->update(change, topic));
+        return change;
+    }
+
+    void process()
+    {
+        db_->process_pdp_data_queue();
+        db_->process_edp_data_queue();
+        db_->process_dirty_topics();
+        db_->check_consistency();
+    }
+
+    //! Entities of the changes to send, in the order they would be sent
+    std::vector<GUID_t> entities_to_send()
+    {
+        std::vector<GUID_t> entities;
+        for (const std::vector<CacheChange_t*>& changes :
+                {db_->pdp_to_send(), db_->edp_publications_to_send(), db_->edp_subscriptions_to_send()})
+        {
+            for (CacheChange_t* change : changes)
+            {
+                entities.push_back(fastrtps::rtps::iHandle2GUID(change->instanceHandle));
+            }
+        }
+        return entities;
+    }
+
+    //! Discover endpoints on several topics, matching them with the given number of workers
+    std::vector<GUID_t> match_topics(
+            uint32_t num_workers)
+    {
+        create_database();
+        db_->start_matching_workers(num_workers, fastdds::rtps::ThreadSettings{}, 0);
+
+        GuidPrefix_t client_a = prefix(1);
+        GuidPrefix_t client_b = prefix(2);
+        add_participant(client_a, true);
+        add_participant(client_b, true);
+        for (uint8_t i = 1; i <= 20; ++i)
+        {
+            std::string topic = "topic_" + std::to_string(i);
+            add_endpoint(endpoint(client_a, i, true), topic);
+            add_endpoint(endpoint(client_b, i, false), topic);
+        }
+        for (int i = 0; i < 3; ++i)
+        {
+            process();
+        }
+
+        std::vector<GUID_t> entities = entities_to_send();
+        db_->stop_matching_workers();
+        return entities;
+    }
+
+    template<typename T>
+    static bool has_duplicates(
+            std::vector<T> collection)
+    {
+        std::sort(collection.begin(), collection.end());
+        return std::adjacent_find(collection.begin(), collection.end()) != collection.end();
+    }
+
+    GuidPrefix_t server_prefix_;
+    std::unique_ptr<TestDiscoveryDataBase> db_;
+    std::vector<std::unique_ptr<CacheChange_t>> changes_;
+    int32_t sequence_number_ = 0;
+};
+
+//! Entities are found through the indexes once added, and dirty topics are kept once
+TEST_F(DiscoveryDataBaseTests, add_entities)
+{
+    GuidPrefix_t client_a = prefix(1);
+    GuidPrefix_t client_b = prefix(2);
+    GUID_t writer = endpoint(client_a, 1, true);
+    GUID_t reader_1 = endpoint(client_b, 1, false);
+    GUID_t reader_2 = endpoint(client_b, 2, false);
+
+    add_participant(client_a, true);
+    add_participant(client_b, true);
+    add_endpoint(writer, "topic_1");
+    add_endpoint(reader_1, "topic_1");
+    add_endpoint(reader_2, "topic_2");
+
+    db_->process_pdp_data_queue();
+    db_->process_edp_data_queue();
+    db_->check_consistency();
+
+    EXPECT_TRUE(db_->has_participant(client_a));
+    EXPECT_TRUE(db_->has_participant(client_b));
+    EXPECT_TRUE(db_->has_writer(writer));
+    EXPECT_TRUE(db_->has_reader(reader_1));
+    EXPECT_TRUE(db_->has_reader(reader_2));
+    EXPECT_FALSE(db_->has_reader(writer));
+    EXPECT_EQ(std::vector<GUID_t>({writer}), db_->writers_of_topic("topic_1"));
+    EXPECT_EQ(std::vector<GUID_t>({reader_1}), db_->readers_of_topic("topic_1"));
+    EXPECT_EQ(std::vector<GUID_t>({reader_2}), db_->readers_of_topic("topic_2"));
+    EXPECT_EQ(std::set<std::string>({"topic_1", "topic_2"}), db_->dirty_topics());
+
+    std::vector<GuidPrefix_t> remote = db_->direct_clients_and_servers();
+    EXPECT_EQ(2u, remote.size());
+    EXPECT_NE(remote.end(), std::find(remote.begin(), remote.end(), client_a));
+    EXPECT_NE(remote.end(), std::find(remote.begin(), remote.end(), client_b));
+
+    // Repeated matching rounds do not repeat the changes to send
+    for (int i = 0; i < 3; ++i)
+    {
+        db_->process_dirty_topics();
+        db_->check_consistency();
+    }
+    EXPECT_FALSE(has_duplicates(db_->pdp_to_send()));
+    EXPECT_FALSE(has_duplicates(db_->edp_publications_to_send()));
+    EXPECT_FALSE(has_duplicates(db_->edp_subscriptions_to_send()));
+
+    // A cleared collection accepts the same changes again
+    db_->clear_pdp_to_send();
+    db_->clear_edp_publications_to_send();
+    db_->clear_edp_subscriptions_to_send();
+    db_->check_consistency();
+    add_endpoint(endpoint(client_a, 2, true), "topic_2");
+    process();
+    EXPECT_FALSE(has_duplicates(db_->pdp_to_send()));
+}
+
+//! Deleting endpoints keeps the other entities of their participant and topic
+TEST_F(DiscoveryDataBaseTests, delete_endpoints)
+{
+    GuidPrefix_t client_a = prefix(1);
+    GuidPrefix_t client_b = prefix(2);
+    GUID_t writer_1 = endpoint(client_a, 1, true);
+    GUID_t writer_2 = endpoint(client_a, 2, true);
+    GUID_t reader_1 = endpoint(client_b, 1, false);
+    GUID_t reader_2 = endpoint(client_b, 2, false);
+
+    add_participant(client_a, true);
+    add_participant(client_b, true);
+    add_endpoint(writer_1, "topic");
+    add_endpoint(writer_2, "topic");
+    add_endpoint(reader_1, "topic");
+    add_endpoint(reader_2, "topic");
+    process();
+
+    // Dispose a writer and a reader
+    CacheChange_t* writer_disposal = add_endpoint(writer_1, "topic", fastrtps::rtps::NOT_ALIVE_DISPOSED_UNREGISTERED);
+    CacheChange_t* reader_disposal = add_endpoint(reader_1, "topic", fastrtps::rtps::NOT_ALIVE_DISPOSED_UNREGISTERED);
+    process();
+
+    std::vector<CacheChange_t*> disposals = db_->changes_to_dispose();
+    EXPECT_EQ(2u, disposals.size());
+    EXPECT_NE(disposals.end(), std::find(disposals.begin(), disposals.end(), writer_disposal));
+    EXPECT_NE(disposals.end(), std::find(disposals.begin(), disposals.end(), reader_disposal));
+    EXPECT_EQ(std::vector<GUID_t>({writer_2}), db_->writers_of_topic("topic"));
+    EXPECT_EQ(std::vector<GUID_t>({reader_2}), db_->readers_of_topic("topic"));
+
+    // Disposing twice does not repeat the disposal
+    add_endpoint(writer_1, "topic", fastrtps::rtps::NOT_ALIVE_DISPOSED_UNREGISTERED);
+    process();
+    EXPECT_FALSE(has_duplicates(db_->changes_to_dispose()));
+
+    // Delete the entities once their disposals are sent
+    EXPECT_TRUE(db_->delete_entity_of_change(writer_disposal));
+    EXPECT_TRUE(db_->delete_entity_of_change(reader_disposal));
+    db_->clear_changes_to_dispose();
+    db_->check_consistency();
+
+    EXPECT_FALSE(db_->has_writer(writer_1));
+    EXPECT_FALSE(db_->has_reader(reader_1));
+    EXPECT_TRUE(db_->has_writer(writer_2));
+    EXPECT_TRUE(db_->has_reader(reader_2));
+    EXPECT_TRUE(db_->has_participant(client_a));
+    EXPECT_TRUE(db_->has_participant(client_b));
+    EXPECT_FALSE(db_->delete_entity_of_change(writer_disposal));
+
+    // The deleted endpoints can be discovered again
+    add_endpoint(writer_1, "topic");
+    process();
+    EXPECT_TRUE(db_->has_writer(writer_1));
+    EXPECT_EQ(2u, db_->writers_of_topic("topic").size());
+}
+
+//! Deleting a participant deletes its endpoints only
+TEST_F(DiscoveryDataBaseTests, delete_participant)
+{
+    GuidPrefix_t client_a = prefix(1);
+    GuidPrefix_t client_b = prefix(2);
+    GuidPrefix_t server = prefix(3);
+    GUID_t writer_a = endpoint(client_a, 1, true);
+    GUID_t reader_a = endpoint(client_a, 2, false);
+    GUID_t writer_b = endpoint(client_b, 1, true);
+    GUID_t reader_b = endpoint(client_b, 2, false);
+
+    add_participant(client_a, true);
+    add_participant(client_b, true);
+    add_endpoint(writer_a, "topic_1");
+    add_endpoint(reader_a, "topic_2");
+    add_endpoint(writer_b, "topic_2");
+    add_endpoint(reader_b, "topic_1");
+    process();
+
+    // A local server adds its virtual endpoints, which set every topic as dirty
+    add_participant(server, false);
+    db_->process_pdp_data_queue();
+    db_->check_consistency();
+    EXPECT_EQ(std::set<std::string>({"topic_1", "topic_2"}), db_->dirty_topics());
+    process();
+
+    // Dispose participant A
+    CacheChange_t* disposal = add_participant(client_a, true, fastrtps::rtps::NOT_ALIVE_DISPOSED_UNREGISTERED);
+    process();
+
+    EXPECT_FALSE(db_->has_writer(writer_a));
+    EXPECT_FALSE(db_->has_reader(reader_a));
+    EXPECT_TRUE(db_->has_writer(writer_b));
+    EXPECT_TRUE(db_->has_reader(reader_b));
+    EXPECT_TRUE(db_->writers_of_topic("topic_1").empty());
+    EXPECT_EQ(std::vector<GUID_t>({reader_b}), db_->readers_of_topic("topic_1"));
+    EXPECT_EQ(std::vector<CacheChange_t*>({disposal}), db_->changes_to_dispose());
+
+    EXPECT_TRUE(db_->delete_entity_of_change(disposal));
+    db_->clear_changes_to_dispose();
+    db_->check_consistency();
+
+    EXPECT_FALSE(db_->has_participant(client_a));
+    EXPECT_TRUE(db_->has_participant(client_b));
+    EXPECT_TRUE(db_->has_participant(server));
+    EXPECT_TRUE(db_->has_participant(server_prefix_));
+    std::vector<GuidPrefix_t> remote = db_->direct_clients_and_servers();
+    EXPECT_EQ(remote.end(), std::find(remote.begin(), remote.end(), client_a));
+    EXPECT_NE(remote.end(), std::find(remote.begin(), remote.end(), client_b));
+}
+
+//! Matching the topics on worker threads sends the same changes than matching them sequentially
+TEST_F(DiscoveryDataBaseTests, match_with_workers)
+{
+    std::vector<GUID_t> expected = match_topics(0);
+    EXPECT_FALSE(expected.empty());
+
+    for (uint32_t num_workers = 1; num_workers <= 4; ++num_workers)
+    {
+        EXPECT_EQ(expected, match_topics(num_workers)) << num_workers << " workers";
+    }
+
+    // A round started right after the workers does not wait for them to be running
+    for (int i = 0; i < 50; ++i)
+    {
+        db_->start_matching_workers(2, fastdds::rtps::ThreadSettings{}, 0);
+        add_endpoint(endpoint(prefix(1), 100, true), "topic_1");
+        add_endpoint(endpoint(prefix(2), 100, false), "topic_2");
+        process();
+        db_->stop_matching_workers();
+    }
+}
+
+} // namespace ddb
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
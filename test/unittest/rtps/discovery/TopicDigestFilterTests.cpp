@@ -0,0 +1,154 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <rtps/builtin/discovery/endpoint/TopicDigestFilter.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+static GUID_t make_guid(
+        uint8_t participant,
+        uint8_t entity,
+        bool is_writer)
+{
+    GUID_t guid;
+    guid.guidPrefix.value[0] = participant;
+    guid.entityId.value[0] = entity;
+    guid.entityId.value[3] = is_writer ? 0x02 : 0x07;
+    return guid;
+}
+
+static fastdds::dds::ParameterPropertyList_t digest_properties(
+        const std::vector<std::string>& topics)
+{
+    TopicDigestFilter::Digest digest{};
+    for (const std::string& topic : topics)
+    {
+        TopicDigestFilter::add_topic(digest, topic);
+    }
+
+    fastdds::dds::ParameterPropertyList_t properties;
+    properties.push_back(fastdds::dds::parameter_property_topic_digest, TopicDigestFilter::to_string(digest));
+    return properties;
+}
+
+static void set_announcement_of(
+        CacheChange_t& change,
+        const GUID_t& endpoint)
+{
+    change.kind = ALIVE;
+    change.instanceHandle = endpoint;
+}
+
+TEST(TopicDigestFilterTests, digest_string_round_trip)
+{
+    TopicDigestFilter::Digest digest{};
+    TopicDigestFilter::add_topic(digest, "rt/chatter");
+
+    TopicDigestFilter::Digest parsed{};
+    ASSERT_TRUE(TopicDigestFilter::from_string(TopicDigestFilter::to_string(digest), parsed));
+    EXPECT_EQ(digest, parsed);
+    EXPECT_TRUE(TopicDigestFilter::may_contain(parsed, "rt/chatter"));
+
+    EXPECT_FALSE(TopicDigestFilter::from_string("0123", parsed));
+    EXPECT_FALSE(TopicDigestFilter::from_string(std::string(TopicDigestFilter::digest_bits / 4, 'x'), parsed));
+}
+
+TEST(TopicDigestFilterTests, local_digest_follows_endpoints)
+{
+    TopicDigestFilter filter;
+    GUID_t writer = make_guid(1, 1, true);
+    GUID_t reader = make_guid(1, 2, false);
+
+    EXPECT_TRUE(filter.add_local_endpoint(writer, "topic_a"));
+    // Same endpoint and topic does not change the digest
+    EXPECT_FALSE(filter.add_local_endpoint(writer, "topic_a"));
+    EXPECT_TRUE(filter.add_local_endpoint(reader, "topic_b"));
+
+    TopicDigestFilter::Digest digest{};
+    ASSERT_TRUE(TopicDigestFilter::from_string(filter.local_digest(), digest));
+    EXPECT_TRUE(TopicDigestFilter::may_contain(digest, "topic_a"));
+    EXPECT_TRUE(TopicDigestFilter::may_contain(digest, "topic_b"));
+
+    EXPECT_TRUE(filter.remove_local_endpoint(reader));
+    EXPECT_FALSE(filter.remove_local_endpoint(reader));
+    ASSERT_TRUE(TopicDigestFilter::from_string(filter.local_digest(), digest));
+    EXPECT_TRUE(TopicDigestFilter::may_contain(digest, "topic_a"));
+    EXPECT_FALSE(TopicDigestFilter::may_contain(digest, "topic_b"));
+}
+
+TEST(TopicDigestFilterTests, announcements_filtered_by_remote_digest)
+{
+    TopicDigestFilter filter;
+    GUID_t writer_a = make_guid(1, 1, true);
+    GUID_t writer_b = make_guid(1, 2, true);
+    filter.add_local_endpoint(writer_a, "topic_a");
+    filter.add_local_endpoint(writer_b, "topic_b");
+
+    GUID_t remote_reader = make_guid(2, 0, false);
+    CacheChange_t change_a;
+    CacheChange_t change_b;
+    set_announcement_of(change_a, writer_a);
+    set_announcement_of(change_b, writer_b);
+
+    // Participants without digest receive everything
+    EXPECT_TRUE(filter.is_relevant(change_a, remote_reader));
+    EXPECT_TRUE(filter.is_relevant(change_b, remote_reader));
+
+    std::vector<GUID_t> newly_relevant;
+    EXPECT_FALSE(filter.update_remote_participant(remote_reader.guidPrefix, digest_properties({"topic_a"}),
+            newly_relevant));
+    EXPECT_TRUE(filter.is_relevant(change_a, remote_reader));
+    EXPECT_FALSE(filter.is_relevant(change_b, remote_reader));
+
+    // Disposals are always sent
+    change_b.kind = NOT_ALIVE_DISPOSED_UNREGISTERED;
+    EXPECT_TRUE(filter.is_relevant(change_b, remote_reader));
+    change_b.kind = ALIVE;
+
+    // A new topic on the remote participant makes the filtered announcement relevant
+    EXPECT_TRUE(filter.update_remote_participant(remote_reader.guidPrefix,
+            digest_properties({"topic_a", "topic_b"}), newly_relevant));
+    ASSERT_EQ(1u, newly_relevant.size());
+    EXPECT_EQ(writer_b, newly_relevant[0]);
+    EXPECT_TRUE(filter.is_relevant(change_b, remote_reader));
+
+    filter.remove_remote_participant(remote_reader.guidPrefix);
+    newly_relevant.clear();
+    EXPECT_FALSE(filter.update_remote_participant(remote_reader.guidPrefix, digest_properties({}),
+            newly_relevant));
+    EXPECT_FALSE(filter.is_relevant(change_a, remote_reader));
+    EXPECT_FALSE(filter.is_relevant(change_b, remote_reader));
+
+    // Stopping to announce the digest makes every announcement relevant again
+    EXPECT_TRUE(filter.update_remote_participant(remote_reader.guidPrefix, fastdds::dds::ParameterPropertyList_t(),
+            newly_relevant));
+    EXPECT_EQ(2u, newly_relevant.size());
+    EXPECT_TRUE(filter.is_relevant(change_a, remote_reader));
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -133,6 +133,8 @@ TEST_P(BasicPoolsTest, reserve_cache)
                 ASSERT_EQ(ch->serializedPayload.max_size, data_size);
                 break;
             case MemoryManagementPolicy::DYNAMIC_REUSABLE_MEMORY_MODE:
+            // Basic pools use DYNAMIC_REUSABLE_MEMORY_MODE for this policy
+            case MemoryManagementPolicy::DYNAMIC_SIZE_CLASS_MEMORY_MODE:
                 ASSERT_EQ(ch->serializedPayload.max_size, data_size);
                 break;
         }
@@ -221,7 +223,8 @@ GTEST_INSTANTIATE_TEST_MACRO(
     Values(MemoryManagementPolicy::PREALLOCATED_MEMORY_MODE,
     MemoryManagementPolicy::PREALLOCATED_WITH_REALLOC_MEMORY_MODE,
     MemoryManagementPolicy::DYNAMIC_RESERVE_MEMORY_MODE,
-    MemoryManagementPolicy::DYNAMIC_REUSABLE_MEMORY_MODE))
+    MemoryManagementPolicy::DYNAMIC_REUSABLE_MEMORY_MODE,
+    MemoryManagementPolicy::DYNAMIC_SIZE_CLASS_MEMORY_MODE))
     );
 
 int main(
@@ -68,7 +68,8 @@ TEST_P(CacheChangePoolTests, init_pool)
 {
     size_t expected_size;
     if (memory_policy == MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE ||
-            memory_policy == MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE)
+            memory_policy == MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE ||
+            memory_policy == MemoryManagementPolicy_t::DYNAMIC_SIZE_CLASS_MEMORY_MODE)
     {
         expected_size = 0;
     }
@@ -137,7 +138,8 @@ TEST_P(CacheChangePoolTests, release_cache)
         pool->reserve_cache(ch);
 
         if (memory_policy == MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE ||
-                memory_policy == MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE)
+                memory_policy == MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE ||
+                memory_policy == MemoryManagementPolicy_t::DYNAMIC_SIZE_CLASS_MEMORY_MODE)
         {
             ASSERT_EQ(pool->get_allCachesSize(), 1U);
             ASSERT_EQ(pool->get_freeCachesSize(), 0U);
@@ -155,7 +157,8 @@ TEST_P(CacheChangePoolTests, release_cache)
             ASSERT_EQ(pool->get_allCachesSize(), 0U);
             ASSERT_EQ(pool->get_freeCachesSize(), 0U);
         }
-        else if (memory_policy == MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE)
+        else if (memory_policy == MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE ||
+                memory_policy == MemoryManagementPolicy_t::DYNAMIC_SIZE_CLASS_MEMORY_MODE)
         {
             ASSERT_EQ(pool->get_allCachesSize(), 1U);
             ASSERT_EQ(pool->get_freeCachesSize(), 1U);
@@ -238,7 +241,8 @@ GTEST_INSTANTIATE_TEST_MACRO(
     Values(MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE,
     MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE,
     MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE,
-    MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE))
+    MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE,
+    MemoryManagementPolicy_t::DYNAMIC_SIZE_CLASS_MEMORY_MODE))
     );
 
 int main(
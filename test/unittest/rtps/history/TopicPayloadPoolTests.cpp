@@ -15,8 +15,11 @@
 #include <gtest/gtest.h>
 
 #include <rtps/history/TopicPayloadPool.hpp>
+#include <rtps/history/TopicPayloadPool_impl/SizeClass.hpp>
 
+#include <thread>
 #include <tuple>
+#include <vector>
 
 using namespace eprosima::fastrtps::rtps;
 using namespace ::testing;
@@ -88,6 +91,7 @@ protected:
                 break;
             case MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE:
             case MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE:
+            case MemoryManagementPolicy_t::DYNAMIC_SIZE_CLASS_MEMORY_MODE:
                 expected_pool_size = 0;
                 break;
         }
@@ -123,6 +127,8 @@ protected:
                 break;
             // This policy frees released payloads
             case MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE:
+            // This policy frees the free slabs when a history is released
+            case MemoryManagementPolicy_t::DYNAMIC_SIZE_CLASS_MEMORY_MODE:
                 expected_pool_size = 0;
                 break;
         }
@@ -171,6 +177,12 @@ protected:
                 case MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE:
                     ASSERT_GE(ch->serializedPayload.max_size, data_size);
                     break;
+                case MemoryManagementPolicy_t::DYNAMIC_SIZE_CLASS_MEMORY_MODE:
+                    // Smallest power of two class fitting the data
+                    ASSERT_GE(ch->serializedPayload.max_size, max(data_size, 64u));
+                    ASSERT_LT(ch->serializedPayload.max_size, max(2 * data_size, 65u));
+                    ASSERT_EQ(ch->serializedPayload.max_size & (ch->serializedPayload.max_size - 1), 0u);
+                    break;
             }
         }
 
@@ -488,6 +500,178 @@ TEST(TopicPayloalPoolTests, dynamic_reusable_memory_zero_size)
     do_dynamic_topic_payload_pool_zero_size_test(config);
 }
 
+//! Payloads taken and released concurrently from several threads are never lost, and the pool limits are kept
+TEST_P(TopicPayloadPoolTests, concurrent_get_release)
+{
+    constexpr uint32_t num_threads = 4u;
+    constexpr uint32_t payloads_per_thread = 50u;
+    constexpr uint32_t num_iterations = 100u;
+
+    PoolConfig config{ memory_policy, 0, num_threads * payloads_per_thread, num_threads * payloads_per_thread };
+    ASSERT_TRUE(pool->reserve_history(config, false));
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([this]()
+                {
+                    std::vector<CacheChange_t> changes(payloads_per_thread);
+                    for (uint32_t i = 0; i < num_iterations; ++i)
+                    {
+                        for (CacheChange_t& ch : changes)
+                        {
+                            EXPECT_TRUE(pool->get_payload(payload_size, ch));
+                        }
+                        for (CacheChange_t& ch : changes)
+                        {
+                            if (ch.payload_owner() == pool.get())
+                            {
+                                EXPECT_TRUE(pool->release_payload(ch));
+                            }
+                        }
+                    }
+                });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_LE(pool->payload_pool_allocated_size(), num_threads * payloads_per_thread);
+    if (memory_policy != MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE)
+    {
+        EXPECT_EQ(pool->payload_pool_available_size(), pool->payload_pool_allocated_size());
+    }
+
+    ASSERT_TRUE(pool->release_history(config, false));
+    EXPECT_EQ(pool->payload_pool_allocated_size(), 0u);
+}
+
+//! Payloads released by a thread can be taken by another one when the pool has reached its maximum size
+TEST_P(TopicPayloadPoolTests, get_payload_drains_other_thread_caches)
+{
+    constexpr uint32_t num_payloads = 12u;
+
+    PoolConfig config{ memory_policy, 0, num_payloads, num_payloads };
+    ASSERT_TRUE(pool->reserve_history(config, false));
+
+    std::vector<CacheChange_t> changes(num_payloads);
+    for (CacheChange_t& ch : changes)
+    {
+        ASSERT_TRUE(pool->get_payload(payload_size, ch));
+    }
+
+    // The payloads are kept on the cache of the releasing thread
+    std::thread releasing_thread([this, &changes]()
+            {
+                for (CacheChange_t& ch : changes)
+                {
+                    EXPECT_TRUE(pool->release_payload(ch));
+                }
+            });
+    releasing_thread.join();
+
+    for (CacheChange_t& ch : changes)
+    {
+        EXPECT_TRUE(pool->get_payload(payload_size, ch));
+    }
+    CacheChange_t exceeding;
+    EXPECT_FALSE(pool->get_payload(payload_size, exceeding));
+
+    for (CacheChange_t& ch : changes)
+    {
+        if (ch.payload_owner() == pool.get())
+        {
+            EXPECT_TRUE(pool->release_payload(ch));
+        }
+    }
+    ASSERT_TRUE(pool->release_history(config, false));
+}
+
+//! Payloads are served from the smallest class that fits them, and slabs are freed when no longer in use
+TEST(TopicPayloalPoolTests, size_class_capacities)
+{
+    PoolConfig config{ DYNAMIC_SIZE_CLASS_MEMORY_MODE, 128, 0, 0 };
+    std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+    ASSERT_TRUE(pool->reserve_history(config, false));
+
+    const std::vector<std::pair<uint32_t, uint32_t>> sizes =
+    {
+        {0u, 64u}, {1u, 64u}, {64u, 64u}, {65u, 128u}, {1000u, 1024u}, {4194304u, 4194304u}, {5000000u, 5000000u}
+    };
+
+    std::vector<CacheChange_t> changes(sizes.size());
+    for (size_t i = 0; i < sizes.size(); ++i)
+    {
+        ASSERT_TRUE(pool->get_payload(sizes[i].first, changes[i]));
+        EXPECT_EQ(changes[i].serializedPayload.max_size, sizes[i].second);
+    }
+
+    auto size_class_pool = static_cast<SizeClassTopicPayloadPool*>(pool.get());
+    std::vector<SizeClassTopicPayloadPool::SizeClassStatistics> stats = size_class_pool->get_statistics();
+    ASSERT_EQ(stats.size(), 18u);
+    EXPECT_EQ(stats[0].block_size, 64u);
+    EXPECT_EQ(stats[0].blocks_in_use, 3u);
+    EXPECT_EQ(stats[0].num_slabs, 1u);
+    EXPECT_EQ(stats[1].blocks_in_use, 1u);
+    EXPECT_EQ(stats[4].blocks_in_use, 1u);
+    EXPECT_EQ(stats[16].block_size, 4194304u);
+    EXPECT_EQ(stats[16].blocks_in_use, 1u);
+    EXPECT_EQ(stats[17].blocks_in_use, 1u);
+    EXPECT_GE(stats[17].allocated_bytes, 5000000u);
+    EXPECT_EQ(pool->payload_pool_allocated_size() - pool->payload_pool_available_size(), sizes.size());
+
+    for (CacheChange_t& change : changes)
+    {
+        ASSERT_TRUE(pool->release_payload(change));
+    }
+
+    // Individually allocated payloads are freed on release, and a free slab is kept per class
+    stats = size_class_pool->get_statistics();
+    EXPECT_EQ(stats[17].num_slabs, 0u);
+    EXPECT_EQ(stats[0].num_slabs, 1u);
+    EXPECT_EQ(stats[0].blocks_in_use, 0u);
+    EXPECT_EQ(pool->payload_pool_available_size(), pool->payload_pool_allocated_size());
+
+    EXPECT_EQ(size_class_pool->trim(), 4u);
+    EXPECT_EQ(pool->payload_pool_allocated_size(), 0u);
+
+    ASSERT_TRUE(pool->release_history(config, false));
+}
+
+//! The maximum number of payloads in use is limited by the reserved histories
+TEST(TopicPayloalPoolTests, size_class_maximum)
+{
+    PoolConfig config{ DYNAMIC_SIZE_CLASS_MEMORY_MODE, 128, 0, 3 };
+    std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+    ASSERT_TRUE(pool->reserve_history(config, false));
+
+    std::vector<CacheChange_t> changes(4);
+    ASSERT_TRUE(pool->get_payload(100, changes[0]));
+    ASSERT_TRUE(pool->get_payload(10000, changes[1]));
+    ASSERT_TRUE(pool->get_payload(100, changes[2]));
+    ASSERT_FALSE(pool->get_payload(100, changes[3]));
+
+    ASSERT_TRUE(pool->release_payload(changes[1]));
+    ASSERT_TRUE(pool->get_payload(100, changes[3]));
+
+    // Share a payload with another change
+    changes[1].writerGUID = GUID_t(GuidPrefix_t(), 1);
+    changes[1].sequenceNumber = SequenceNumber_t(0, 1);
+    IPayloadPool* owner = pool.get();
+    ASSERT_TRUE(pool->get_payload(changes[0].serializedPayload, owner, changes[1]));
+    EXPECT_EQ(changes[1].serializedPayload.data, changes[0].serializedPayload.data);
+
+    for (CacheChange_t& change : changes)
+    {
+        ASSERT_TRUE(pool->release_payload(change));
+    }
+
+    ASSERT_TRUE(pool->release_history(config, false));
+    EXPECT_EQ(pool->payload_pool_allocated_size(), 0u);
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_SUITE_P(x, y, z)
 #else
@@ -503,7 +687,8 @@ GTEST_INSTANTIATE_TEST_MACRO(
     Values(MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE,
     MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE,
     MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE,
-    MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE))
+    MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE,
+    MemoryManagementPolicy_t::DYNAMIC_SIZE_CLASS_MEMORY_MODE))
     );
 
 int main(
@@ -0,0 +1,198 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <unordered_set>
+
+#include <gtest/gtest.h>
+
+#include <rtps/messages/MatchedReadersIndex.hpp>
+#include <utils/hash.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class MatchedReadersIndexTests : public ::testing::Test
+{
+protected:
+
+    static GUID_t writer_guid(
+            uint8_t participant,
+            uint8_t writer)
+    {
+        GUID_t guid;
+        guid.guidPrefix.value[0] = participant;
+        guid.entityId.value[2] = writer;
+        guid.entityId.value[3] = 0x03;
+        return guid;
+    }
+
+    static EntityId_t reader_id(
+            size_t index)
+    {
+        EntityId_t id;
+        id.value[2] = static_cast<octet>(index);
+        id.value[3] = 0x04;
+        return id;
+    }
+
+    //! The index only stores the pointers, so the readers are stood for by distinct addresses
+    RTPSReader* reader(
+            size_t index)
+    {
+        return reinterpret_cast<RTPSReader*>(&readers_[index]);
+    }
+
+    //! Readers on the list of a writer, in order
+    std::vector<RTPSReader*> readers_of(
+            const GUID_t& writer)
+    {
+        std::vector<RTPSReader*> ret;
+        auto list = index_.find(writer);
+        if (list)
+        {
+            for (const MatchedReadersIndex::Entry& entry : *list)
+            {
+                EXPECT_EQ(reader_id(static_cast<size_t>(reinterpret_cast<char*>(entry.reader) - readers_)),
+                        entry.entity_id);
+                ret.push_back(entry.reader);
+            }
+        }
+        return ret;
+    }
+
+    MatchedReadersIndex index_;
+    char readers_[8] = {};
+};
+
+TEST_F(MatchedReadersIndexTests, add_and_find)
+{
+    GUID_t writer_1 = writer_guid(1, 1);
+    GUID_t writer_2 = writer_guid(2, 1);
+
+    EXPECT_EQ(nullptr, index_.find(writer_1));
+
+    index_.add(writer_1, reader_id(0), reader(0));
+    index_.add(writer_1, reader_id(1), reader(1));
+    index_.add(writer_2, reader_id(1), reader(1));
+
+    // Adding an existing match does not duplicate it
+    index_.add(writer_1, reader_id(0), reader(0));
+
+    EXPECT_EQ(std::vector<RTPSReader*>({reader(0), reader(1)}), readers_of(writer_1));
+    EXPECT_EQ(std::vector<RTPSReader*>({reader(1)}), readers_of(writer_2));
+    EXPECT_EQ(nullptr, index_.find(writer_guid(1, 2)));
+}
+
+TEST_F(MatchedReadersIndexTests, remove_keeps_other_entries)
+{
+    GUID_t writer_1 = writer_guid(1, 1);
+    GUID_t writer_2 = writer_guid(2, 1);
+
+    index_.add(writer_1, reader_id(0), reader(0));
+    index_.add(writer_1, reader_id(1), reader(1));
+    index_.add(writer_1, reader_id(2), reader(2));
+    index_.add(writer_2, reader_id(1), reader(1));
+
+    index_.remove(writer_1, reader(1));
+    EXPECT_EQ(std::vector<RTPSReader*>({reader(0), reader(2)}), readers_of(writer_1));
+    EXPECT_EQ(std::vector<RTPSReader*>({reader(1)}), readers_of(writer_2));
+
+    // Removing a match that does not exist has no effect
+    index_.remove(writer_1, reader(1));
+    index_.remove(writer_guid(3, 1), reader(0));
+    EXPECT_EQ(std::vector<RTPSReader*>({reader(0), reader(2)}), readers_of(writer_1));
+
+    // Removing the last reader of a writer removes its entry
+    index_.remove(writer_2, reader(1));
+    EXPECT_EQ(nullptr, index_.find(writer_2));
+    EXPECT_EQ(std::vector<RTPSReader*>({reader(0), reader(2)}), readers_of(writer_1));
+}
+
+TEST_F(MatchedReadersIndexTests, remove_reader)
+{
+    GUID_t writer_1 = writer_guid(1, 1);
+    GUID_t writer_2 = writer_guid(2, 1);
+    GUID_t writer_3 = writer_guid(3, 1);
+
+    index_.add(writer_1, reader_id(0), reader(0));
+    index_.add(writer_1, reader_id(1), reader(1));
+    index_.add(writer_2, reader_id(1), reader(1));
+    index_.add(writer_3, reader_id(2), reader(2));
+
+    index_.remove_reader(reader(1));
+    EXPECT_EQ(std::vector<RTPSReader*>({reader(0)}), readers_of(writer_1));
+    EXPECT_EQ(nullptr, index_.find(writer_2));
+    EXPECT_EQ(std::vector<RTPSReader*>({reader(2)}), readers_of(writer_3));
+}
+
+//! Lists returned by find are snapshots not affected by later changes
+TEST_F(MatchedReadersIndexTests, find_returns_snapshot)
+{
+    GUID_t writer = writer_guid(1, 1);
+
+    index_.add(writer, reader_id(0), reader(0));
+    index_.add(writer, reader_id(1), reader(1));
+    auto snapshot = index_.find(writer);
+
+    index_.remove(writer, reader(0));
+    index_.add(writer, reader_id(2), reader(2));
+
+    ASSERT_EQ(2u, snapshot->size());
+    EXPECT_EQ(reader(0), snapshot->at(0).reader);
+    EXPECT_EQ(reader(1), snapshot->at(1).reader);
+    EXPECT_EQ(std::vector<RTPSReader*>({reader(1), reader(2)}), readers_of(writer));
+}
+
+TEST(GuidHashTests, hash_uses_the_whole_guid)
+{
+    GuidHash hasher;
+
+    GUID_t guid;
+    guid.guidPrefix.value[0] = 1;
+    guid.entityId.value[3] = 0x03;
+    GUID_t same = guid;
+    EXPECT_EQ(hasher(guid), hasher(same));
+
+    // Entities of different participants only differ on the prefix, and entities of the same participant on the
+    // entity id, so every byte has to be taken into account
+    std::unordered_set<size_t> hashes;
+    for (uint8_t i = 0; i < GuidPrefix_t::size; ++i)
+    {
+        GUID_t other = guid;
+        other.guidPrefix.value[i] ^= 0x10;
+        EXPECT_NE(guid, other);
+        hashes.insert(hasher(other));
+    }
+    for (uint8_t i = 0; i < EntityId_t::size; ++i)
+    {
+        GUID_t other = guid;
+        other.entityId.value[i] ^= 0x10;
+        hashes.insert(hasher(other));
+    }
+    hashes.insert(hasher(guid));
+    EXPECT_EQ(static_cast<size_t>(GuidPrefix_t::size + EntityId_t::size + 1), hashes.size());
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
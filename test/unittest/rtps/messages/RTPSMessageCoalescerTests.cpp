@@ -0,0 +1,369 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/messages/RTPS_messages.h>
+#include <fastdds/rtps/resources/ResourceEvent.h>
+#include <fastdds/rtps/transport/SenderResource.h>
+
+#include <rtps/messages/RTPSMessageCoalescer.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+using steady_clock = std::chrono::steady_clock;
+
+struct SentDatagram
+{
+    std::vector<octet> data;
+    Locator_t locator;
+    steady_clock::time_point max_blocking_time_point;
+};
+
+//! Sender resource keeping the datagrams sent through it
+class RecordingSenderResource : public SenderResource
+{
+public:
+
+    explicit RecordingSenderResource(
+            std::vector<SentDatagram>& sent)
+        : SenderResource(LOCATOR_KIND_UDPv4)
+    {
+        send_lambda_ = [&sent](
+            const octet* data,
+            uint32_t length,
+            LocatorsIterator* destination_locators_begin,
+            LocatorsIterator* destination_locators_end,
+            const steady_clock::time_point& max_blocking_time_point) -> bool
+                {
+                    for (; *destination_locators_begin != *destination_locators_end; ++(*destination_locators_begin))
+                    {
+                        sent.push_back({std::vector<octet>(data, data + length), **destination_locators_begin,
+                                        max_blocking_time_point});
+                    }
+                    return true;
+                };
+    }
+
+};
+
+class RTPSMessageCoalescerTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        event_thread_.init_thread();
+        send_resources_.emplace_back(new RecordingSenderResource(sent_));
+        locators_.resize(2);
+        locators_[0].kind = LOCATOR_KIND_UDPv4;
+        locators_[0].port = 7400;
+        locators_[1].kind = LOCATOR_KIND_UDPv4;
+        locators_[1].port = 7401;
+    }
+
+    void TearDown() override
+    {
+        coalescer_.reset();
+    }
+
+    void create_coalescer(
+            const std::chrono::microseconds& linger,
+            uint32_t max_datagram_size,
+            uint32_t max_message_size)
+    {
+        coalescer_.reset(new RTPSMessageCoalescer(event_thread_,
+                [this]()
+                {
+                    std::lock_guard<std::mutex> guard(mutex_);
+                    coalescer_->flush_all_nts(send_resources_);
+                    cv_.notify_all();
+                },
+                linger, max_datagram_size, max_message_size));
+    }
+
+    //! Add a message to the coalescer, as the participant does on sendSync
+    bool add(
+            const CDRMessage_t& msg,
+            size_t locator_index,
+            const steady_clock::time_point& max_blocking_time_point = steady_clock::now() + std::chrono::seconds(1))
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto begin = locators_.cbegin() + locator_index;
+        return coalescer_->add_message_nts(&msg, begin, begin + 1, send_resources_, max_blocking_time_point);
+    }
+
+    void flush()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        coalescer_->flush_all_nts(send_resources_);
+    }
+
+    size_t num_sent()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return sent_.size();
+    }
+
+    static CDRMessage_t new_message()
+    {
+        CDRMessage_t msg(RTPSMESSAGE_DEFAULT_SIZE);
+        const octet header[RTPSMESSAGE_HEADER_SIZE] =
+        {'R', 'T', 'P', 'S', 2, 3, 1, 15, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+        memcpy(msg.buffer, header, RTPSMESSAGE_HEADER_SIZE);
+        msg.pos = RTPSMESSAGE_HEADER_SIZE;
+        msg.length = RTPSMESSAGE_HEADER_SIZE;
+        return msg;
+    }
+
+    static void add_submessage(
+            CDRMessage_t& msg,
+            octet id,
+            const std::vector<octet>& body)
+    {
+        msg.buffer[msg.pos] = id;
+        msg.buffer[msg.pos + 1] = 0x01;
+        msg.buffer[msg.pos + 2] = static_cast<octet>(body.size() & 0xFF);
+        msg.buffer[msg.pos + 3] = static_cast<octet>(body.size() >> 8);
+        memcpy(&msg.buffer[msg.pos + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE], body.data(), body.size());
+        msg.pos += RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + static_cast<uint32_t>(body.size());
+        msg.length = msg.pos;
+    }
+
+    static void add_info_dst(
+            CDRMessage_t& msg,
+            octet destination)
+    {
+        std::vector<octet> prefix(GuidPrefix_t::size, 0);
+        prefix[0] = destination;
+        add_submessage(msg, INFO_DST, prefix);
+    }
+
+    //! A submessage standing for the contents sent by an endpoint
+    static void add_payload(
+            CDRMessage_t& msg,
+            octet endpoint,
+            size_t size = 4)
+    {
+        add_submessage(msg, PAD, std::vector<octet>(size, endpoint));
+    }
+
+    ResourceEvent event_thread_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<SentDatagram> sent_;
+    fastdds::rtps::SendResourceList send_resources_;
+    std::vector<Locator_t> locators_;
+    std::unique_ptr<RTPSMessageCoalescer> coalescer_;
+};
+
+//! Messages from different endpoints to the same locator are sent on a single datagram
+TEST_F(RTPSMessageCoalescerTests, concatenates_messages_of_different_writers)
+{
+    create_coalescer(std::chrono::seconds(10), 1024, 512);
+
+    CDRMessage_t writer_1 = new_message();
+    add_payload(writer_1, 1);
+    CDRMessage_t writer_2 = new_message();
+    add_payload(writer_2, 2);
+    CDRMessage_t writer_3 = new_message();
+    add_payload(writer_3, 3);
+
+    EXPECT_TRUE(add(writer_1, 0));
+    EXPECT_TRUE(add(writer_2, 0));
+    EXPECT_TRUE(add(writer_3, 1));
+    EXPECT_EQ(0u, num_sent());
+
+    flush();
+    ASSERT_EQ(2u, sent_.size());
+
+    // Datagrams to different locators are not sent in any particular order
+    if (locators_[0] != sent_[0].locator)
+    {
+        std::swap(sent_[0], sent_[1]);
+    }
+
+    std::vector<octet> expected(writer_1.buffer, writer_1.buffer + writer_1.length);
+    expected.insert(expected.end(), writer_2.buffer + RTPSMESSAGE_HEADER_SIZE, writer_2.buffer + writer_2.length);
+    EXPECT_EQ(locators_[0], sent_[0].locator);
+    EXPECT_EQ(expected, sent_[0].data);
+
+    EXPECT_EQ(locators_[1], sent_[1].locator);
+    EXPECT_EQ(std::vector<octet>(writer_3.buffer, writer_3.buffer + writer_3.length), sent_[1].data);
+
+    // Nothing is left to be sent
+    flush();
+    EXPECT_EQ(2u, sent_.size());
+}
+
+//! Messages are only appended when the destination prefix left by the datagram is the one they expect
+TEST_F(RTPSMessageCoalescerTests, keeps_info_dst_compatibility)
+{
+    create_coalescer(std::chrono::seconds(10), 1024, 512);
+
+    CDRMessage_t to_reader_1 = new_message();
+    add_info_dst(to_reader_1, 1);
+    add_payload(to_reader_1, 1);
+    CDRMessage_t to_reader_2 = new_message();
+    add_info_dst(to_reader_2, 2);
+    add_payload(to_reader_2, 2);
+    CDRMessage_t to_all = new_message();
+    add_payload(to_all, 3);
+
+    // Both messages set their own destination, so they can share a datagram
+    EXPECT_TRUE(add(to_reader_1, 0));
+    EXPECT_TRUE(add(to_reader_2, 0));
+    EXPECT_EQ(0u, num_sent());
+
+    // This message was built for a receiver without destination prefix, so the datagram is sent first
+    EXPECT_TRUE(add(to_all, 0));
+    ASSERT_EQ(1u, num_sent());
+    EXPECT_EQ(to_reader_1.length + to_reader_2.length - RTPSMESSAGE_HEADER_SIZE, sent_[0].data.size());
+
+    // A message without destination can be followed by one setting its destination
+    EXPECT_TRUE(add(to_reader_1, 0));
+    flush();
+    ASSERT_EQ(2u, sent_.size());
+    EXPECT_EQ(to_all.length + to_reader_1.length - RTPSMESSAGE_HEADER_SIZE, sent_[1].data.size());
+}
+
+//! Big messages are never delayed, and datagrams never exceed the maximum size
+TEST_F(RTPSMessageCoalescerTests, respects_size_limits)
+{
+    create_coalescer(std::chrono::seconds(10), 64, 50);
+
+    CDRMessage_t small = new_message();
+    add_payload(small, 1, 24);
+    CDRMessage_t big = new_message();
+    add_payload(big, 2, 30);
+    ASSERT_EQ(48u, small.length);
+    ASSERT_EQ(54u, big.length);
+
+    EXPECT_TRUE(add(small, 0));
+    EXPECT_EQ(0u, num_sent());
+
+    // The second small message does not fit, so the pending datagram is sent before queueing it
+    EXPECT_TRUE(add(small, 0));
+    ASSERT_EQ(1u, num_sent());
+    EXPECT_EQ(small.length, sent_[0].data.size());
+
+    // Messages bigger than the maximum message size flush the locator and are sent by the caller
+    EXPECT_FALSE(add(big, 0));
+    ASSERT_EQ(2u, num_sent());
+    EXPECT_EQ(small.length, sent_[1].data.size());
+
+    flush();
+    EXPECT_EQ(2u, sent_.size());
+}
+
+//! Pending datagrams are sent when the linger period expires, with the deadline of the queued messages
+TEST_F(RTPSMessageCoalescerTests, sends_on_linger_expiration)
+{
+    create_coalescer(std::chrono::milliseconds(20), 1024, 512);
+
+    CDRMessage_t msg = new_message();
+    add_payload(msg, 1);
+
+    steady_clock::time_point first_deadline = steady_clock::now() + std::chrono::milliseconds(200);
+    EXPECT_TRUE(add(msg, 0, first_deadline + std::chrono::milliseconds(100)));
+    EXPECT_TRUE(add(msg, 0, first_deadline));
+    EXPECT_TRUE(add(msg, 0, first_deadline + std::chrono::milliseconds(200)));
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ASSERT_TRUE(cv_.wait_for(lock, std::chrono::seconds(5), [this]()
+                {
+                    return !sent_.empty();
+                }));
+    }
+
+    ASSERT_EQ(1u, sent_.size());
+    EXPECT_EQ(3 * msg.length - 2 * RTPSMESSAGE_HEADER_SIZE, sent_[0].data.size());
+    EXPECT_EQ(first_deadline, sent_[0].max_blocking_time_point);
+
+    // The timer is armed again for new messages
+    EXPECT_TRUE(add(msg, 1));
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ASSERT_TRUE(cv_.wait_for(lock, std::chrono::seconds(5), [this]()
+                {
+                    return 2u == sent_.size();
+                }));
+    }
+    EXPECT_EQ(locators_[1], sent_[1].locator);
+}
+
+//! The buffer of a destination is released once it has been idle during several linger periods
+TEST_F(RTPSMessageCoalescerTests, releases_idle_datagrams)
+{
+    create_coalescer(std::chrono::seconds(10), 1024, 512);
+
+    CDRMessage_t msg = new_message();
+    add_payload(msg, 1);
+
+    EXPECT_TRUE(add(msg, 0));
+    EXPECT_TRUE(add(msg, 1));
+    flush();
+    ASSERT_EQ(2u, sent_.size());
+
+    // Only the first locator keeps receiving messages
+    for (uint32_t i = 0; i < RTPSMessageCoalescer::max_idle_flushes; ++i)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        EXPECT_EQ(2u, coalescer_->num_datagrams_nts());
+        EXPECT_TRUE(coalescer_->add_message_nts(&msg, locators_.cbegin(), locators_.cbegin() + 1, send_resources_,
+                steady_clock::now() + std::chrono::seconds(1)));
+        coalescer_->flush_all_nts(send_resources_);
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        EXPECT_EQ(1u, coalescer_->num_datagrams_nts());
+    }
+
+    // A released destination gets a new buffer when used again
+    EXPECT_TRUE(add(msg, 1));
+    flush();
+    ASSERT_EQ(3u + RTPSMessageCoalescer::max_idle_flushes, sent_.size());
+    EXPECT_EQ(locators_[1], sent_.back().locator);
+    EXPECT_EQ(std::vector<octet>(msg.buffer, msg.buffer + msg.length), sent_.back().data);
+
+    // Without traffic, all the buffers are eventually released
+    for (uint32_t i = 0; i < RTPSMessageCoalescer::max_idle_flushes; ++i)
+    {
+        flush();
+    }
+    std::lock_guard<std::mutex> guard(mutex_);
+    EXPECT_EQ(0u, coalescer_->num_datagrams_nts());
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,282 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/reader/RTPSReader.h>
+
+#include <rtps/messages/ReceiveDispatcher.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class TestReader : public RTPSReader
+{
+public:
+
+    explicit TestReader(
+            uint8_t id)
+    {
+        m_guid.entityId.value[2] = id;
+        m_guid.entityId.value[3] = 0x04;
+    }
+
+    bool matched_writer_add(
+            const WriterProxyData&) override
+    {
+        return true;
+    }
+
+    bool matched_writer_remove(
+            const GUID_t&,
+            bool) override
+    {
+        return true;
+    }
+
+    bool matched_writer_is_matched(
+            const GUID_t&) override
+    {
+        return false;
+    }
+
+};
+
+//! A gate tasks can wait on
+class Gate
+{
+public:
+
+    void open()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        open_ = true;
+        cv_.notify_all();
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]()
+                {
+                    return open_;
+                });
+    }
+
+    bool wait_for(
+            const std::chrono::milliseconds& timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [this]()
+                       {
+                           return open_;
+                       });
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool open_ = false;
+};
+
+class ReceiveDispatcherTests : public ::testing::Test
+{
+protected:
+
+    void create_dispatcher(
+            uint32_t max_queued_tasks)
+    {
+        dispatcher_.reset(new ReceiveDispatcher(1, max_queued_tasks, fastdds::rtps::ThreadSettings{}, 0));
+    }
+
+    //! Push a task that blocks the worker until the returned gate is opened
+    void block_worker(
+            RTPSReader* reader,
+            Gate& started,
+            Gate& release)
+    {
+        dispatcher_->push(reader, [&started, &release]()
+                {
+                    started.open();
+                    release.wait();
+                });
+        ASSERT_TRUE(started.wait_for(std::chrono::seconds(5)));
+    }
+
+    //! Push a task recording its identifier when executed
+    void push_recorded(
+            RTPSReader* reader,
+            int id)
+    {
+        dispatcher_->push(reader, [this, id]()
+                {
+                    std::lock_guard<std::mutex> guard(executed_mutex_);
+                    executed_.push_back(id);
+                });
+    }
+
+    //! Wait until the tasks pushed before this call have been executed
+    void wait_idle(
+            RTPSReader* reader)
+    {
+        Gate done;
+        dispatcher_->push(reader, [&done]()
+                {
+                    done.open();
+                });
+        ASSERT_TRUE(done.wait_for(std::chrono::seconds(5)));
+    }
+
+    std::vector<int> executed()
+    {
+        std::lock_guard<std::mutex> guard(executed_mutex_);
+        return executed_;
+    }
+
+    TestReader reader_a_{1};
+    TestReader reader_b_{2};
+    std::unique_ptr<ReceiveDispatcher> dispatcher_;
+    std::mutex executed_mutex_;
+    std::vector<int> executed_;
+};
+
+//! Pushing on a full queue does not block, and discards the oldest task
+TEST_F(ReceiveDispatcherTests, full_queue_discards_oldest_task)
+{
+    create_dispatcher(2);
+
+    Gate started;
+    Gate release;
+    block_worker(&reader_a_, started, release);
+
+    Gate done;
+    auto pushed = std::async(std::launch::async, [this, &done]()
+                    {
+                        push_recorded(&reader_a_, 1);
+                        push_recorded(&reader_b_, 2);
+                        push_recorded(&reader_a_, 3);
+                        dispatcher_->push(&reader_b_, [&done]()
+                        {
+                            done.open();
+                        });
+                    });
+    ASSERT_EQ(std::future_status::ready, pushed.wait_for(std::chrono::seconds(5)));
+
+    release.open();
+    ASSERT_TRUE(done.wait_for(std::chrono::seconds(5)));
+    EXPECT_EQ(std::vector<int>({3}), executed());
+    EXPECT_EQ(2u, dispatcher_->dropped_tasks());
+
+    // Tasks are not discarded while the queue has room
+    push_recorded(&reader_b_, 4);
+    wait_idle(&reader_a_);
+    EXPECT_EQ(std::vector<int>({3, 4}), executed());
+    EXPECT_EQ(2u, dispatcher_->dropped_tasks());
+}
+
+//! Removing a reader discards its tasks and waits for the running one
+TEST_F(ReceiveDispatcherTests, remove_reader_while_running)
+{
+    create_dispatcher(16);
+
+    Gate started;
+    Gate release;
+    block_worker(&reader_a_, started, release);
+    push_recorded(&reader_a_, 1);
+    push_recorded(&reader_b_, 2);
+
+    auto removed = std::async(std::launch::async, [this]()
+                    {
+                        dispatcher_->remove_reader(&reader_a_);
+                    });
+    EXPECT_EQ(std::future_status::timeout, removed.wait_for(std::chrono::milliseconds(100)));
+
+    release.open();
+    ASSERT_EQ(std::future_status::ready, removed.wait_for(std::chrono::seconds(5)));
+
+    wait_idle(&reader_b_);
+    EXPECT_EQ(std::vector<int>({2}), executed());
+}
+
+//! A task can remove its own reader, as a listener deleting it would do
+TEST_F(ReceiveDispatcherTests, remove_reader_from_its_task)
+{
+    create_dispatcher(16);
+
+    Gate go;
+    Gate removed;
+    dispatcher_->push(&reader_a_, [this, &go, &removed]()
+            {
+                go.wait();
+                dispatcher_->remove_reader(&reader_a_);
+                removed.open();
+            });
+    push_recorded(&reader_a_, 1);
+    go.open();
+    ASSERT_TRUE(removed.wait_for(std::chrono::seconds(5)));
+
+    wait_idle(&reader_b_);
+    EXPECT_TRUE(executed().empty());
+}
+
+//! Destroying the dispatcher waits for the running task and discards the queued ones
+TEST_F(ReceiveDispatcherTests, shutdown_with_queued_tasks)
+{
+    create_dispatcher(16);
+
+    Gate started;
+    Gate release;
+    std::atomic<bool> finished{false};
+    dispatcher_->push(&reader_a_, [&]()
+            {
+                started.open();
+                release.wait();
+                finished = true;
+            });
+    ASSERT_TRUE(started.wait_for(std::chrono::seconds(5)));
+    push_recorded(&reader_a_, 1);
+    push_recorded(&reader_b_, 2);
+
+    auto destroyed = std::async(std::launch::async, [this]()
+                    {
+                        dispatcher_.reset();
+                    });
+    EXPECT_EQ(std::future_status::timeout, destroyed.wait_for(std::chrono::milliseconds(100)));
+
+    release.open();
+    ASSERT_EQ(std::future_status::ready, destroyed.wait_for(std::chrono::seconds(5)));
+    EXPECT_TRUE(finished);
+    EXPECT_TRUE(executed().empty());
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
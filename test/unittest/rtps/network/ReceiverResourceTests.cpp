@@ -0,0 +1,229 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/messages/MessageReceiver.h>
+#include <MockTransport.h>
+#include <rtps/network/ReceiverResource.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Only the NetworkFactory is allowed to build receiver resources.
+ * As it is not linked on this test, this one just gives access to the constructor.
+ */
+class NetworkFactory
+{
+public:
+
+    static std::unique_ptr<ReceiverResource> create_receiver_resource(
+            TransportInterface& transport,
+            const Locator_t& locator)
+    {
+        return std::unique_ptr<ReceiverResource>(new ReceiverResource(transport, locator, 65500));
+    }
+
+};
+
+//! Message receiver blocking inside the callback until released
+class BlockingMessageReceiver : public MessageReceiver
+{
+public:
+
+    BlockingMessageReceiver()
+        : MessageReceiver(nullptr, nullptr)
+    {
+    }
+
+    void processCDRMsg(
+            const Locator_t&,
+            const Locator_t&,
+            CDRMessage_t*) override
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ++received_;
+        running_ = true;
+        cv_.notify_all();
+        cv_.wait(lock, [this]()
+                {
+                    return released_;
+                });
+        running_ = false;
+    }
+
+    bool wait_running()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, std::chrono::seconds(5), [this]()
+                       {
+                           return running_;
+                       });
+    }
+
+    void release()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        released_ = true;
+        cv_.notify_all();
+    }
+
+    bool running()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return running_;
+    }
+
+    uint32_t received()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return received_;
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool running_ = false;
+    bool released_ = false;
+    uint32_t received_ = 0;
+};
+
+class ReceiverResourceTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        locator_.kind = MockTransport::DefaultKind;
+        locator_.port = 7400;
+        resource_ = NetworkFactory::create_receiver_resource(transport_, locator_);
+        resource_->RegisterReceiver(&receiver_);
+    }
+
+    void TearDown() override
+    {
+        receiver_.release();
+        resource_->disable();
+    }
+
+    //! Receive a datagram on a transport thread
+    std::future<void> receive()
+    {
+        return std::async(std::launch::async, [this]()
+                       {
+                           octet data[4] = {};
+                           resource_->OnDataReceived(data, sizeof(data), locator_, locator_);
+                       });
+    }
+
+    MockTransport transport_;
+    Locator_t locator_;
+    BlockingMessageReceiver receiver_;
+    std::unique_ptr<ReceiverResource> resource_;
+};
+
+//! Unregistering the receiver waits for the callbacks using it
+TEST_F(ReceiverResourceTests, unregister_while_callback_running)
+{
+    auto callback = receive();
+    ASSERT_TRUE(receiver_.wait_running());
+
+    auto unregistered = std::async(std::launch::async, [this]()
+                    {
+                        resource_->UnregisterReceiver(&receiver_);
+                    });
+    EXPECT_EQ(std::future_status::timeout, unregistered.wait_for(std::chrono::milliseconds(100)));
+
+    receiver_.release();
+    ASSERT_EQ(std::future_status::ready, unregistered.wait_for(std::chrono::seconds(5)));
+    EXPECT_FALSE(receiver_.running());
+    ASSERT_EQ(std::future_status::ready, callback.wait_for(std::chrono::seconds(5)));
+
+    // Data received afterwards does not reach the receiver
+    receive().get();
+    EXPECT_EQ(1u, receiver_.received());
+}
+
+//! Unregistering a receiver which is not the registered one neither waits nor unregisters anything
+TEST_F(ReceiverResourceTests, unregister_other_receiver)
+{
+    auto callback = receive();
+    ASSERT_TRUE(receiver_.wait_running());
+
+    BlockingMessageReceiver other;
+    resource_->UnregisterReceiver(&other);
+    EXPECT_TRUE(receiver_.running());
+
+    receiver_.release();
+    callback.get();
+    receive().get();
+    EXPECT_EQ(2u, receiver_.received());
+}
+
+//! Unregistering the receiver does not wait for callbacks started afterwards
+TEST_F(ReceiverResourceTests, unregister_ignores_later_callbacks)
+{
+    auto callback = receive();
+    ASSERT_TRUE(receiver_.wait_running());
+
+    auto unregistered = std::async(std::launch::async, [this]()
+                    {
+                        resource_->UnregisterReceiver(&receiver_);
+                    });
+    EXPECT_EQ(std::future_status::timeout, unregistered.wait_for(std::chrono::milliseconds(100)));
+
+    // A callback on a receiver registered after the previous one was cleared keeps running
+    BlockingMessageReceiver other;
+    resource_->RegisterReceiver(&other);
+    auto later_callback = receive();
+    ASSERT_TRUE(other.wait_running());
+
+    receiver_.release();
+    ASSERT_EQ(std::future_status::ready, unregistered.wait_for(std::chrono::seconds(5)));
+    ASSERT_EQ(std::future_status::ready, callback.wait_for(std::chrono::seconds(5)));
+    EXPECT_TRUE(other.running());
+
+    // Disabling waits for every callback
+    auto disabled = std::async(std::launch::async, [this]()
+                    {
+                        resource_->disable();
+                    });
+    EXPECT_EQ(std::future_status::timeout, disabled.wait_for(std::chrono::milliseconds(100)));
+
+    other.release();
+    ASSERT_EQ(std::future_status::ready, disabled.wait_for(std::chrono::seconds(5)));
+    ASSERT_EQ(std::future_status::ready, later_callback.wait_for(std::chrono::seconds(5)));
+    EXPECT_EQ(1u, other.received());
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <limits>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -21,6 +23,7 @@
     FRIEND_TEST(WriterProxyTests, ReceivedChangeSet); \
     FRIEND_TEST(WriterProxyTests, IrrelevantChangeSet);
 
+#include <rtps/reader/FragmentReassemblyBudget.hpp>
 #include <rtps/reader/WriterProxy.h>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <fastrtps/rtps/reader/RTPSReader.h>
@@ -687,6 +690,42 @@ TEST(WriterProxyTests, IrrelevantChangeSet)
     ASSERT_EQ(wproxy.unknown_missing_changes_up_to(SequenceNumber_t(0, 9)), 0u);
 }
 
+TEST(WriterProxyTests, FragmentReassemblyLimits)
+{
+    FragmentReassemblyBudget budget(1000u, 2u);
+    EXPECT_TRUE(budget.try_reserve(600u));
+    EXPECT_FALSE(budget.try_reserve(500u));
+    EXPECT_TRUE(budget.try_reserve(400u));
+    EXPECT_FALSE(budget.try_reserve(1u));
+    EXPECT_EQ(1000u, budget.used_bytes());
+    budget.release(600u);
+    EXPECT_TRUE(budget.try_reserve(500u));
+    EXPECT_FALSE(budget.try_reserve(1001u));
+    EXPECT_EQ(900u, budget.used_bytes());
+
+    FragmentReassemblyBudget unlimited(0u, 0u);
+    EXPECT_TRUE(unlimited.try_reserve(std::numeric_limits<uint32_t>::max()));
+
+    WriterProxyData wattr(4u, 1u);
+    StatefulReader readerMock;
+    WriterProxy wproxy(&readerMock, RemoteLocatorsAllocationAttributes(), ResourceLimitedContainerConfig());
+    wproxy.start(wattr, SequenceNumber_t());
+
+    EXPECT_EQ(0u, wproxy.fragmented_changes_in_flight());
+    wproxy.fragmented_change_started();
+    wproxy.fragmented_change_started();
+    EXPECT_EQ(2u, wproxy.fragmented_changes_in_flight());
+    wproxy.fragmented_change_finished();
+    EXPECT_EQ(1u, wproxy.fragmented_changes_in_flight());
+
+    // Counter is reset when the proxy is reused for another writer
+    wproxy.stop();
+    wproxy.start(wattr, SequenceNumber_t());
+    EXPECT_EQ(0u, wproxy.fragmented_changes_in_flight());
+    wproxy.fragmented_change_finished();
+    EXPECT_EQ(0u, wproxy.fragmented_changes_in_flight());
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
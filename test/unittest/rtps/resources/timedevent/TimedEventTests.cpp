@@ -221,6 +221,30 @@ TEST(TimedEvent, Event_AutoRestart)
     ASSERT_GE(successed, 100);
 }
 
+/*!
+ * @fn TEST(TimedEvent, Event_LongAndShortEvents)
+ * @brief This test checks an event with an interval longer than a turn of the timing wheel is triggered on time.
+ * This test launches a long event together with a short event that restarts itself, so the slots of the wheel are
+ * visited several times before the long event expires.
+ */
+TEST(TimedEvent, Event_LongAndShortEvents)
+{
+    MockEvent long_event(*env->service_, 1500, false);
+    MockEvent short_event(*env->service_, 10, true);
+
+    auto start = std::chrono::steady_clock::now();
+    long_event.event().restart_timer();
+    short_event.event().restart_timer();
+
+    long_event.wait();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    short_event.event().cancel_timer();
+
+    ASSERT_GE(elapsed, std::chrono::milliseconds(1500));
+    ASSERT_EQ(long_event.successed_.load(std::memory_order_relaxed), 1);
+    ASSERT_GT(short_event.successed_.load(std::memory_order_relaxed), 10);
+}
+
 
 /*!
  * @fn TEST(TimedEvent, Event_AutoRestartAndDeleteRandomly)
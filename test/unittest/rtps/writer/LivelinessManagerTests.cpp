@@ -503,6 +503,79 @@ TEST_F(LivelinessManagerTests, TimerOwnerRemoved)
     EXPECT_EQ(num_writers_lost, 1u);
 }
 
+//! Tests that the timer moves to the next writer when the timer owner asserts its liveliness before expiring
+TEST_F(LivelinessManagerTests, TimerOwnerAsserted)
+{
+    LivelinessManager liveliness_manager(
+        std::bind(&LivelinessManagerTests::liveliness_changed,
+        this,
+        std::placeholders::_1,
+        std::placeholders::_2,
+        std::placeholders::_3,
+        std::placeholders::_4,
+        std::placeholders::_5),
+        service_);
+
+    GuidPrefix_t guidP;
+    guidP.value[0] = 1;
+
+    liveliness_manager.add_writer(GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.5));
+    liveliness_manager.add_writer(GUID_t(guidP, 2), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.8));
+
+    liveliness_manager.assert_liveliness(GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.5));
+    liveliness_manager.assert_liveliness(GUID_t(guidP, 2), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.8));
+
+    // Writer 1 is the timer owner, and is due to lose its liveliness after writer 2 once asserted again
+    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+    liveliness_manager.assert_liveliness(GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.5));
+
+    wait_liveliness_lost(1u);
+    EXPECT_EQ(writer_losing_liveliness, GUID_t(guidP, 2));
+
+    wait_liveliness_lost(2u);
+    EXPECT_EQ(writer_losing_liveliness, GUID_t(guidP, 1));
+}
+
+//! Tests that writers can still be found after removing a writer which is not the last one added
+TEST_F(LivelinessManagerTests, WriterRemovedFromTheMiddle)
+{
+    LivelinessManager liveliness_manager(
+        nullptr,
+        service_);
+
+    GuidPrefix_t guidP;
+    guidP.value[0] = 1;
+    LivelinessData::WriterStatus writer_status;
+
+    liveliness_manager.add_writer(GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(10));
+    liveliness_manager.add_writer(GUID_t(guidP, 2), MANUAL_BY_PARTICIPANT_LIVELINESS_QOS, Duration_t(10));
+    liveliness_manager.add_writer(GUID_t(guidP, 3), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(10));
+
+    EXPECT_TRUE(liveliness_manager.remove_writer(
+                GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(10), writer_status));
+    EXPECT_FALSE(liveliness_manager.assert_liveliness(
+                GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(10)));
+    EXPECT_TRUE(liveliness_manager.assert_liveliness(
+                GUID_t(guidP, 3), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(10)));
+    EXPECT_TRUE(liveliness_manager.is_any_alive(MANUAL_BY_TOPIC_LIVELINESS_QOS));
+    EXPECT_FALSE(liveliness_manager.is_any_alive(MANUAL_BY_PARTICIPANT_LIVELINESS_QOS));
+
+    auto liveliness_data = liveliness_manager.get_liveliness_data();
+    ASSERT_EQ(liveliness_data.size(), 2u);
+    for (const LivelinessData& writer : liveliness_data)
+    {
+        EXPECT_EQ(writer.status, writer.guid == GUID_t(guidP, 3) ?
+                LivelinessData::WriterStatus::ALIVE : LivelinessData::WriterStatus::NOT_ASSERTED);
+    }
+
+    EXPECT_TRUE(liveliness_manager.remove_writer(
+                GUID_t(guidP, 3), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(10), writer_status));
+    EXPECT_EQ(writer_status, LivelinessData::WriterStatus::ALIVE);
+    EXPECT_FALSE(liveliness_manager.is_any_alive(MANUAL_BY_TOPIC_LIVELINESS_QOS));
+    EXPECT_TRUE(liveliness_manager.assert_liveliness(MANUAL_BY_PARTICIPANT_LIVELINESS_QOS, guidP));
+    EXPECT_TRUE(liveliness_manager.is_any_alive(MANUAL_BY_PARTICIPANT_LIVELINESS_QOS));
+}
+
 } // namespace fastrtps
 } // namespace eprosima
 
@@ -333,6 +333,68 @@ TEST(ReaderProxyTests, process_nack_frag_multiple_fragments_different_windows_te
             TOTAL_NUMBER_OF_FRAGMENTS + 1u), TOTAL_NUMBER_OF_FRAGMENTS + 1u);
 }
 
+TEST(ReaderProxyTests, process_nack_frag_max_repair_fragments_test)
+{
+    constexpr FragmentNumber_t TOTAL_NUMBER_OF_FRAGMENTS = 100;
+    constexpr uint16_t FRAGMENT_SIZE = 100;
+    constexpr uint32_t MAX_REPAIR_FRAGMENTS = 2;
+
+    StatefulWriter writerMock;
+    WriterTimes wTimes;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(wTimes, alloc, &writerMock);
+    CacheChange_t seq;
+    seq.sequenceNumber = {0, 1};
+    seq.serializedPayload.length = TOTAL_NUMBER_OF_FRAGMENTS * FRAGMENT_SIZE;
+    seq.setFragmentSize(FRAGMENT_SIZE);
+
+    ReaderProxyData reader_attributes(0, 0);
+    reader_attributes.m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+    rproxy.start(reader_attributes);
+
+    ChangeForReader_t change(&seq);
+    rproxy.add_change(change, true, false);
+
+    for (auto i = 1u; i <= TOTAL_NUMBER_OF_FRAGMENTS; ++i)
+    {
+        ASSERT_EQ(mark_next_fragment_sent(rproxy, seq.sequenceNumber, i), i);
+    }
+
+    // Requests are suppressed while the fragments may still be in flight.
+    rproxy.from_unsent_to_status(seq.sequenceNumber, UNDERWAY, false, true);
+    std::vector<FragmentNumber_t> undelivered_fragments = {3, 6, 8, 50};
+    FragmentNumberSet_t undelivered_fragment_set(undelivered_fragments.front());
+    for (auto fragment: undelivered_fragments)
+    {
+        undelivered_fragment_set.add(fragment);
+    }
+    EXPECT_FALSE(rproxy.process_nack_frag({}, 1, seq.sequenceNumber, undelivered_fragment_set,
+            MAX_REPAIR_FRAGMENTS));
+
+    // Only the lowest requested fragments are resent.
+    rproxy.perform_nack_supression();
+    EXPECT_TRUE(rproxy.process_nack_frag({}, 2, seq.sequenceNumber, undelivered_fragment_set,
+            MAX_REPAIR_FRAGMENTS));
+    rproxy.perform_acknack_response(nullptr);
+    ASSERT_EQ(mark_next_fragment_sent(rproxy, seq.sequenceNumber, 3u), 3u);
+
+    // A new request while the first ones are pending does not exceed the limit.
+    undelivered_fragments = {6, 8, 50};
+    FragmentNumberSet_t remaining_fragment_set(undelivered_fragments.front());
+    for (auto fragment: undelivered_fragments)
+    {
+        remaining_fragment_set.add(fragment);
+    }
+    EXPECT_TRUE(rproxy.process_nack_frag({}, 3, seq.sequenceNumber, remaining_fragment_set,
+            MAX_REPAIR_FRAGMENTS));
+    ASSERT_EQ(mark_next_fragment_sent(rproxy, seq.sequenceNumber, 6u), 6u);
+    ASSERT_EQ(mark_next_fragment_sent(rproxy, seq.sequenceNumber, 8u), 8u);
+
+    // All requested fragments are marked as sent.
+    ASSERT_EQ(mark_next_fragment_sent(rproxy, seq.sequenceNumber,
+            TOTAL_NUMBER_OF_FRAGMENTS + 1u), TOTAL_NUMBER_OF_FRAGMENTS + 1u);
+}
+
 TEST(ReaderProxyTests, has_been_delivered_test)
 {
     StatefulWriter writer_mock;
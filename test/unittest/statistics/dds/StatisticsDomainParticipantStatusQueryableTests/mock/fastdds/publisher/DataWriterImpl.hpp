@@ -200,6 +200,13 @@ public:
         return ReturnCode_t::RETCODE_OK;
     }
 
+    ReturnCode_t write_many(
+            const std::vector<void*>&,
+            fastrtps::rtps::WriteParams& )
+    {
+        return ReturnCode_t::RETCODE_OK;
+    }
+
     InstanceHandle_t register_instance(
             void* )
     {
@@ -791,6 +791,72 @@ TEST_F(UDPv4Tests, double_binding_fails)
     EXPECT_FALSE(default_transport.IsInputChannelOpen(locator));
 }
 
+#if defined(__linux__)
+TEST_F(UDPv4Tests, receive_with_several_sockets_per_locator)
+{
+    constexpr uint32_t num_sockets = 4;
+    constexpr uint32_t num_prefixes = 16;
+
+    descriptor.maxMessageSize = 100;
+    descriptor.interfaceWhiteList.emplace_back("127.0.0.1");
+    descriptor.input_sockets_per_locator = num_sockets;
+    UDPv4Transport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t unicastLocator;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "127.0.0.1", g_default_port, unicastLocator);
+    LocatorList_t locator_list;
+    locator_list.push_back(unicastLocator);
+
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    ASSERT_TRUE(receiver.is_valid());
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(unicastLocator));
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    // The port is still exclusive for transports not using the option
+    UDPv4TransportDescriptor exclusive_descriptor = descriptor;
+    exclusive_descriptor.input_sockets_per_locator = 1;
+    UDPv4Transport exclusive_transport(exclusive_descriptor);
+    ASSERT_TRUE(exclusive_transport.init());
+    MockReceiverResource exclusive_receiver(exclusive_transport, unicastLocator);
+    EXPECT_FALSE(exclusive_receiver.is_valid());
+
+    // Another transport using the option cannot join the group either
+    UDPv4Transport shared_transport(descriptor);
+    ASSERT_TRUE(shared_transport.init());
+    MockReceiverResource shared_receiver(shared_transport, unicastLocator);
+    EXPECT_FALSE(shared_receiver.is_valid());
+    EXPECT_FALSE(shared_transport.IsInputChannelOpen(unicastLocator));
+
+    // Datagrams are received whatever the socket they are steered to
+    Semaphore sem;
+    msg_recv->setCallback([&sem]()
+            {
+                sem.post();
+            });
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, unicastLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    octet message[RTPSMESSAGE_HEADER_SIZE] = { 'R', 'T', 'P', 'S', 2, 3, 1, 15 };
+    for (uint32_t i = 0; i < num_prefixes; ++i)
+    {
+        message[8] = static_cast<octet>(i);
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+        EXPECT_TRUE(send_resource_list.at(0)->send(message, sizeof(message), &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+    }
+
+    for (uint32_t i = 0; i < num_prefixes; ++i)
+    {
+        sem.wait();
+    }
+}
+
+#endif // if defined(__linux__)
+
 void UDPv4Tests::HELPER_SetDescriptorDefaults()
 {
     descriptor.maxMessageSize = 5;
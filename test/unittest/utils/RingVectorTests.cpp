@@ -0,0 +1,175 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <deque>
+
+#include <gtest/gtest.h>
+
+#include <fastrtps/utils/collections/RingVector.hpp>
+
+using namespace eprosima::fastrtps;
+
+static void check_equal(
+        const RingVector<int>& uut,
+        const std::deque<int>& expected)
+{
+    ASSERT_EQ(expected.size(), uut.size());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), uut.begin()));
+    EXPECT_TRUE(std::equal(expected.rbegin(), expected.rend(), uut.rbegin()));
+}
+
+TEST(RingVectorTests, fifo_wraps_around)
+{
+    RingVector<int> uut;
+    std::deque<int> expected;
+
+    uut.reserve(5);
+    EXPECT_EQ(8u, uut.capacity());
+
+    // Keep a window of 6 elements moving through the buffer, so the contents wrap around several times
+    for (int i = 0; i < 100; ++i)
+    {
+        uut.push_back(i);
+        expected.push_back(i);
+        if (expected.size() > 6)
+        {
+            uut.erase(uut.begin());
+            expected.pop_front();
+        }
+        check_equal(uut, expected);
+    }
+
+    // No reallocation was needed
+    EXPECT_EQ(8u, uut.capacity());
+    EXPECT_EQ(94, uut.front());
+    EXPECT_EQ(99, uut.back());
+    EXPECT_EQ(96, uut.at(2));
+    EXPECT_THROW(uut.at(6), std::out_of_range);
+}
+
+TEST(RingVectorTests, insert_and_erase_in_the_middle)
+{
+    RingVector<int> uut;
+    std::deque<int> expected;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        uut.push_back(i * 10);
+        expected.push_back(i * 10);
+    }
+    uut.pop_front();
+    uut.pop_front();
+    expected.pop_front();
+    expected.pop_front();
+
+    // Sorted insertion as done by ReaderHistory
+    for (int value : {25, 5, 95, 61})
+    {
+        auto it = uut.insert(std::lower_bound(uut.begin(), uut.end(), value), value);
+        EXPECT_EQ(value, *it);
+        expected.insert(std::lower_bound(expected.begin(), expected.end(), value), value);
+        check_equal(uut, expected);
+    }
+
+    // Erase returns the iterator following the removed element
+    auto it = std::find(uut.begin(), uut.end(), 61);
+    it = uut.erase(it);
+    expected.erase(std::find(expected.begin(), expected.end(), 61));
+    EXPECT_EQ(70, *it);
+    check_equal(uut, expected);
+
+    // Iterators before the erased element remain valid
+    RingVector<int>::const_iterator first = uut.cbegin();
+    uut.erase(uut.end() - 1);
+    expected.pop_back();
+    EXPECT_EQ(5, *first);
+    check_equal(uut, expected);
+
+    // Erase while iterating backwards
+    for (auto rit = uut.rbegin(); rit != uut.rend(); ++rit)
+    {
+        if (*rit % 20 == 0)
+        {
+            uut.erase(std::next(rit).base());
+        }
+    }
+    expected.erase(std::remove_if(expected.begin(), expected.end(), [](int v)
+            {
+                return v % 20 == 0;
+            }), expected.end());
+    check_equal(uut, expected);
+
+    uut.clear();
+    EXPECT_TRUE(uut.empty());
+    EXPECT_EQ(uut.begin(), uut.end());
+}
+
+TEST(RingVectorTests, erase_ranges)
+{
+    RingVector<int> uut;
+    std::deque<int> expected;
+
+    // Wrap the buffer around, so the ranges cross the end of the storage
+    for (int i = 0; i < 12; ++i)
+    {
+        uut.push_back(i);
+        expected.push_back(i);
+    }
+    for (int i = 0; i < 6; ++i)
+    {
+        uut.erase(uut.begin());
+        expected.pop_front();
+    }
+    for (int i = 12; i < 20; ++i)
+    {
+        uut.push_back(i);
+        expected.push_back(i);
+    }
+    check_equal(uut, expected);
+
+    // Range at the beginning
+    auto it = uut.erase(uut.begin(), uut.begin() + 3);
+    expected.erase(expected.begin(), expected.begin() + 3);
+    EXPECT_EQ(uut.begin(), it);
+    check_equal(uut, expected);
+
+    // Range in the middle
+    it = uut.erase(uut.begin() + 2, uut.begin() + 5);
+    expected.erase(expected.begin() + 2, expected.begin() + 5);
+    EXPECT_EQ(expected[2], *it);
+    check_equal(uut, expected);
+
+    // Empty range
+    it = uut.erase(uut.begin() + 1, uut.begin() + 1);
+    EXPECT_EQ(expected[1], *it);
+    check_equal(uut, expected);
+
+    // Range at the end
+    it = uut.erase(uut.end() - 2, uut.end());
+    expected.erase(expected.end() - 2, expected.end());
+    EXPECT_EQ(uut.end(), it);
+    check_equal(uut, expected);
+
+    uut.erase(uut.begin(), uut.end());
+    EXPECT_TRUE(uut.empty());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}